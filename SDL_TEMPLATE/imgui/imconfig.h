@@ -51,6 +51,11 @@
 //#define IMGUI_DISABLE_DEFAULT_FONT                        // Disable default embedded font (ProggyClean.ttf), remove ~9.5 KB from output binary. AddFontDefault() will assert.
 //#define IMGUI_DISABLE_SSE                                 // Disable use of SSE intrinsics even if available
 
+//---- Use worker threads (std::thread) to speed up some heavy operations, e.g. rasterizing glyphs in ImFontAtlas::Build().
+// Without this, the same code paths run serially on the calling thread and produce identical results.
+// Requires linking with your platform threading library when applicable (e.g. '-pthread' with GCC/Clang on Linux).
+#define IMGUI_ENABLE_THREADS
+
 //---- Enable Test Engine / Automation features.
 //#define IMGUI_ENABLE_TEST_ENGINE                          // Enable imgui_test_engine hooks. Generally set automatically by include "imgui_te_config.h", see Test Engine for details.
 
@@ -62,6 +67,11 @@
 //---- Pack vertex colors as BGRA8 instead of RGBA8 (to avoid converting from one to another). Need dedicated backend support.
 //#define IMGUI_USE_BGRA_PACKED_COLOR
 
+//---- Use a compact 12 bytes ImDrawVert (16-bit fixed point positions, 16-bit normalized UV) instead of the default 20 bytes. Need dedicated backend support (see imgui_impl_opengl3.cpp).
+// Positions are limited to +/-8192 with 1/4 pixel precision by default and UV to 0.0f..1.0f. See ImDrawVert in imgui.h for details.
+//#define IMGUI_USE_COMPACT_DRAWVERT
+//#define IMGUI_COMPACT_DRAWVERT_POS_FRAC_BITS  2
+
 //---- Use legacy CRC32-adler tables (used before 1.91.6), in order to preserve old .ini data that you cannot afford to invalidate.
 //#define IMGUI_USE_LEGACY_CRC32_ADLER
 
@@ -70,6 +80,11 @@
 
 //---- Avoid multiple STB libraries implementations, or redefine path/filenames to prioritize another version
 // By default the embedded implementations are declared static and not available outside of Dear ImGui sources files.
+// Our imstb_truetype.h and imstb_rectpack.h add a few optional functions, advertised by STBTT_HAS_xxx/STBRP_HAS_xxx defines.
+// A stock stb header doesn't define them, and the matching features are replaced by the stock code paths:
+// - STBTT_HAS_FONT_ACCEL: no decoded cmap/loca tables, glyph lookups in very large glyph ranges are slower.
+// - STBTT_HAS_GLYPH_KERN_PAIRS: ImFontConfig::Kerning queries 'GPOS' kerning pair by pair, which is slow with large glyph ranges.
+// - STBRP_HAS_MAXRECTS: ImFontAtlasFlags_DynamicGlyphs pages use the skyline packer, which fits fewer glyphs per page.
 //#define IMGUI_STB_TRUETYPE_FILENAME   "my_folder/stb_truetype.h"
 //#define IMGUI_STB_RECT_PACK_FILENAME  "my_folder/stb_rect_pack.h"
 //#define IMGUI_STB_SPRINTF_FILENAME    "my_folder/stb_sprintf.h"    // only used if IMGUI_USE_STB_SPRINTF is defined.
@@ -81,6 +96,10 @@
 // Compatibility checks of arguments and formats done by clang and GCC will be disabled in order to support the extra formats provided by stb_sprintf.h.
 //#define IMGUI_USE_STB_SPRINTF
 
+//---- Use a built-in formatter for the common subset of printf formats (%d %u %x %f %g %s %c with flags, width and precision), which is much faster than vsnprintf().
+// Other formats, and values which can't be converted exactly, are passed to vsnprintf() (or stb_sprintf.h). The decimal point is always '.' regardless of locale.
+//#define IMGUI_USE_BUILTIN_FORMAT
+
 //---- Use FreeType to build and rasterize the font atlas (instead of stb_truetype which is embedded by default in Dear ImGui)
 // Requires FreeType headers to be available in the include path. Requires program to be compiled with 'misc/freetype/imgui_freetype.cpp' (in this repository) + the FreeType library (not provided).
 // On Windows you may use vcpkg with 'vcpkg install freetype --triplet=x64-windows' + 'vcpkg integrate install'.
@@ -67,11 +67,12 @@ CODE
 // [SECTION] MISC HELPERS/UTILITIES (Geometry functions)
 // [SECTION] MISC HELPERS/UTILITIES (String, Format, Hash functions)
 // [SECTION] MISC HELPERS/UTILITIES (File functions)
+// [SECTION] MISC HELPERS/UTILITIES (Threading, Time functions)
 // [SECTION] MISC HELPERS/UTILITIES (ImText* functions)
 // [SECTION] MISC HELPERS/UTILITIES (Color functions)
 // [SECTION] ImGuiStorage
-// [SECTION] ImGuiTextFilter
-// [SECTION] ImGuiTextBuffer, ImGuiTextIndex
+// [SECTION] ImGuiTextFilter, ImGuiTextFilterIndex
+// [SECTION] ImGuiTextBuffer, ImGuiTextIndex, ImGuiTextWrapLayout, ImGuiTextLog, ImGuiTextFileView
 // [SECTION] ImGuiListClipper
 // [SECTION] STYLING
 // [SECTION] RENDER HELPERS
@@ -1102,6 +1103,13 @@ CODE
 // System includes
 #include <stdio.h>      // vsnprintf, sscanf, printf
 #include <stdint.h>     // intptr_t
+#include <chrono>       // steady_clock (ImTimeGetSeconds)
+#include <atomic>       // ImGuiTextLogQueue
+#ifdef IMGUI_ENABLE_THREADS
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#endif
 
 // [Windows] On non-Visual Studio compilers, we default to IMGUI_DISABLE_WIN32_DEFAULT_IME_FUNCTIONS unless explicitly enabled
 #if defined(_WIN32) && !defined(_MSC_VER) && !defined(IMGUI_ENABLE_WIN32_DEFAULT_IME_FUNCTIONS) && !defined(IMGUI_DISABLE_WIN32_DEFAULT_IME_FUNCTIONS)
@@ -1137,6 +1145,15 @@ CODE
 #include <TargetConditionals.h>
 #endif
 
+// [POSIX] OS specific includes (memory mapped files, atomic file writes)
+#if !defined(_WIN32) && (defined(__unix__) || defined(__APPLE__)) && !defined(IMGUI_DISABLE_DEFAULT_FILE_FUNCTIONS)
+#include <fcntl.h>          // open
+#include <sys/mman.h>       // mmap, munmap
+#include <sys/stat.h>       // fstat
+#include <unistd.h>         // close, fsync
+#define IMGUI_ENABLE_POSIX_FILE_MAPPING
+#endif
+
 // Visual Studio warnings
 #ifdef _MSC_VER
 #pragma warning (disable: 4127)             // condition expression is constant
@@ -1220,6 +1237,10 @@ static void*            WindowSettingsHandler_ReadOpen(ImGuiContext*, ImGuiSetti
 static void             WindowSettingsHandler_ReadLine(ImGuiContext*, ImGuiSettingsHandler*, void* entry, const char* line);
 static void             WindowSettingsHandler_ApplyAll(ImGuiContext*, ImGuiSettingsHandler*);
 static void             WindowSettingsHandler_WriteAll(ImGuiContext*, ImGuiSettingsHandler*, ImGuiTextBuffer* buf);
+static void             WindowSettingsHandler_WriteAllBinary(ImGuiContext*, ImGuiSettingsHandler*, ImGuiTextBuffer* buf);
+static void             WindowSettingsHandler_ReadAllBinary(ImGuiContext*, ImGuiSettingsHandler*, ImGuiSettingsBinaryReader* reader);
+static void             SettingsSaveWorkerWaitIdle(ImGuiContext* ctx);
+static void             SettingsSaveWorkerDestroy(ImGuiContext* ctx);
 
 // Platform Dependents default implementation for ImGuiPlatformIO functions
 static const char*      Platform_GetClipboardTextFn_DefaultImpl(ImGuiContext* ctx);
@@ -1275,6 +1296,7 @@ static void             UpdateKeyRoutingTable(ImGuiKeyRoutingTable* rt);
 
 // Misc
 static void             UpdateSettings();
+static void             UpdateTextSizeCache();
 static int              UpdateWindowManualResize(ImGuiWindow* window, const ImVec2& size_auto_fit, int* border_hovered, int* border_held, int resize_grip_count, ImU32 resize_grip_col[4], const ImRect& visibility_rect);
 static void             RenderWindowOuterBorders(ImGuiWindow* window);
 static void             RenderWindowDecorations(ImGuiWindow* window, const ImRect& title_bar_rect, bool title_bar_is_highlight, bool handle_borders_and_resize_grips, int resize_grip_count, const ImU32 resize_grip_col[4], float resize_grip_draw_size);
@@ -1506,6 +1528,8 @@ ImGuiIO::ImGuiIO()
     ConfigWindowsCopyContentsWithCtrlC = false;
     ConfigScrollbarScrollByPage = true;
     ConfigMemoryCompactTimer = 60.0f;
+    ConfigTextSizeCacheSize = 0;
+    ConfigIniSettingsBinary = false;
     ConfigDebugIsDebuggerPresent = false;
     ConfigDebugHighlightIdConflicts = true;
     ConfigDebugHighlightIdConflictsShowItemPicker = true;
@@ -2142,6 +2166,16 @@ const char* ImStrSkipBlank(const char* str)
     return str;
 }
 
+// On some platform vsnprintf() takes va_list by reference and modifies it.
+// va_copy is the 'correct' way to copy a va_list but Visual Studio prior to 2013 doesn't have it.
+#ifndef va_copy
+#if defined(__GNUC__) || defined(__clang__)
+#define va_copy(dest, src) __builtin_va_copy(dest, src)
+#else
+#define va_copy(dest, src) (dest = src)
+#endif
+#endif
+
 // A) MSVC version appears to return -1 on overflow, whereas glibc appears to return total count (which may be >= buf_size).
 // Ideally we would test for only one of those limits at runtime depending on the behavior the vsnprintf(), but trying to deduct it at compile time sounds like a pandora can of worm.
 // B) When buf==NULL vsnprintf() will return the output size.
@@ -2166,15 +2200,406 @@ const char* ImStrSkipBlank(const char* str)
 #define vsnprintf _vsnprintf
 #endif
 
-int ImFormatString(char* buf, size_t buf_size, const char* fmt, ...)
+#ifdef IMGUI_USE_BUILTIN_FORMAT
+// Built-in formatter for the subset of printf() formats commonly used with Dear ImGui, to avoid the overhead of vsnprintf():
+// - %d %i %u %x %X %c %s %f %F %g %G %% with flags '-' '+' ' ' '0', width, precision (including '*'), length modifiers hh h l ll z j t I64 I32.
+// - Floating point values are rounded exactly like a correctly rounded printf(): values are scaled to an integer of less than 52 bits
+//   and we verify that the rounding error of the scaling can't change the result. This covers typical UI values.
+// - Anything else (e.g. %e, %p, '#' flag, NULL strings, huge/tiny values, non-finite values, ties) returns -1: the caller then
+//   formats the whole string with vsnprintf().
+// - Locale is ignored: the decimal point is always '.'.
+static const char ImFormatDigitPairs[201] =
+    "00010203040506070809" "10111213141516171819" "20212223242526272829" "30313233343536373839" "40414243444546474849"
+    "50515253545556575859" "60616263646566676869" "70717273747576777879" "80818283848586878889" "90919293949596979899";
+static const double ImFormatPow10[] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15 };
+static const ImU64  ImFormatPow10U64[] = { 1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL, 10000000ULL, 100000000ULL, 1000000000ULL,
+    10000000000ULL, 100000000000ULL, 1000000000000ULL, 10000000000000ULL, 100000000000000ULL, 1000000000000000ULL };
+
+// Write decimal digits of 'v' backward, ending at 'p_end'. Return beginning.
+static char* ImFormatU64Dec(char* p_end, ImU64 v)
+{
+    char* p = p_end;
+    while (v > 0xFFFFFFFF)
+    {
+        const unsigned int pair = (unsigned int)(v % 100) * 2;
+        v /= 100;
+        *--p = ImFormatDigitPairs[pair + 1];
+        *--p = ImFormatDigitPairs[pair];
+    }
+    unsigned int v32 = (unsigned int)v; // Cheaper divisions
+    while (v32 >= 100)
+    {
+        const unsigned int pair = (v32 % 100) * 2;
+        v32 /= 100;
+        *--p = ImFormatDigitPairs[pair + 1];
+        *--p = ImFormatDigitPairs[pair];
+    }
+    if (v32 >= 10)
+    {
+        *--p = ImFormatDigitPairs[v32 * 2 + 1];
+        *--p = ImFormatDigitPairs[v32 * 2];
+    }
+    else
+    {
+        *--p = (char)('0' + v32);
+    }
+    return p;
+}
+
+// Round v * 10^precision (v >= 0) to the nearest integer. Return false if we can't guarantee the result.
+// Exact ties are left to vsnprintf() as their rounding differs between C libraries.
+static bool ImFormatRoundScaled(double v, int precision, ImU64* out)
 {
-    va_list args;
-    va_start(args, fmt);
+    if (precision >= IM_ARRAYSIZE(ImFormatPow10))
+        return false;
+    const double p10 = ImFormatPow10[precision];
+    const double scaled = v * p10;
+    if (!(scaled < 4503599627370496.0)) // 2^52 (also rejects NaN)
+        return false;
+
+    // Dekker's product: v * p10 == scaled + err exactly (all products below are exact).
+    const double v_c = v * 134217729.0, v_hi = v_c - (v_c - v), v_lo = v - v_hi;
+    const double p_c = p10 * 134217729.0, p_hi = p_c - (p_c - p10), p_lo = p10 - p_hi;
+    const double err = ((v_hi * p_hi - scaled) + v_hi * p_lo + v_lo * p_hi) + v_lo * p_lo;
+
+    // (scaled - n - 0.5) is exact, adding 'err' can't change its sign.
+    ImU64 n = (ImU64)scaled;
+    const double d = (scaled - (double)n - 0.5) + err;
+    if (d > 0.0)
+        n++;
+    else if (d == 0.0)
+        return false;
+    *out = n;
+    return true;
+}
+
+// Write n / 10^precision with 'precision' decimals. 'buf' needs 17 + 1 + precision bytes.
+static int ImFormatFixedDigits(char* buf, ImU64 n, int precision)
+{
+    char tmp[24];
+    char* p_end = tmp + IM_ARRAYSIZE(tmp);
+    char* p = ImFormatU64Dec(p_end, n / ImFormatPow10U64[precision]);
+    int len = (int)(p_end - p);
+    memcpy(buf, p, (size_t)len);
+    if (precision > 0)
+    {
+        buf[len++] = '.';
+        ImU64 frac = n % ImFormatPow10U64[precision];
+        for (int i = precision - 1; i >= 0; i--, frac /= 10)
+            buf[len + i] = (char)('0' + (int)(frac % 10));
+        len += precision;
+    }
+    return len;
+}
+
+// %g: with P significant digits and X the decimal exponent, use %f style with precision P-1-X when P > X >= -4, then remove trailing zeros.
+static int ImFormatGeneralDigits(char* buf, double v, int precision)
+{
+    if (precision == 0)
+        precision = 1;
+    if (v == 0.0)
+    {
+        buf[0] = '0';
+        return 1;
+    }
+    if (v < 1e-4 || precision >= IM_ARRAYSIZE(ImFormatPow10))
+        return -1;
+    int exp10 = 0;
+    while (exp10 + 1 < IM_ARRAYSIZE(ImFormatPow10) && v >= ImFormatPow10[exp10 + 1])
+        exp10++;
+    if (v < 1.0)
+        for (exp10 = -1; exp10 > -4 && v * ImFormatPow10[-exp10] < 1.0; exp10--) {}
+    ImU64 n = 0;
+    for (int retry = 0; ; retry++)
+    {
+        // Fix estimated exponent when rounding carried over, or when the estimate was off due to inexact scaling.
+        if (exp10 < -4 || exp10 >= precision || retry == 3)
+            return -1;
+        if (!ImFormatRoundScaled(v, precision - 1 - exp10, &n))
+            return -1;
+        if (n >= ImFormatPow10U64[precision])
+            exp10++;
+        else if (n < ImFormatPow10U64[precision - 1])
+            exp10--;
+        else
+            break;
+    }
+    int len = ImFormatFixedDigits(buf, n, precision - 1 - exp10);
+    if (precision - 1 - exp10 > 0)
+    {
+        while (buf[len - 1] == '0')
+            len--;
+        if (buf[len - 1] == '.')
+            len--;
+    }
+    return len;
+}
+
+static inline void ImFormatWrite(char* buf, size_t buf_size, size_t* pos, const char* src, size_t len)
+{
+    if (*pos + len <= buf_size && len <= 16)
+    {
+        char* dst = buf + *pos; // Most writes are short
+        for (size_t n = 0; n < len; n++)
+            dst[n] = src[n];
+    }
+    else if (*pos < buf_size)
+    {
+        memcpy(buf + *pos, src, ImMin(len, buf_size - *pos));
+    }
+    *pos += len;
+}
+
+static inline void ImFormatWriteRepeat(char* buf, size_t buf_size, size_t* pos, char c, int count)
+{
+    if (count <= 0)
+        return;
+    if (*pos < buf_size)
+        memset(buf + *pos, c, ImMin((size_t)count, buf_size - *pos));
+    *pos += (size_t)count;
+}
+
+static int ImFormatStringBuiltinV(char* buf, size_t buf_size, const char* fmt, va_list args)
+{
+    if (buf == NULL)
+        buf_size = 0;
+    size_t pos = 0;
+    char tmp[64];
+    for (const char* p = fmt; ; )
+    {
+        // Literal text
+        const char* run_end = p;
+        while (*run_end != 0 && *run_end != '%')
+            run_end++;
+        ImFormatWrite(buf, buf_size, &pos, p, (size_t)(run_end - p));
+        if (*run_end == 0)
+            break;
+        p = run_end + 1;
+        if (*p == '%')
+        {
+            ImFormatWrite(buf, buf_size, &pos, p++, 1);
+            continue;
+        }
+
+        // Flags, width, precision
+        bool flag_left = false, flag_zero = false;
+        char sign_positive = 0;
+        for (;; p++)
+        {
+            if (*p == '-')      { flag_left = true; }
+            else if (*p == '0') { flag_zero = true; }
+            else if (*p == '+') { sign_positive = '+'; }
+            else if (*p == ' ') { if (sign_positive == 0) sign_positive = ' '; }
+            else                { break; }
+        }
+        int width = 0;
+        if (*p == '*')
+        {
+            width = va_arg(args, int);
+            if (width < 0)
+            {
+                flag_left = true;
+                width = -width;
+            }
+            p++;
+        }
+        else
+        {
+            while (*p >= '0' && *p <= '9')
+                width = width * 10 + (*p++ - '0');
+        }
+        int precision = -1;
+        if (*p == '.')
+        {
+            p++;
+            if (*p == '*')
+            {
+                precision = va_arg(args, int);
+                if (precision < 0)
+                    precision = -1;
+                p++;
+            }
+            else
+            {
+                precision = 0;
+                while (*p >= '0' && *p <= '9')
+                    precision = precision * 10 + (*p++ - '0');
+            }
+        }
+        if (width > 4096 || precision > 4096)
+            return -1;
+
+        // Length modifiers
+        enum { Len_Int, Len_Char, Len_Short, Len_Long, Len_LongLong, Len_Size, Len_IntMax, Len_PtrDiff };
+        int length = Len_Int;
+        if (p[0] == 'h')        { length = (p[1] == 'h') ? Len_Char : Len_Short; p += (p[1] == 'h') ? 2 : 1; }
+        else if (p[0] == 'l')   { length = (p[1] == 'l') ? Len_LongLong : Len_Long; p += (p[1] == 'l') ? 2 : 1; }
+        else if (p[0] == 'z')   { length = Len_Size; p++; }
+        else if (p[0] == 'j')   { length = Len_IntMax; p++; }
+        else if (p[0] == 't')   { length = Len_PtrDiff; p++; }
+        else if (p[0] == 'I' && p[1] == '6' && p[2] == '4') { length = Len_LongLong; p += 3; }
+        else if (p[0] == 'I' && p[1] == '3' && p[2] == '2') { p += 3; }
+
+        // Conversion: produce optional sign, body, and number of leading zeroes
+        const char conv = *p++;
+        char sign = 0;
+        const char* body = tmp;
+        int body_len = 0;
+        int zero_pad = 0;
+        bool allow_zero_flag = true;
+        switch (conv)
+        {
+        case 'd': case 'i': case 'u': case 'x': case 'X':
+        {
+            ImU64 v;
+            if (conv == 'd' || conv == 'i')
+            {
+                ImS64 sv;
+                switch (length)
+                {
+                case Len_Char:      sv = (signed char)va_arg(args, int); break;
+                case Len_Short:     sv = (short)va_arg(args, int); break;
+                case Len_Long:      sv = va_arg(args, long); break;
+                case Len_LongLong:  sv = va_arg(args, long long); break;
+                case Len_Size:      sv = va_arg(args, ptrdiff_t); break;
+                case Len_IntMax:    sv = va_arg(args, intmax_t); break;
+                case Len_PtrDiff:   sv = va_arg(args, ptrdiff_t); break;
+                default:            sv = va_arg(args, int); break;
+                }
+                v = (sv < 0) ? (ImU64)0 - (ImU64)sv : (ImU64)sv;
+                sign = (sv < 0) ? '-' : sign_positive;
+            }
+            else
+            {
+                switch (length)
+                {
+                case Len_Char:      v = (unsigned char)va_arg(args, unsigned int); break;
+                case Len_Short:     v = (unsigned short)va_arg(args, unsigned int); break;
+                case Len_Long:      v = va_arg(args, unsigned long); break;
+                case Len_LongLong:  v = va_arg(args, unsigned long long); break;
+                case Len_Size:      v = va_arg(args, size_t); break;
+                case Len_IntMax:    v = va_arg(args, uintmax_t); break;
+                case Len_PtrDiff:   v = (ImU64)va_arg(args, ptrdiff_t); break;
+                default:            v = va_arg(args, unsigned int); break;
+                }
+            }
+            char* p_end = tmp + IM_ARRAYSIZE(tmp);
+            char* p_digits = p_end;
+            if (conv == 'x' || conv == 'X')
+            {
+                const char* hex_digits = (conv == 'x') ? "0123456789abcdef" : "0123456789ABCDEF";
+                for (; v != 0; v >>= 4)
+                    *--p_digits = hex_digits[v & 15];
+            }
+            else if (v != 0)
+            {
+                p_digits = ImFormatU64Dec(p_end, v);
+            }
+            if (p_digits == p_end && precision != 0)
+                *--p_digits = '0';
+            body = p_digits;
+            body_len = (int)(p_end - p_digits);
+            if (precision >= 0)
+            {
+                zero_pad = ImMax(precision - body_len, 0);
+                allow_zero_flag = false;
+            }
+            break;
+        }
+        case 'f': case 'F': case 'g': case 'G':
+        {
+            if (length != Len_Int && length != Len_Long)
+                return -1;
+            const double v = va_arg(args, double);
+            ImU64 v_bits;
+            memcpy(&v_bits, &v, sizeof(v));
+            sign = (v_bits >> 63) ? '-' : sign_positive; // Also for -0.0
+            const double v_abs = (v_bits >> 63) ? -v : v;
+            if (precision < 0)
+                precision = 6;
+            if (conv == 'f' || conv == 'F')
+            {
+                ImU64 n;
+                if (!ImFormatRoundScaled(v_abs, precision, &n))
+                    return -1;
+                body_len = ImFormatFixedDigits(tmp, n, precision);
+            }
+            else
+            {
+                body_len = ImFormatGeneralDigits(tmp, v_abs, precision);
+                if (body_len < 0)
+                    return -1;
+            }
+            break;
+        }
+        case 's':
+        {
+            if (length != Len_Int || flag_zero)
+                return -1;
+            const char* s = va_arg(args, const char*);
+            if (s == NULL)
+                return -1;
+            body = s;
+            if (precision < 0)
+                body_len = (int)ImStrlen(s);
+            else
+                for (body_len = 0; body_len < precision && s[body_len] != 0; body_len++) {}
+            break;
+        }
+        case 'c':
+        {
+            if (length != Len_Int || flag_zero)
+                return -1;
+            tmp[0] = (char)va_arg(args, int);
+            body_len = 1;
+            break;
+        }
+        default:
+            return -1;
+        }
+
+        // Padding
+        const int len = (sign ? 1 : 0) + zero_pad + body_len;
+        if (len < width && !flag_left)
+        {
+            if (flag_zero && allow_zero_flag)
+                zero_pad += width - len;
+            else
+                ImFormatWriteRepeat(buf, buf_size, &pos, ' ', width - len);
+        }
+        if (sign)
+            ImFormatWrite(buf, buf_size, &pos, &sign, 1);
+        ImFormatWriteRepeat(buf, buf_size, &pos, '0', zero_pad);
+        ImFormatWrite(buf, buf_size, &pos, body, (size_t)body_len);
+        if (len < width && flag_left)
+            ImFormatWriteRepeat(buf, buf_size, &pos, ' ', width - len);
+    }
+    return (pos > INT_MAX) ? -1 : (int)pos;
+}
+#endif // #ifdef IMGUI_USE_BUILTIN_FORMAT
+
+static int ImFormatStringImplV(char* buf, size_t buf_size, const char* fmt, va_list args)
+{
+#ifdef IMGUI_USE_BUILTIN_FORMAT
+    va_list args_copy;
+    va_copy(args_copy, args);
+    int w = ImFormatStringBuiltinV(buf, buf_size, fmt, args_copy);
+    va_end(args_copy);
+    if (w >= 0)
+        return w;
+#endif
 #ifdef IMGUI_USE_STB_SPRINTF
-    int w = stbsp_vsnprintf(buf, (int)buf_size, fmt, args);
+    return stbsp_vsnprintf(buf, (int)buf_size, fmt, args);
 #else
-    int w = vsnprintf(buf, buf_size, fmt, args);
+    return vsnprintf(buf, buf_size, fmt, args);
 #endif
+}
+
+int ImFormatString(char* buf, size_t buf_size, const char* fmt, ...)
+{
+    va_list args;
+    va_start(args, fmt);
+    int w = ImFormatStringImplV(buf, buf_size, fmt, args);
     va_end(args);
     if (buf == NULL)
         return w;
@@ -2186,11 +2611,7 @@ int ImFormatString(char* buf, size_t buf_size, const char* fmt, ...)
 
 int ImFormatStringV(char* buf, size_t buf_size, const char* fmt, va_list args)
 {
-#ifdef IMGUI_USE_STB_SPRINTF
-    int w = stbsp_vsnprintf(buf, (int)buf_size, fmt, args);
-#else
-    int w = vsnprintf(buf, buf_size, fmt, args);
-#endif
+    int w = ImFormatStringImplV(buf, buf_size, fmt, args);
     if (buf == NULL)
         return w;
     if (w == -1 || w >= (int)buf_size)
@@ -2438,6 +2859,208 @@ void*   ImFileLoadToMemory(const char* filename, const char* mode, size_t* out_f
     return file_data;
 }
 
+// Helper: Write file content so that readers (or a crash) never see a partially written file:
+// write a temporary file next to the destination, flush it to disk, then rename it over the destination.
+// Doesn't allocate memory, so it may be called from a worker thread. With custom file functions we can't rename files: write directly.
+bool    ImFileWriteAtomically(const char* filename, const char* mode, const void* data, size_t data_size)
+{
+    IM_ASSERT(filename && mode);
+#ifndef IMGUI_DISABLE_DEFAULT_FILE_FUNCTIONS
+    char tmp_filename[FILENAME_MAX];
+    const bool use_tmp_file = (ImFormatString(tmp_filename, IM_ARRAYSIZE(tmp_filename), "%s.tmp", filename) < IM_ARRAYSIZE(tmp_filename) - 1);
+#else
+    const char* tmp_filename = filename;
+    const bool use_tmp_file = false;
+#endif
+
+    ImFileHandle f = ImFileOpen(use_tmp_file ? tmp_filename : filename, mode);
+    if (f == NULL)
+        return false;
+    bool ret = (ImFileWrite(data, 1, (ImU64)data_size, f) == (ImU64)data_size);
+#ifdef IMGUI_ENABLE_POSIX_FILE_MAPPING
+    ret = ret && (fflush(f) == 0) && (fsync(fileno(f)) == 0);
+#endif
+    ret = ImFileClose(f) && ret;
+    if (!use_tmp_file)
+        return ret;
+
+#if defined(_WIN32) && !defined(IMGUI_DISABLE_WIN32_FUNCTIONS)
+    wchar_t tmp_filename_w[FILENAME_MAX];
+    wchar_t filename_w[FILENAME_MAX];
+    if (::MultiByteToWideChar(CP_UTF8, 0, tmp_filename, -1, tmp_filename_w, IM_ARRAYSIZE(tmp_filename_w)) == 0)
+        return false;
+    ret = ret && (::MultiByteToWideChar(CP_UTF8, 0, filename, -1, filename_w, IM_ARRAYSIZE(filename_w)) != 0);
+    ret = ret && (::MoveFileExW(tmp_filename_w, filename_w, MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != 0);
+    if (!ret)
+        ::DeleteFileW(tmp_filename_w);
+#else
+#ifdef _WIN32
+    // CRT rename() fails when the destination exists on Windows (with IMGUI_DISABLE_WIN32_FUNCTIONS): remove it first.
+    // This briefly leaves no file at all, which readers already handle, rather than a partially written one.
+    if (ret)
+        remove(filename);
+#endif
+    ret = ret && (rename(tmp_filename, filename) == 0);
+    if (!ret)
+        remove(tmp_filename);
+#endif
+    return ret;
+}
+
+bool    ImFileMapToMemory(const char* filename, ImFileMapping* out_mapping)
+{
+    IM_ASSERT(filename && out_mapping);
+    *out_mapping = ImFileMapping();
+#if defined(_WIN32) && !defined(IMGUI_DISABLE_WIN32_FUNCTIONS) && !defined(IMGUI_DISABLE_DEFAULT_FILE_FUNCTIONS)
+    const int filename_wsize = ::MultiByteToWideChar(CP_UTF8, 0, filename, -1, NULL, 0);
+    ImVector<wchar_t> filename_wbuf;
+    filename_wbuf.resize(filename_wsize);
+    ::MultiByteToWideChar(CP_UTF8, 0, filename, -1, filename_wbuf.Data, filename_wsize);
+    HANDLE file = ::CreateFileW(filename_wbuf.Data, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE)
+        return false;
+    LARGE_INTEGER file_size;
+    if (!::GetFileSizeEx(file, &file_size))
+    {
+        ::CloseHandle(file);
+        return false;
+    }
+    if (file_size.QuadPart == 0)
+    {
+        ::CloseHandle(file);
+        return true;
+    }
+    HANDLE mapping = ::CreateFileMappingW(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    const void* data = mapping ? ::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : NULL;
+    if (data == NULL)
+    {
+        if (mapping)
+            ::CloseHandle(mapping);
+        ::CloseHandle(file);
+        return false;
+    }
+    out_mapping->Data = data;
+    out_mapping->Size = (ImU64)file_size.QuadPart;
+    out_mapping->PlatformHandles[0] = (void*)file;
+    out_mapping->PlatformHandles[1] = (void*)mapping;
+    return true;
+#elif defined(IMGUI_ENABLE_POSIX_FILE_MAPPING)
+    int fd = ::open(filename, O_RDONLY);
+    if (fd < 0)
+        return false;
+    struct stat st;
+    if (::fstat(fd, &st) != 0)
+    {
+        ::close(fd);
+        return false;
+    }
+    if (st.st_size == 0)
+    {
+        ::close(fd);
+        return true;
+    }
+    void* data = ::mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd); // Mapping stays valid after closing the descriptor
+    if (data == MAP_FAILED)
+        return false;
+    out_mapping->Data = data;
+    out_mapping->Size = (ImU64)st.st_size;
+    return true;
+#else
+    size_t file_size = 0;
+    void* data = ImFileLoadToMemory(filename, "rb", &file_size, 0);
+    if (data == NULL)
+        return false;
+    out_mapping->Data = data;
+    out_mapping->Size = (ImU64)file_size;
+    out_mapping->DataOwned = true;
+    return true;
+#endif
+}
+
+void    ImFileUnmap(ImFileMapping* mapping)
+{
+    if (mapping->Data != NULL)
+    {
+        if (mapping->DataOwned)
+            IM_FREE((void*)mapping->Data);
+#if defined(_WIN32) && !defined(IMGUI_DISABLE_WIN32_FUNCTIONS) && !defined(IMGUI_DISABLE_DEFAULT_FILE_FUNCTIONS)
+        else
+        {
+            ::UnmapViewOfFile(mapping->Data);
+            ::CloseHandle((HANDLE)mapping->PlatformHandles[1]);
+            ::CloseHandle((HANDLE)mapping->PlatformHandles[0]);
+        }
+#elif defined(IMGUI_ENABLE_POSIX_FILE_MAPPING)
+        else
+            ::munmap((void*)mapping->Data, (size_t)mapping->Size);
+#endif
+    }
+    *mapping = ImFileMapping();
+}
+
+//-----------------------------------------------------------------------------
+// [SECTION] MISC HELPERS/UTILITIES (Threading, Time functions)
+//-----------------------------------------------------------------------------
+
+double  ImTimeGetSeconds()
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+int     ImThreadGetWorkersCount()
+{
+#ifdef IMGUI_ENABLE_THREADS
+    static int workers_count = 0;
+    if (workers_count == 0)
+        workers_count = ImClamp((int)std::thread::hardware_concurrency(), 1, IM_THREAD_WORKERS_MAX);
+    return workers_count;
+#else
+    return 1;
+#endif
+}
+
+#ifdef IMGUI_ENABLE_THREADS
+struct ImParallelForData
+{
+    ImParallelForFunc   Func;
+    void*               UserData;
+    int                 JobsCount;
+    std::atomic<int>    NextJob;
+};
+
+static void ImParallelForWorker(ImParallelForData* data)
+{
+    for (int job_n = data->NextJob.fetch_add(1); job_n < data->JobsCount; job_n = data->NextJob.fetch_add(1))
+        data->Func(data->UserData, job_n);
+}
+#endif
+
+// Jobs are handed out in increasing index order, so callers should submit their largest jobs first.
+void    ImParallelFor(int jobs_count, ImParallelForFunc func, void* user_data)
+{
+#ifdef IMGUI_ENABLE_THREADS
+    const int threads_count = ImMin(ImThreadGetWorkersCount(), jobs_count);
+    if (threads_count > 1)
+    {
+        ImParallelForData data;
+        data.Func = func;
+        data.UserData = user_data;
+        data.JobsCount = jobs_count;
+        data.NextJob = 0;
+        std::thread threads[IM_THREAD_WORKERS_MAX];
+        for (int thread_n = 1; thread_n < threads_count; thread_n++)
+            threads[thread_n] = std::thread(ImParallelForWorker, &data);
+        ImParallelForWorker(&data); // Calling thread participates
+        for (int thread_n = 1; thread_n < threads_count; thread_n++)
+            threads[thread_n].join();
+        return;
+    }
+#endif
+    for (int job_n = 0; job_n < jobs_count; job_n++)
+        func(user_data, job_n);
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] MISC HELPERS/UTILITIES (ImText* functions)
 //-----------------------------------------------------------------------------
@@ -2869,7 +3492,7 @@ void ImGuiStorage::SetAllInt(int v)
 IM_MSVC_RUNTIME_CHECKS_RESTORE
 
 //-----------------------------------------------------------------------------
-// [SECTION] ImGuiTextFilter
+// [SECTION] ImGuiTextFilter, ImGuiTextFilterIndex
 //-----------------------------------------------------------------------------
 
 // Helper: Parse and apply text filters. In format "aaaaa[,bbbb][,ccccc]"
@@ -2965,43 +3588,280 @@ bool ImGuiTextFilter::PassFilter(const char* text, const char* text_end) const
     return false;
 }
 
-//-----------------------------------------------------------------------------
-// [SECTION] ImGuiTextBuffer, ImGuiTextIndex
-//-----------------------------------------------------------------------------
-
-// On some platform vsnprintf() takes va_list by reference and modifies it.
-// va_copy is the 'correct' way to copy a va_list but Visual Studio prior to 2013 doesn't have it.
-#ifndef va_copy
-#if defined(__GNUC__) || defined(__clang__)
-#define va_copy(dest, src) __builtin_va_copy(dest, src)
-#else
-#define va_copy(dest, src) (dest = src)
-#endif
-#endif
-
-char ImGuiTextBuffer::EmptyString[1] = { 0 };
+// Case folding of ImGuiTextFilterIndex: needles are stored lower-case, and ASCII letters of the text are folded with (c | 0x20).
+// For a lower-case letter 'a'..'z', (c | 0x20) == letter only for the two cases of the letter, other characters must match exactly: same rules as ImToUpper().
+static inline int ImGuiTextFilterIndex_FoldMask(char c) { return (c >= 'a' && c <= 'z') ? 0x20 : 0; }
 
-void ImGuiTextBuffer::append(const char* str, const char* str_end)
+static bool ImGuiTextFilterIndex_MatchAt(const char* text, const char* needle, int needle_len)
 {
-    int len = str_end ? (int)(str_end - str) : (int)ImStrlen(str);
+    for (int i = 1; i < needle_len - 1; i++) // First and last characters are already tested
+        if ((text[i] | ImGuiTextFilterIndex_FoldMask(needle[i])) != needle[i])
+            return false;
+    return true;
+}
 
-    // Add zero-terminator the first time
-    const int write_off = (Buf.Size != 0) ? Buf.Size : 1;
-    const int needed_sz = write_off + len;
-    if (write_off + len >= Buf.Capacity)
-    {
-        int new_capacity = Buf.Capacity * 2;
-        Buf.reserve(needed_sz > new_capacity ? needed_sz : new_capacity);
+// Case-insensitive search of a lower-case needle. Candidate positions are found by testing the first and last characters of the needle.
+static bool ImGuiTextFilterIndex_Find(const char* text, const char* text_end, const char* needle, int needle_len)
+{
+    const int positions_count = (int)(text_end - text) - needle_len + 1;
+    const char c0 = needle[0];
+    const char c1 = needle[needle_len - 1];
+    const int m0 = ImGuiTextFilterIndex_FoldMask(c0);
+    const int m1 = ImGuiTextFilterIndex_FoldMask(c1);
+    int n = 0;
+#if defined(IMGUI_ENABLE_SSE) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+    // Test 16 positions at a time. The last block overlaps the previous one instead of testing remaining positions one by one.
+    if (positions_count >= 16)
+    {
+        const __m128i v0 = _mm_set1_epi8(c0), k0 = _mm_set1_epi8((char)m0);
+        const __m128i v1 = _mm_set1_epi8(c1), k1 = _mm_set1_epi8((char)m1);
+        for (;; n += 16)
+        {
+            if (n + 16 > positions_count)
+                n = positions_count - 16;
+            const __m128i a = _mm_or_si128(_mm_loadu_si128((const __m128i*)(text + n)), k0);
+            const __m128i b = _mm_or_si128(_mm_loadu_si128((const __m128i*)(text + n + needle_len - 1)), k1);
+            unsigned int mask = (unsigned int)_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(a, v0), _mm_cmpeq_epi8(b, v1)));
+            for (const char* p = text + n; mask != 0; p++, mask >>= 1)
+                if ((mask & 1) && ImGuiTextFilterIndex_MatchAt(p, needle, needle_len))
+                    return true;
+            if (n + 16 == positions_count)
+                return false;
+        }
     }
+#endif
+    for (; n < positions_count; n++)
+        if ((text[n] | m0) == c0 && (text[n + needle_len - 1] | m1) == c1 && ImGuiTextFilterIndex_MatchAt(text + n, needle, needle_len))
+            return true;
+    return false;
+}
 
-    Buf.resize(needed_sz);
-    memcpy(&Buf[write_off - 1], str, (size_t)len);
-    Buf[write_off - 1 + len] = 0;
+bool ImGuiTextFilterIndex::PassFilter(const char* text, const char* text_end) const
+{
+    // Same logic as ImGuiTextFilter::PassFilter(): the first term found decides.
+    for (const ImGuiTextFilterTerm& term : Terms)
+        if (ImGuiTextFilterIndex_Find(text, text_end, TermsBuf + term.Offset, term.Len))
+            return !term.Exclude;
+    return TermsIncludeCount == 0;
 }
 
-void ImGuiTextBuffer::appendf(const char* fmt, ...)
+void ImGuiTextFilterIndex::Clear()
 {
-    va_list args;
+    Matches.clear();
+    LinesCount = 0;
+}
+
+// Lines are tested by jobs of IMGUI_TEXT_FILTER_INDEX_JOB_LINES lines. Each job writes its matches in its own slice of TempMatches[].
+#define IMGUI_TEXT_FILTER_INDEX_JOB_LINES   8192
+
+struct ImGuiTextFilterIndexJobs
+{
+    const ImGuiTextFilterIndex* Index;
+    ImGuiTextFilterIndexGetLineFn GetLine;
+    void*               UserData;
+    const int*          Lines;              // Lines to test, or NULL to test lines [LinesBegin, LinesBegin + LinesCount)
+    int                 LinesBegin;
+    int                 LinesCount;
+    int*                OutMatches;
+    int*                OutCounts;
+};
+
+static void ImGuiTextFilterIndex_TestLinesJob(void* user_data, int job_n)
+{
+    ImGuiTextFilterIndexJobs* jobs = (ImGuiTextFilterIndexJobs*)user_data;
+    const int n_begin = job_n * IMGUI_TEXT_FILTER_INDEX_JOB_LINES;
+    const int n_end = ImMin(n_begin + IMGUI_TEXT_FILTER_INDEX_JOB_LINES, jobs->LinesCount);
+    int* out = jobs->OutMatches + n_begin;
+    int out_count = 0;
+    for (int n = n_begin; n < n_end; n++)
+    {
+        const int line_n = jobs->Lines ? jobs->Lines[n] : jobs->LinesBegin + n;
+        const char* line_end;
+        const char* line = jobs->GetLine(jobs->UserData, line_n, &line_end);
+        if (jobs->Index->PassFilter(line, line_end))
+            out[out_count++] = line_n;
+    }
+    jobs->OutCounts[job_n] = out_count;
+}
+
+// Test lines[] (or lines [lines_begin, lines_begin + lines_count) if lines == NULL). Output matches in TempMatches[], return their count.
+static int ImGuiTextFilterIndex_TestLines(ImGuiTextFilterIndex* index, const int* lines, int lines_begin, int lines_count, ImGuiTextFilterIndexGetLineFn get_line, void* user_data)
+{
+    const int jobs_count = (lines_count + IMGUI_TEXT_FILTER_INDEX_JOB_LINES - 1) / IMGUI_TEXT_FILTER_INDEX_JOB_LINES;
+    index->TempMatches.resize(lines_count);
+    index->TempCounts.resize(jobs_count);
+    ImGuiTextFilterIndexJobs jobs;
+    jobs.Index = index;
+    jobs.GetLine = get_line;
+    jobs.UserData = user_data;
+    jobs.Lines = lines;
+    jobs.LinesBegin = lines_begin;
+    jobs.LinesCount = lines_count;
+    jobs.OutMatches = index->TempMatches.Data;
+    jobs.OutCounts = index->TempCounts.Data;
+    ImParallelFor(jobs_count, ImGuiTextFilterIndex_TestLinesJob, &jobs);
+
+    // Compact slices
+    int matches_count = 0;
+    for (int job_n = 0; job_n < jobs_count; job_n++)
+    {
+        const int* src = index->TempMatches.Data + job_n * IMGUI_TEXT_FILTER_INDEX_JOB_LINES;
+        if (src != index->TempMatches.Data + matches_count)
+            memmove(index->TempMatches.Data + matches_count, src, (size_t)index->TempCounts[job_n] * sizeof(int));
+        matches_count += index->TempCounts[job_n];
+    }
+    return matches_count;
+}
+
+// New filter only accepts lines accepted by old filter when terms are in the same order with same kinds, and:
+// - included terms contain the old terms (e.g. "abc" -> "abcd"), excluded terms are contained in the old terms (e.g. "-abcd" -> "-abc").
+// - additional terms are exclusions, or old filter had no included term.
+static bool ImGuiTextFilterIndex_IsRefinement(const ImVector<ImGuiTextFilterIndex::ImGuiTextFilterTerm>& old_terms, const char* old_buf, int old_include_count, const ImVector<ImGuiTextFilterIndex::ImGuiTextFilterTerm>& new_terms, const char* new_buf)
+{
+    if (new_terms.Size < old_terms.Size)
+        return false;
+    for (int n = 0; n < new_terms.Size; n++)
+    {
+        const ImGuiTextFilterIndex::ImGuiTextFilterTerm& new_term = new_terms[n];
+        if (n >= old_terms.Size)
+        {
+            if (!new_term.Exclude && old_include_count > 0)
+                return false;
+            continue;
+        }
+        const ImGuiTextFilterIndex::ImGuiTextFilterTerm& old_term = old_terms[n];
+        if (new_term.Exclude != old_term.Exclude)
+            return false;
+        const ImGuiTextFilterIndex::ImGuiTextFilterTerm& outer = new_term.Exclude ? old_term : new_term;
+        const ImGuiTextFilterIndex::ImGuiTextFilterTerm& inner = new_term.Exclude ? new_term : old_term;
+        const char* outer_buf = new_term.Exclude ? old_buf : new_buf;
+        const char* inner_buf = new_term.Exclude ? new_buf : old_buf;
+        if (!ImGuiTextFilterIndex_Find(outer_buf + outer.Offset, outer_buf + outer.Offset + outer.Len, inner_buf + inner.Offset, inner.Len))
+            return false;
+    }
+    return true;
+}
+
+struct ImGuiTextFilterIndexOffsets
+{
+    const char*         Buf;
+    const int*          LineOffsets;
+};
+
+static const char* ImGuiTextFilterIndex_GetLineFromOffsets(void* user_data, int line_n, const char** out_line_end)
+{
+    ImGuiTextFilterIndexOffsets* data = (ImGuiTextFilterIndexOffsets*)user_data;
+    *out_line_end = data->Buf + data->LineOffsets[line_n + 1] - 1;
+    return data->Buf + data->LineOffsets[line_n];
+}
+
+void ImGuiTextFilterIndex::Update(const ImGuiTextFilter& filter, const char* buf, const int* line_offsets, int lines_count)
+{
+    ImGuiTextFilterIndexOffsets data;
+    data.Buf = buf;
+    data.LineOffsets = line_offsets;
+    Update(filter, lines_count, ImGuiTextFilterIndex_GetLineFromOffsets, &data);
+}
+
+void ImGuiTextFilterIndex::Update(const ImGuiTextFilter& filter, int lines_count, ImGuiTextFilterIndexGetLineFn get_line, void* user_data)
+{
+    // Compile filter when it changed
+    bool refine = false;
+    const bool filter_active = filter.IsActive();
+    if (filter_active != FilterActive || strcmp(filter.InputBuf, FilterText) != 0)
+    {
+        ImVector<ImGuiTextFilterTerm> old_terms;
+        old_terms.swap(Terms);
+        char old_buf[IM_ARRAYSIZE(TermsBuf)];
+        memcpy(old_buf, TermsBuf, sizeof(TermsBuf));
+        const int old_include_count = TermsIncludeCount;
+
+        IM_STATIC_ASSERT(sizeof(FilterText) == sizeof(filter.InputBuf));
+        memcpy(FilterText, filter.InputBuf, sizeof(FilterText));
+        FilterText[IM_ARRAYSIZE(FilterText) - 1] = 0;
+        for (int n = 0; n < IM_ARRAYSIZE(TermsBuf); n++)
+            TermsBuf[n] = (FilterText[n] >= 'A' && FilterText[n] <= 'Z') ? (char)(FilterText[n] | 0x20) : FilterText[n];
+        TermsIncludeCount = 0;
+        for (const ImGuiTextFilter::ImGuiTextRange& f : filter.Filters)
+        {
+            ImGuiTextFilterTerm term;
+            term.Exclude = (!f.empty() && f.b[0] == '-');
+            term.Offset = (int)(f.b - filter.InputBuf) + (term.Exclude ? 1 : 0);
+            term.Len = (int)(f.e - filter.InputBuf) - term.Offset;
+            if (term.Len <= 0) // Empty terms never match
+                continue;
+            Terms.push_back(term);
+            if (!term.Exclude)
+                TermsIncludeCount++;
+        }
+
+        refine = FilterActive && filter_active && ImGuiTextFilterIndex_IsRefinement(old_terms, old_buf, old_include_count, Terms, TermsBuf);
+        FilterActive = filter_active;
+        if (!refine)
+        {
+            Matches.resize(0);
+            LinesCount = 0;
+        }
+    }
+    if (!FilterActive)
+    {
+        LinesCount = lines_count;
+        return;
+    }
+    if (lines_count < LinesCount)
+    {
+        Matches.resize(0);
+        LinesCount = 0;
+        refine = false;
+    }
+
+    // Test lines which passed previous filter, then new lines
+    if (refine && Matches.Size > 0)
+    {
+        const int matches_count = ImGuiTextFilterIndex_TestLines(this, Matches.Data, 0, Matches.Size, get_line, user_data);
+        Matches.resize(matches_count);
+        if (matches_count > 0)
+            memcpy(Matches.Data, TempMatches.Data, (size_t)matches_count * sizeof(int));
+    }
+    if (lines_count > LinesCount)
+    {
+        const int matches_count = ImGuiTextFilterIndex_TestLines(this, NULL, LinesCount, lines_count - LinesCount, get_line, user_data);
+        if (matches_count > 0)
+        {
+            Matches.resize(Matches.Size + matches_count);
+            memcpy(Matches.Data + Matches.Size - matches_count, TempMatches.Data, (size_t)matches_count * sizeof(int));
+        }
+        LinesCount = lines_count;
+    }
+}
+
+//-----------------------------------------------------------------------------
+// [SECTION] ImGuiTextBuffer, ImGuiTextIndex, ImGuiTextWrapLayout, ImGuiTextLog, ImGuiTextFileView
+//-----------------------------------------------------------------------------
+
+char ImGuiTextBuffer::EmptyString[1] = { 0 };
+
+void ImGuiTextBuffer::append(const char* str, const char* str_end)
+{
+    int len = str_end ? (int)(str_end - str) : (int)ImStrlen(str);
+
+    // Add zero-terminator the first time
+    const int write_off = (Buf.Size != 0) ? Buf.Size : 1;
+    const int needed_sz = write_off + len;
+    if (write_off + len >= Buf.Capacity)
+    {
+        int new_capacity = Buf.Capacity * 2;
+        Buf.reserve(needed_sz > new_capacity ? needed_sz : new_capacity);
+    }
+
+    Buf.resize(needed_sz);
+    memcpy(&Buf[write_off - 1], str, (size_t)len);
+    Buf[write_off - 1 + len] = 0;
+}
+
+void ImGuiTextBuffer::appendf(const char* fmt, ...)
+{
+    va_list args;
     va_start(args, fmt);
     appendfv(fmt, args);
     va_end(args);
@@ -3025,27 +3885,770 @@ void ImGuiTextBuffer::appendfv(const char* fmt, va_list args)
     const int needed_sz = write_off + len;
     if (write_off + len >= Buf.Capacity)
     {
-        int new_capacity = Buf.Capacity * 2;
-        Buf.reserve(needed_sz > new_capacity ? needed_sz : new_capacity);
+        int new_capacity = Buf.Capacity * 2;
+        Buf.reserve(needed_sz > new_capacity ? needed_sz : new_capacity);
+    }
+
+    Buf.resize(needed_sz);
+    ImFormatStringV(&Buf[write_off - 1], (size_t)len + 1, fmt, args_copy);
+    va_end(args_copy);
+}
+
+void ImGuiTextIndex::append(const char* base, int old_size, int new_size)
+{
+    IM_ASSERT(old_size >= 0 && new_size >= old_size && new_size >= EndOffset);
+    if (old_size == new_size)
+        return;
+    if (EndOffset == 0 || base[EndOffset - 1] == '\n')
+        LineOffsets.push_back(EndOffset);
+    const char* base_end = base + new_size;
+    for (const char* p = base + old_size; (p = (const char*)ImMemchr(p, '\n', base_end - p)) != 0; )
+        if (++p < base_end) // Don't push a trailing offset on last \n
+            LineOffsets.push_back((int)(intptr_t)(p - base));
+    EndOffset = ImMax(EndOffset, new_size);
+}
+
+void ImGuiTextWrapLayout::Clear()
+{
+    LineOffsets.clear();
+    TextLen = 0;
+    DirtyBegin = INT_MAX;
+    DirtyEnd = 0;
+    Font = NULL;
+    FontSize = WrapWidth = 0.0f;
+    FontAtlasBuildCount = 0;
+}
+
+int ImGuiTextWrapLayout::FindLineIndex(int offset) const
+{
+    // Last line starting at or before 'offset'
+    int lo = 0, hi = LineOffsets.Size;
+    while (hi - lo > 1)
+    {
+        const int mid = (lo + hi) >> 1;
+        if (LineOffsets.Data[mid] <= offset)
+            lo = mid;
+        else
+            hi = mid;
+    }
+    return lo;
+}
+
+const char* ImGuiTextWrapLayout::GetLineEnd(const char* text, int line_n) const
+{
+    const char* line_begin = text + LineOffsets[line_n];
+    const char* line_end = text + (line_n + 1 < LineOffsets.Size ? LineOffsets[line_n + 1] : TextLen);
+    if (line_end > line_begin && line_end[-1] == '\n')
+        line_end--;
+    while (line_end > line_begin && (ImCharIsBlankA(line_end[-1]) || line_end[-1] == '\r'))
+        line_end--;
+    return line_end;
+}
+
+void ImGuiTextWrapLayout::NotifyEdit(int offset, int removed_len, int inserted_len)
+{
+    IM_ASSERT(offset >= 0 && removed_len >= 0 && inserted_len >= 0 && offset + removed_len <= TextLen);
+    const int delta = inserted_len - removed_len;
+
+    // Lines starting inside the removed range are gone. Lines after it are kept: Build() may reuse them.
+    int line_n = FindLineIndex(offset);
+    if (line_n < LineOffsets.Size && LineOffsets.Data[line_n] < offset)
+        line_n++;
+    int line_n_end = line_n;
+    while (line_n_end < LineOffsets.Size && LineOffsets.Data[line_n_end] < offset + removed_len)
+        line_n_end++;
+    if (line_n_end > line_n)
+        LineOffsets.erase(LineOffsets.Data + line_n, LineOffsets.Data + line_n_end);
+    for (int n = line_n; n < LineOffsets.Size; n++)
+        LineOffsets.Data[n] += delta;
+    if (LineOffsets.Size > 0 && LineOffsets.Data[0] != 0)
+        LineOffsets.push_front(0);
+
+    DirtyBegin = ImMin(DirtyBegin, offset);
+    DirtyEnd = (DirtyEnd >= offset + removed_len) ? DirtyEnd + delta : offset + inserted_len;
+    DirtyEnd = ImMax(DirtyEnd, offset + inserted_len);
+    TextLen += delta;
+}
+
+// This emulates the line breaking loop of ImFont::RenderText() and ImFont::CalcTextSizeA(), except that we always restart wrapping
+// after a line return (they may output an extra empty line when the first character of a paragraph is wider than wrap_width).
+// Wrapping a line only depends on text after its beginning, so once we produce a line beginning after the modified range that
+// was already known, the rest of the lines are unchanged.
+void ImGuiTextWrapLayout::Build(ImFont* font, float font_size, float wrap_width, const char* text, const char* text_end)
+{
+    if (text_end == NULL)
+        text_end = text + ImStrlen(text);
+    const int text_len = (int)(text_end - text);
+    const int font_atlas_build_count = font->ContainerAtlas ? font->ContainerAtlas->BuildCount : 0;
+    if (Font != font || FontSize != font_size || WrapWidth != wrap_width || FontAtlasBuildCount != font_atlas_build_count || text_len < TextLen)
+    {
+        LineOffsets.resize(0);
+        DirtyBegin = 0;
+        DirtyEnd = text_len;
+        Font = font;
+        FontSize = font_size;
+        WrapWidth = wrap_width;
+        FontAtlasBuildCount = font_atlas_build_count;
+    }
+    else if (text_len > TextLen)
+    {
+        // Text was appended
+        DirtyBegin = ImMin(DirtyBegin, TextLen);
+        DirtyEnd = text_len;
+    }
+    TextLen = text_len;
+    if (DirtyBegin > DirtyEnd)
+        return;
+    const int dirty_begin = DirtyBegin;
+    const int dirty_end = DirtyEnd;
+    DirtyBegin = INT_MAX;
+    DirtyEnd = 0;
+    if (text_len == 0)
+    {
+        LineOffsets.resize(0);
+        return;
+    }
+    if (LineOffsets.Size == 0)
+        LineOffsets.push_back(0);
+
+    // Wrapping a line depends on text up to where it overflows, which may be a few lines further (e.g. short lines followed
+    // by a word which is too long to fit in one line). Move back to a line starting a paragraph, or starting before the modified
+    // text with a previous line overflowing before the modified text (lines before that one overflow even earlier).
+    int restart_n = FindLineIndex(dirty_begin);
+    if (dirty_begin == 0 || text[dirty_begin - 1] != '\n')
+        while (restart_n > 0 && text[LineOffsets[restart_n] - 1] != '\n')
+        {
+            if (LineOffsets[restart_n] < dirty_begin)
+            {
+                const char* prev_line_begin = text + LineOffsets[restart_n - 1];
+                const char* p = text + dirty_begin;
+                while (p > prev_line_begin && (ImCharIsBlankA(p[-1]) || p[-1] == '\r')) // Trailing blanks are not counted
+                    p--;
+                if (font->CalcTextSizeA(font_size, FLT_MAX, 0.0f, prev_line_begin, p).x > wrap_width + 1.0f)
+                    break;
+            }
+            restart_n--;
+        }
+    int reuse_n = restart_n + 1;
+    ImVector<int> new_offsets;
+
+    const float scale = font_size / font->FontSize;
+    const char* s = text + LineOffsets[restart_n];
+    bool resync = false;
+    while (s < text_end && !resync)
+    {
+        const char* word_wrap_eol = font->CalcWordWrapPositionA(scale, s, text_end, wrap_width);
+        if (word_wrap_eol == s + 1 && (unsigned char)*s >= 0x80)
+        {
+            // Forced 1 character: always display it whole.
+            unsigned int c;
+            word_wrap_eol = s + ImTextCharFromUtf8(&c, s, text_end);
+        }
+
+        // Line returns before the wrapping point, then the wrapping point itself
+        while (!resync)
+        {
+            const char* line_return = (const char*)ImMemchr(s, '\n', word_wrap_eol - s);
+            if (line_return != NULL)
+            {
+                s = line_return + 1;
+            }
+            else
+            {
+                s = word_wrap_eol;
+                if (s >= text_end)
+                    break;
+                while (s < text_end && ImCharIsBlankA(*s))
+                    s++;
+                if (s < text_end && *s == '\n')
+                    s++;
+            }
+            if (s >= text_end)
+                break;
+
+            const int line_offset = (int)(s - text);
+            while (reuse_n < LineOffsets.Size && LineOffsets.Data[reuse_n] < line_offset)
+                reuse_n++;
+            if (line_offset >= dirty_end && reuse_n < LineOffsets.Size && LineOffsets.Data[reuse_n] == line_offset)
+                resync = true;
+            else
+                new_offsets.push_back(line_offset);
+            if (line_return == NULL || s == word_wrap_eol)
+                break;
+        }
+    }
+    if (!resync)
+        reuse_n = LineOffsets.Size;
+
+    // Replace lines [restart_n + 1, reuse_n) with new ones.
+    const int reuse_count = LineOffsets.Size - reuse_n;
+    const int new_size = restart_n + 1 + new_offsets.Size + reuse_count;
+    if (new_size > LineOffsets.Size)
+        LineOffsets.resize(new_size);
+    memmove(LineOffsets.Data + restart_n + 1 + new_offsets.Size, LineOffsets.Data + reuse_n, (size_t)reuse_count * sizeof(int));
+    if (new_offsets.Size > 0)
+        memcpy(LineOffsets.Data + restart_n + 1, new_offsets.Data, (size_t)new_offsets.Size * sizeof(int));
+    LineOffsets.resize(new_size);
+}
+
+// Lock-free bounded queue with multiple producers and a single consumer, storing records of variable size in cells of fixed size.
+// (derived from Dmitry Vyukov's bounded MPMC queue: the sequence number of each cell tells whether it is free or published)
+// - A producer reserves consecutive cells with a CAS on EnqueuePos, after checking that the last one is free: cells are
+//   released in order by the consumer, so all previous ones are free too. It then publishes the record by updating the
+//   sequence number of the first cell. If the cells are not free the queue is full and the record is dropped (we never block).
+// - Data of a record is contiguous: Data[] has room for a maximum size record after the last cell.
+#define IMGUI_TEXT_LOG_QUEUE_CELL_SIZE      64
+#define IMGUI_TEXT_LOG_QUEUE_RECORD_MAX     (4096 - 4)  // Maximum size of text in a record (preceded by its size as an int)
+
+struct ImGuiTextLogQueue
+{
+    std::atomic<ImU32>  EnqueuePos;
+    char                Padding[64];        // Keep consumer data out of the cache line modified by producers
+    ImU32               DequeuePos;         // Only accessed by consumer
+    ImU32               CellsMask;
+    std::atomic<ImU32>* Sequences;          // Sequence number of each cell: == position when free, == position + 1 when published
+    char*               Data;
+    std::atomic<int>    DroppedCount;
+
+    ImGuiTextLogQueue(int cells_count)
+    {
+        IM_ASSERT(ImIsPowerOfTwo(cells_count));
+        EnqueuePos = 0;
+        DequeuePos = 0;
+        CellsMask = (ImU32)cells_count - 1;
+        Sequences = (std::atomic<ImU32>*)IM_ALLOC(sizeof(std::atomic<ImU32>) * (size_t)cells_count);
+        for (int n = 0; n < cells_count; n++)
+            IM_PLACEMENT_NEW(&Sequences[n]) std::atomic<ImU32>((ImU32)n);
+        Data = (char*)IM_ALLOC((size_t)cells_count * IMGUI_TEXT_LOG_QUEUE_CELL_SIZE + 4 + IMGUI_TEXT_LOG_QUEUE_RECORD_MAX);
+        DroppedCount = 0;
+    }
+    ~ImGuiTextLogQueue()
+    {
+        IM_FREE(Sequences);
+        IM_FREE(Data);
+    }
+
+    // Producer: push text of a record, followed by a '\n' if 'add_new_line' is set
+    bool Push(const char* text, int len, bool add_new_line)
+    {
+        const int record_len = len + (add_new_line ? 1 : 0);
+        IM_ASSERT(record_len <= IMGUI_TEXT_LOG_QUEUE_RECORD_MAX);
+        const ImU32 cells_needed = (ImU32)((4 + record_len + IMGUI_TEXT_LOG_QUEUE_CELL_SIZE - 1) / IMGUI_TEXT_LOG_QUEUE_CELL_SIZE);
+        ImU32 pos = EnqueuePos.load(std::memory_order_relaxed);
+        while (true)
+        {
+            const ImU32 last_pos = pos + cells_needed - 1;
+            const ImS32 diff = (ImS32)(Sequences[last_pos & CellsMask].load(std::memory_order_acquire) - last_pos);
+            if (diff == 0)
+            {
+                if (EnqueuePos.compare_exchange_weak(pos, pos + cells_needed, std::memory_order_relaxed))
+                    break;
+            }
+            else if (diff < 0)
+            {
+                DroppedCount.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+            else
+            {
+                pos = EnqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+        char* dst = Data + (size_t)(pos & CellsMask) * IMGUI_TEXT_LOG_QUEUE_CELL_SIZE;
+        memcpy(dst, &record_len, 4);
+        memcpy(dst + 4, text, (size_t)len);
+        if (add_new_line)
+            dst[4 + len] = '\n';
+        Sequences[pos & CellsMask].store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer: return next published record, or NULL. Call PopRelease() when done with it.
+    const char* PopAcquire(int* out_len)
+    {
+        if (Sequences[DequeuePos & CellsMask].load(std::memory_order_acquire) != DequeuePos + 1)
+            return NULL;
+        const char* src = Data + (size_t)(DequeuePos & CellsMask) * IMGUI_TEXT_LOG_QUEUE_CELL_SIZE;
+        memcpy(out_len, src, 4);
+        return src + 4;
+    }
+    void PopRelease(int len)
+    {
+        const ImU32 cells_count = CellsMask + 1;
+        const ImU32 cells_used = (ImU32)((4 + len + IMGUI_TEXT_LOG_QUEUE_CELL_SIZE - 1) / IMGUI_TEXT_LOG_QUEUE_CELL_SIZE);
+        for (ImU32 n = 0; n < cells_used; n++)
+            Sequences[(DequeuePos + n) & CellsMask].store(DequeuePos + n + cells_count, std::memory_order_release);
+        DequeuePos += cells_used;
+    }
+};
+
+void ImGuiTextLog::Init(size_t max_size, size_t queue_size, int chunk_size)
+{
+    Shutdown();
+    IM_ASSERT(chunk_size >= 16);
+    ChunkSize = chunk_size & ~(int)(sizeof(int) - 1); // Line offsets are stored at the end of chunks
+    Chunks.resize(ImMax((int)(max_size / (size_t)chunk_size), 2), NULL); // We need 2 chunks to move a line to a new chunk
+    int cells_count = 64;
+    while ((size_t)cells_count * IMGUI_TEXT_LOG_QUEUE_CELL_SIZE < queue_size)
+        cells_count *= 2;
+    Queue = IM_NEW(ImGuiTextLogQueue)(cells_count);
+}
+
+void ImGuiTextLog::Shutdown()
+{
+    for (ImGuiTextLogChunk* chunk : Chunks)
+        if (chunk != NULL)
+        {
+            IM_FREE(chunk->Data);
+            IM_DELETE(chunk);
+        }
+    Chunks.clear();
+    if (Queue != NULL)
+        IM_DELETE(Queue);
+    Queue = NULL;
+    Clear();
+}
+
+void ImGuiTextLog::Clear()
+{
+    ChunksHead = ChunksCount = 0;
+    LookupSlot = 0;
+    LinesEvicted = LinesTotal = 0;
+    LastLineOpen = false;
+    FilteredLines.resize(0);
+    FilteredHead = 0;
+    FilterNextLine = 0;
+}
+
+// Space left for text and line offsets in a chunk
+static inline int TextLogChunkAvail(const ImGuiTextLog* log, const ImGuiTextLogChunk* chunk)
+{
+    return log->ChunkSize - chunk->Size - chunk->LinesCount * (int)sizeof(int);
+}
+
+// Add a chunk at the end, evicting the oldest one if all chunks are used
+static ImGuiTextLogChunk* TextLogAddChunk(ImGuiTextLog* log)
+{
+    if (log->ChunksCount == log->Chunks.Size)
+    {
+        log->LinesEvicted += log->Chunks[log->ChunksHead]->LinesCount;
+        log->ChunksHead = (log->ChunksHead + 1) % log->Chunks.Size;
+        log->ChunksCount--;
+    }
+    ImGuiTextLogChunk*& chunk = log->Chunks[(log->ChunksHead + log->ChunksCount) % log->Chunks.Size];
+    if (chunk == NULL)
+    {
+        chunk = IM_NEW(ImGuiTextLogChunk)();
+        chunk->Data = (char*)IM_ALLOC((size_t)log->ChunkSize);
+        chunk->LineOffsetsEnd = (int*)(void*)(chunk->Data + log->ChunkSize);
+    }
+    chunk->Size = 0;
+    chunk->LinesCount = 0;
+    chunk->FirstLine = log->LinesTotal;
+    log->ChunksCount++;
+    return chunk;
+}
+
+void ImGuiTextLog::Append(const char* text, const char* text_end)
+{
+    if (Chunks.Size == 0)
+        Init();
+    if (text_end == NULL)
+        text_end = text + ImStrlen(text);
+    while (text < text_end)
+    {
+        const char* new_line = (const char*)ImMemchr(text, '\n', (size_t)(text_end - text));
+        const char* segment_end = new_line ? new_line + 1 : text_end;
+        ImGuiTextLogChunk* chunk = ChunksCount > 0 ? Chunks[(ChunksHead + ChunksCount - 1) % Chunks.Size] : NULL;
+        if (!LastLineOpen)
+        {
+            if (chunk == NULL || TextLogChunkAvail(this, chunk) <= (int)sizeof(int))
+                chunk = TextLogAddChunk(this);
+            chunk->LineOffsetsEnd[-1 - chunk->LinesCount++] = chunk->Size;
+            LinesTotal++;
+            LastLineOpen = true;
+        }
+
+        const int len = (int)(segment_end - text);
+        if (len > TextLogChunkAvail(this, chunk))
+        {
+            // Move current line to a new chunk
+            const int line_offset = chunk->GetLineOffset(chunk->LinesCount - 1);
+            if (line_offset > 0)
+            {
+                ImGuiTextLogChunk* prev_chunk = chunk;
+                prev_chunk->LinesCount--;
+                LinesTotal--;
+                chunk = TextLogAddChunk(this);
+                chunk->Size = prev_chunk->Size - line_offset;
+                memcpy(chunk->Data, prev_chunk->Data + line_offset, (size_t)chunk->Size);
+                chunk->LineOffsetsEnd[-1 - chunk->LinesCount++] = 0;
+                LinesTotal++;
+                prev_chunk->Size = line_offset;
+            }
+        }
+        const int avail = TextLogChunkAvail(this, chunk);
+        if (len <= avail)
+        {
+            memcpy(chunk->Data + chunk->Size, text, (size_t)len);
+            chunk->Size += len;
+        }
+        else
+        {
+            // Line doesn't fit in a chunk: truncate it, keeping its '\n'
+            memcpy(chunk->Data + chunk->Size, text, (size_t)avail);
+            chunk->Size += avail;
+            if (new_line != NULL)
+                chunk->Data[chunk->Size - 1] = '\n';
+        }
+        if (new_line != NULL)
+            LastLineOpen = false;
+        text = segment_end;
+    }
+}
+
+void ImGuiTextLog::Appendf(const char* fmt, ...)
+{
+    va_list args;
+    va_start(args, fmt);
+    va_list args_copy;
+    va_copy(args_copy, args);
+    char buf[1024];
+    const int len = ImFormatStringV(buf, IM_ARRAYSIZE(buf), fmt, args);
+    if (len < IM_ARRAYSIZE(buf) - 1)
+    {
+        Append(buf, buf + len);
+    }
+    else
+    {
+        ImGuiTextBuffer large_buf; // Possibly truncated: format again into a buffer of the right size
+        large_buf.appendfv(fmt, args_copy);
+        Append(large_buf.begin(), large_buf.end());
+    }
+    va_end(args_copy);
+    va_end(args);
+}
+
+// Text is split in records made of whole lines when possible: only lines longer than a record may be split and interleaved with other threads' lines.
+bool ImGuiTextLog::AppendThreadSafe(const char* text, const char* text_end)
+{
+    IM_ASSERT(Queue != NULL && "Call Init() before AppendThreadSafe()");
+    if (text_end == NULL)
+        text_end = text + ImStrlen(text);
+    bool ret = true;
+    while (text < text_end)
+    {
+        const char* record_end = text + ImMin((int)(text_end - text), IMGUI_TEXT_LOG_QUEUE_RECORD_MAX);
+        if (record_end < text_end)
+        {
+            for (const char* p = record_end; p > text; p--)
+                if (p[-1] == '\n')
+                {
+                    record_end = p;
+                    break;
+                }
+        }
+        else if (record_end[-1] != '\n' && record_end - text == IMGUI_TEXT_LOG_QUEUE_RECORD_MAX)
+        {
+            record_end--; // Make room for the '\n'
+        }
+        const bool add_new_line = (record_end == text_end && record_end[-1] != '\n');
+        ret &= Queue->Push(text, (int)(record_end - text), add_new_line);
+        text = record_end;
+    }
+    return ret;
+}
+
+bool ImGuiTextLog::AppendfThreadSafe(const char* fmt, ...)
+{
+    char buf[IMGUI_TEXT_LOG_QUEUE_RECORD_MAX];
+    va_list args;
+    va_start(args, fmt);
+    const int len = ImFormatStringV(buf, IM_ARRAYSIZE(buf), fmt, args);
+    va_end(args);
+    return AppendThreadSafe(buf, buf + len);
+}
+
+void ImGuiTextLog::Drain()
+{
+    if (Chunks.Size == 0)
+        Init();
+    int len = 0;
+    while (const char* text = Queue->PopAcquire(&len))
+    {
+        Append(text, text + len);
+        Queue->PopRelease(len);
+    }
+    DroppedCount += Queue->DroppedCount.exchange(0, std::memory_order_relaxed);
+}
+
+// Find the chunk holding a line. Sequential accesses (e.g. from ImGuiListClipper) don't need to search.
+static ImGuiTextLogChunk* TextLogFindChunk(ImGuiTextLog* log, int line_n, int* out_line_in_chunk, bool* out_is_last_chunk)
+{
+    IM_ASSERT(line_n >= 0 && line_n < log->GetLinesCount());
+    const ImS64 line_abs = log->LinesEvicted + line_n;
+    const int slots_count = log->Chunks.Size;
+    int chunk_n = (log->LookupSlot - log->ChunksHead + slots_count) % slots_count;
+    if (chunk_n >= log->ChunksCount)
+        chunk_n = 0;
+    ImGuiTextLogChunk* chunk = log->Chunks[(log->ChunksHead + chunk_n) % slots_count];
+    if (line_abs < chunk->FirstLine || line_abs >= chunk->FirstLine + chunk->LinesCount)
+    {
+        ImGuiTextLogChunk* next_chunk = (chunk_n + 1 < log->ChunksCount) ? log->Chunks[(log->ChunksHead + chunk_n + 1) % slots_count] : NULL;
+        if (next_chunk && line_abs >= next_chunk->FirstLine && line_abs < next_chunk->FirstLine + next_chunk->LinesCount)
+        {
+            chunk_n++;
+        }
+        else
+        {
+            // Binary search last chunk with FirstLine <= line_abs
+            int lo = 0, hi = log->ChunksCount - 1;
+            while (lo < hi)
+            {
+                const int mid = (lo + hi + 1) / 2;
+                if (log->Chunks[(log->ChunksHead + mid) % slots_count]->FirstLine <= line_abs)
+                    lo = mid;
+                else
+                    hi = mid - 1;
+            }
+            chunk_n = lo;
+        }
+        chunk = log->Chunks[(log->ChunksHead + chunk_n) % slots_count];
+    }
+    log->LookupSlot = (log->ChunksHead + chunk_n) % slots_count;
+    *out_line_in_chunk = (int)(line_abs - chunk->FirstLine);
+    *out_is_last_chunk = (chunk_n == log->ChunksCount - 1);
+    return chunk;
+}
+
+const char* ImGuiTextLog::GetLineBegin(int line_n)
+{
+    int line_in_chunk;
+    bool is_last_chunk;
+    ImGuiTextLogChunk* chunk = TextLogFindChunk(this, line_n, &line_in_chunk, &is_last_chunk);
+    return chunk->Data + chunk->GetLineOffset(line_in_chunk);
+}
+
+const char* ImGuiTextLog::GetLineEnd(int line_n)
+{
+    int line_in_chunk;
+    bool is_last_chunk;
+    ImGuiTextLogChunk* chunk = TextLogFindChunk(this, line_n, &line_in_chunk, &is_last_chunk);
+    if (line_in_chunk + 1 < chunk->LinesCount)
+        return chunk->Data + chunk->GetLineOffset(line_in_chunk + 1) - 1;
+    return chunk->Data + chunk->Size - ((is_last_chunk && LastLineOpen) ? 0 : 1); // Exclude '\n'
+}
+
+void ImGuiTextLog::UpdateFilter(const ImGuiTextFilter& filter)
+{
+    const bool filter_active = filter.IsActive();
+    if (filter_active != FilterActive || strcmp(filter.InputBuf, FilterText) != 0)
+    {
+        FilterActive = filter_active;
+        IM_STATIC_ASSERT(sizeof(FilterText) == sizeof(filter.InputBuf));
+        memcpy(FilterText, filter.InputBuf, sizeof(FilterText));
+        FilterText[IM_ARRAYSIZE(FilterText) - 1] = 0;
+        FilteredLines.resize(0);
+        FilteredHead = 0;
+        FilterNextLine = LinesEvicted;
+    }
+    if (!FilterActive)
+        return;
+
+    // Forget evicted lines. Compact when half of the storage is unused (amortized O(1) per line).
+    while (FilteredHead < FilteredLines.Size && FilteredLines[FilteredHead] < LinesEvicted)
+        FilteredHead++;
+    if (FilteredHead > 0 && FilteredHead * 2 >= FilteredLines.Size)
+    {
+        FilteredLines.erase(FilteredLines.Data, FilteredLines.Data + FilteredHead);
+        FilteredHead = 0;
+    }
+
+    // Test new lines (last line is only tested once complete)
+    const ImS64 lines_end = LinesTotal - (LastLineOpen ? 1 : 0);
+    for (ImS64 line_abs = ImMax(FilterNextLine, LinesEvicted); line_abs < lines_end; line_abs++)
+    {
+        const int line_n = (int)(line_abs - LinesEvicted);
+        if (filter.PassFilter(GetLineBegin(line_n), GetLineEnd(line_n)))
+            FilteredLines.push_back(line_abs);
+    }
+    FilterNextLine = ImMax(FilterNextLine, lines_end);
+}
+
+// Count '\n' in a range. With SSE2, matches of 16 bytes at a time are accumulated in 8-bit lanes, which are summed every 255 iterations.
+static ImS64 TextFileViewCountNewlines(const char* p, const char* p_end)
+{
+    ImS64 count = 0;
+#if defined(IMGUI_ENABLE_SSE) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+    const __m128i newline = _mm_set1_epi8('\n');
+    const __m128i zero = _mm_setzero_si128();
+    while (p_end - p >= 16)
+    {
+        const int iterations = (int)ImMin((ImS64)((p_end - p) / 16), (ImS64)255);
+        __m128i acc = zero;
+        for (int n = 0; n < iterations; n++, p += 16)
+            acc = _mm_sub_epi8(acc, _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)p), newline));
+        const __m128i sums = _mm_sad_epu8(acc, zero);
+        count += _mm_cvtsi128_si32(sums) + _mm_cvtsi128_si32(_mm_srli_si128(sums, 8));
+    }
+#endif
+    for (; p < p_end; p++)
+        if (*p == '\n')
+            count++;
+    return count;
+}
+
+// Owns the file mapping and the index. Fields other than BlocksIndexed are not modified while the indexing thread is running.
+struct ImGuiTextFileViewIndexer
+{
+    ImFileMapping       Mapping;
+    int                 Granularity;
+    int                 BlocksCount;
+    ImVector<ImS64>     LinesBefore;        // Number of '\n' before each block (BlocksCount + 1 entries). Valid up to LinesBefore[BlocksIndexed].
+    std::atomic<int>    BlocksIndexed;
+    std::atomic<bool>   Quit;
+#ifdef IMGUI_ENABLE_THREADS
+    std::thread         Thread;
+#endif
+};
+
+// Called by the indexing thread, or by ImGuiTextFileView::Update() without IMGUI_ENABLE_THREADS.
+static void TextFileViewIndexBlocks(ImGuiTextFileViewIndexer* indexer, int blocks_end)
+{
+    const char* data = (const char*)indexer->Mapping.Data;
+    for (int block_n = indexer->BlocksIndexed.load(std::memory_order_relaxed); block_n < blocks_end && !indexer->Quit.load(std::memory_order_relaxed); block_n++)
+    {
+        const ImU64 block_offset = (ImU64)block_n * (ImU64)indexer->Granularity;
+        const ImU64 block_size = ImMin((ImU64)indexer->Granularity, indexer->Mapping.Size - block_offset);
+        indexer->LinesBefore[block_n + 1] = indexer->LinesBefore[block_n] + TextFileViewCountNewlines(data + block_offset, data + block_offset + block_size);
+        indexer->BlocksIndexed.store(block_n + 1, std::memory_order_release);
+    }
+}
+
+#ifdef IMGUI_ENABLE_THREADS
+static void TextFileViewIndexerThreadMain(ImGuiTextFileViewIndexer* indexer)
+{
+    TextFileViewIndexBlocks(indexer, indexer->BlocksCount);
+}
+#endif
+
+bool ImGuiTextFileView::Open(const char* filename, int index_granularity)
+{
+    IM_ASSERT(index_granularity >= 1024);
+    Close();
+    ImFileMapping mapping;
+    if (!ImFileMapToMemory(filename, &mapping))
+        return false;
+
+    ImGuiTextFileViewIndexer* indexer = IM_NEW(ImGuiTextFileViewIndexer)();
+    indexer->Mapping = mapping;
+    indexer->Granularity = index_granularity;
+    indexer->BlocksCount = (int)((mapping.Size + (ImU64)index_granularity - 1) / (ImU64)index_granularity);
+    indexer->LinesBefore.resize(indexer->BlocksCount + 1);
+    indexer->LinesBefore[0] = 0;
+    indexer->BlocksIndexed = 0;
+    indexer->Quit = false;
+    Indexer = indexer;
+    Data = (const char*)mapping.Data;
+    Size = mapping.Size;
+    IndexGranularity = index_granularity;
+    BlocksCount = indexer->BlocksCount;
+#ifdef IMGUI_ENABLE_THREADS
+    if (indexer->BlocksCount > 0)
+        indexer->Thread = std::thread(TextFileViewIndexerThreadMain, indexer);
+#endif
+    return true;
+}
+
+void ImGuiTextFileView::Close()
+{
+    if (ImGuiTextFileViewIndexer* indexer = Indexer)
+    {
+        indexer->Quit = true;
+#ifdef IMGUI_ENABLE_THREADS
+        if (indexer->Thread.joinable())
+            indexer->Thread.join();
+#endif
+        ImFileUnmap(&indexer->Mapping);
+        IM_DELETE(indexer);
+        Indexer = NULL;
+    }
+    Data = NULL;
+    Size = 0;
+    BlocksCount = BlocksIndexed = 0;
+    LinesCount = ScrollLine = 0;
+    ScrollLineRemainder = 0.0f;
+    HoveredLine = -1;
+    MaxLineWidth = 0.0f;
+    LookupLine = 0;
+    LookupOffset = 0;
+    VisibleLines.clear();
+    TempLines.clear();
+}
+
+void ImGuiTextFileView::Update()
+{
+    ImGuiTextFileViewIndexer* indexer = Indexer;
+    if (indexer == NULL)
+        return;
+#ifndef IMGUI_ENABLE_THREADS
+    // Index on the calling thread, for up to 2 ms per call
+    const double time_end = ImTimeGetSeconds() + 0.002;
+    while (indexer->BlocksIndexed < indexer->BlocksCount && ImTimeGetSeconds() < time_end)
+        TextFileViewIndexBlocks(indexer, ImMin(indexer->BlocksIndexed + 16, indexer->BlocksCount));
+#endif
+    BlocksIndexed = indexer->BlocksIndexed.load(std::memory_order_acquire);
+    LinesCount = indexer->LinesBefore[BlocksIndexed];
+    if (BlocksIndexed == BlocksCount && Size > 0 && Data[Size - 1] != '\n')
+        LinesCount++; // Last line without '\n'
+}
+
+// Return position following the line_n-th '\n', which must have been indexed.
+static const char* TextFileViewFindLine(ImGuiTextFileView* view, ImS64 line_n)
+{
+    if (line_n == 0)
+        return view->Data;
+    const ImS64* lines_before = view->Indexer->LinesBefore.Data;
+    IM_ASSERT(line_n <= lines_before[view->BlocksIndexed]);
+
+    // Find block containing the line_n-th '\n', scan it from its beginning, or from last line found if it is further in the block.
+    int block_end = 1, block_end_max = view->BlocksIndexed; // Find first block_end where lines_before[block_end] >= line_n
+    while (block_end < block_end_max)
+    {
+        const int mid = block_end + (block_end_max - block_end) / 2;
+        if (lines_before[mid] >= line_n)
+            block_end_max = mid;
+        else
+            block_end = mid + 1;
     }
+    ImU64 offset = (ImU64)(block_end - 1) * (ImU64)view->IndexGranularity;
+    ImS64 lines_to_skip = line_n - lines_before[block_end - 1];
+    if (view->LookupLine <= line_n && view->LookupOffset >= offset)
+    {
+        offset = view->LookupOffset;
+        lines_to_skip = line_n - view->LookupLine;
+    }
+    const char* p = view->Data + offset;
+    const char* data_end = view->Data + view->Size;
+    for (; lines_to_skip > 0; lines_to_skip--)
+        p = (const char*)memchr(p, '\n', (size_t)(data_end - p)) + 1;
+    view->LookupLine = line_n;
+    view->LookupOffset = (ImU64)(p - view->Data);
+    return p;
+}
 
-    Buf.resize(needed_sz);
-    ImFormatStringV(&Buf[write_off - 1], (size_t)len + 1, fmt, args_copy);
-    va_end(args_copy);
+const char* ImGuiTextFileView::GetLineBegin(ImS64 line_n)
+{
+    IM_ASSERT(line_n >= 0 && line_n < LinesCount);
+    return TextFileViewFindLine(this, line_n);
 }
 
-void ImGuiTextIndex::append(const char* base, int old_size, int new_size)
+const char* ImGuiTextFileView::GetLineEnd(ImS64 line_n)
 {
-    IM_ASSERT(old_size >= 0 && new_size >= old_size && new_size >= EndOffset);
-    if (old_size == new_size)
-        return;
-    if (EndOffset == 0 || base[EndOffset - 1] == '\n')
-        LineOffsets.push_back(EndOffset);
-    const char* base_end = base + new_size;
-    for (const char* p = base + old_size; (p = (const char*)ImMemchr(p, '\n', base_end - p)) != 0; )
-        if (++p < base_end) // Don't push a trailing offset on last \n
-            LineOffsets.push_back((int)(intptr_t)(p - base));
-    EndOffset = ImMax(EndOffset, new_size);
+    IM_ASSERT(line_n >= 0 && line_n < LinesCount);
+    if (line_n + 1 <= Indexer->LinesBefore[BlocksIndexed])
+        return TextFileViewFindLine(this, line_n + 1) - 1;
+    return Data + Size; // Last line without '\n'
 }
 
 //-----------------------------------------------------------------------------
@@ -3135,6 +4738,7 @@ void ImGuiListClipper::Begin(int items_count, float items_height)
     StartPosY = window->DC.CursorPos.y;
     ItemsHeight = items_height;
     ItemsCount = items_count;
+    HeightIndex = NULL;
     DisplayStart = -1;
     DisplayEnd = 0;
 
@@ -3148,6 +4752,16 @@ void ImGuiListClipper::Begin(int items_count, float items_height)
     StartSeekOffsetY = data->LossynessOffset;
 }
 
+void ImGuiListClipper::Begin(int items_count, ImGuiListClipperHeightIndex* height_index)
+{
+    IM_ASSERT(items_count >= 0 && items_count < INT_MAX && "Items count must be known in advance when using a ImGuiListClipperHeightIndex.");
+    if (height_index->DefaultHeight <= 0.0f)
+        height_index->DefaultHeight = ImGui::GetTextLineHeightWithSpacing();
+    height_index->Resize(items_count);
+    Begin(items_count, height_index->DefaultHeight);
+    HeightIndex = height_index;
+}
+
 void ImGuiListClipper::End()
 {
     if (ImGuiListClipperData* data = (ImGuiListClipperData*)TempData)
@@ -3187,6 +4801,13 @@ void ImGuiListClipper::SeekCursorForItem(int item_n)
     // - Perform the add and multiply with double to allow seeking through larger ranges.
     // - StartPosY starts from ItemsFrozen, by adding SeekOffsetY we generally cancel that out (SeekOffsetY == LossynessOffset - ItemsFrozen * ItemsHeight).
     // - The reason we store SeekOffsetY instead of inferring it, is because we want to allow user to perform Seek after the last step, where ImGuiListClipperData is already done.
+    // - With a ImGuiListClipperHeightIndex, the offset of the item is the sum of heights of all items before it.
+    if (HeightIndex != NULL)
+    {
+        float pos_y = (float)((double)StartPosY + StartSeekOffsetY + HeightIndex->GetOffset(item_n));
+        ImGuiListClipper_SeekCursorAndSetupPrevLine(pos_y, (item_n > 0 && item_n <= HeightIndex->Heights.Size) ? HeightIndex->Heights[item_n - 1] : ItemsHeight);
+        return;
+    }
     float pos_y = (float)((double)StartPosY + StartSeekOffsetY + (double)item_n * ItemsHeight);
     ImGuiListClipper_SeekCursorAndSetupPrevLine(pos_y, ItemsHeight);
 }
@@ -3202,6 +4823,16 @@ static bool ImGuiListClipper_StepInternal(ImGuiListClipper* clipper)
     if (table && table->IsInsideRow)
         ImGui::TableEndRow(table);
 
+    // Measure item displayed by previous step
+    ImGuiListClipperHeightIndex* height_index = clipper->HeightIndex;
+    if (height_index != NULL && data->MeasureItemIdx >= 0)
+    {
+        const float item_height = window->DC.CursorPos.y - data->MeasurePosY;
+        if (item_height > 0.0f)
+            height_index->SetHeight(data->MeasureItemIdx, item_height);
+        data->MeasureItemIdx = -1;
+    }
+
     // No items
     if (clipper->ItemsCount == 0 || GetSkipItemForListClipping())
         return false;
@@ -3214,6 +4845,11 @@ static bool ImGuiListClipper_StepInternal(ImGuiListClipper* clipper)
         clipper->DisplayEnd = ImMin(data->ItemsFrozen + 1, clipper->ItemsCount);
         if (clipper->DisplayStart < clipper->DisplayEnd)
             data->ItemsFrozen++;
+        if (height_index != NULL)
+        {
+            data->MeasureItemIdx = clipper->DisplayStart;
+            data->MeasurePosY = window->DC.CursorPos.y;
+        }
         return true;
     }
 
@@ -3256,7 +4892,7 @@ static bool ImGuiListClipper_StepInternal(ImGuiListClipper* clipper)
     if (calc_clipping)
     {
         // Record seek offset, this is so ImGuiListClipper::Seek() can be called after ImGuiListClipperData is done
-        clipper->StartSeekOffsetY = (double)data->LossynessOffset - data->ItemsFrozen * (double)clipper->ItemsHeight;
+        clipper->StartSeekOffsetY = (double)data->LossynessOffset - (height_index ? height_index->GetOffset(data->ItemsFrozen) : data->ItemsFrozen * (double)clipper->ItemsHeight);
 
         if (g.LogEnabled)
         {
@@ -3308,8 +4944,19 @@ static bool ImGuiListClipper_StepInternal(ImGuiListClipper* clipper)
         for (ImGuiListClipperRange& range : data->Ranges)
             if (range.PosToIndexConvert)
             {
-                int m1 = (int)(((double)range.Min - window->DC.CursorPos.y - data->LossynessOffset) / clipper->ItemsHeight);
-                int m2 = (int)((((double)range.Max - window->DC.CursorPos.y - data->LossynessOffset) / clipper->ItemsHeight) + 0.999999f);
+                int m1, m2;
+                if (height_index != NULL)
+                {
+                    // Lookup items at both positions, relative to the first item not submitted yet.
+                    const double base_offset = height_index->GetOffset(already_submitted) - window->DC.CursorPos.y - data->LossynessOffset;
+                    m1 = height_index->FindItem(base_offset + range.Min) - already_submitted;
+                    m2 = height_index->FindItem(base_offset + range.Max) + 1 - already_submitted;
+                }
+                else
+                {
+                    m1 = (int)(((double)range.Min - window->DC.CursorPos.y - data->LossynessOffset) / clipper->ItemsHeight);
+                    m2 = (int)((((double)range.Max - window->DC.CursorPos.y - data->LossynessOffset) / clipper->ItemsHeight) + 0.999999f);
+                }
                 range.Min = ImClamp(already_submitted + m1 + range.PosToIndexOffsetMin, already_submitted, clipper->ItemsCount - 1);
                 range.Max = ImClamp(already_submitted + m2 + range.PosToIndexOffsetMax, range.Min + 1, clipper->ItemsCount);
                 range.PosToIndexConvert = false;
@@ -3322,11 +4969,22 @@ static bool ImGuiListClipper_StepInternal(ImGuiListClipper* clipper)
     {
         clipper->DisplayStart = ImMax(data->Ranges[data->StepNo].Min, already_submitted);
         clipper->DisplayEnd = ImMin(data->Ranges[data->StepNo].Max, clipper->ItemsCount);
+        if (height_index != NULL && clipper->DisplayStart + 1 < clipper->DisplayEnd)
+        {
+            // Display items one by one so we can measure them: move remaining items to a new range.
+            data->Ranges.insert(data->Ranges.Data + data->StepNo + 1, ImGuiListClipperRange::FromIndices(clipper->DisplayStart + 1, clipper->DisplayEnd));
+            clipper->DisplayEnd = clipper->DisplayStart + 1;
+        }
         data->StepNo++;
         if (clipper->DisplayStart >= clipper->DisplayEnd)
             continue;
         if (clipper->DisplayStart > already_submitted)
             clipper->SeekCursorForItem(clipper->DisplayStart);
+        if (height_index != NULL)
+        {
+            data->MeasureItemIdx = clipper->DisplayStart;
+            data->MeasurePosY = window->DC.CursorPos.y;
+        }
         return true;
     }
 
@@ -3338,6 +4996,58 @@ static bool ImGuiListClipper_StepInternal(ImGuiListClipper* clipper)
     return false;
 }
 
+void ImGuiListClipperHeightIndex::Resize(int items_count)
+{
+    IM_ASSERT(items_count >= 0 && DefaultHeight > 0.0f);
+    const int prev_count = Heights.Size;
+    Heights.resize(items_count, DefaultHeight);
+    Tree.resize(items_count);
+
+    // Nodes only depend on items before them, so we only need to compute nodes of new items: each one is the sum of its children + its item.
+    for (int n = prev_count + 1; n <= items_count; n++)
+    {
+        double sum = DefaultHeight;
+        for (int child_n = n - 1; child_n > n - (n & -n); child_n -= (child_n & -child_n))
+            sum += Tree[child_n - 1];
+        Tree[n - 1] = sum;
+    }
+}
+
+void ImGuiListClipperHeightIndex::SetHeight(int item_n, float height)
+{
+    const double delta = (double)height - Heights[item_n];
+    if (delta == 0.0)
+        return;
+    Heights[item_n] = height;
+    for (int n = item_n + 1; n <= Tree.Size; n += (n & -n))
+        Tree[n - 1] += delta;
+}
+
+double ImGuiListClipperHeightIndex::GetOffset(int item_n) const
+{
+    IM_ASSERT(item_n >= 0 && item_n <= Tree.Size);
+    double offset = 0.0;
+    for (int n = item_n; n > 0; n -= (n & -n))
+        offset += Tree[n - 1];
+    return offset;
+}
+
+int ImGuiListClipperHeightIndex::FindItem(double offset) const
+{
+    // Descend the tree to find the number of items ending before or at 'offset'
+    int item_n = 0;
+    int step = 1;
+    while (step * 2 <= Tree.Size)
+        step *= 2;
+    for (; step > 0; step >>= 1)
+        if (item_n + step <= Tree.Size && Tree[item_n + step - 1] <= offset)
+        {
+            item_n += step;
+            offset -= Tree[item_n - 1];
+        }
+    return ImMax(ImMin(item_n, Tree.Size - 1), 0);
+}
+
 bool ImGuiListClipper::Step()
 {
     ImGuiContext& g = *Ctx;
@@ -4160,6 +5870,9 @@ ImGuiContext::ImGuiContext(ImFontAtlas* shared_font_atlas)
 
     SettingsLoaded = false;
     SettingsDirtyTimer = 0.0f;
+    SettingsSaveCount = 0;
+    SettingsIniDataSavedHash = 0;
+    SettingsSaveWorker = NULL;
     HookIdNext = 0;
 
     memset(LocalizationTable, 0, sizeof(LocalizationTable));
@@ -4224,6 +5937,8 @@ void ImGui::Initialize()
         ini_handler.ReadLineFn = WindowSettingsHandler_ReadLine;
         ini_handler.ApplyAllFn = WindowSettingsHandler_ApplyAll;
         ini_handler.WriteAllFn = WindowSettingsHandler_WriteAll;
+        ini_handler.WriteAllBinaryFn = WindowSettingsHandler_WriteAllBinary;
+        ini_handler.ReadAllBinaryFn = WindowSettingsHandler_ReadAllBinary;
         AddSettingsHandler(&ini_handler);
     }
     TableSettingsAddSettingsHandler();
@@ -4287,6 +6002,7 @@ void ImGui::Shutdown()
     // Save settings (unless we haven't attempted to load them: CreateContext/DestroyContext without a call to NewFrame shouldn't save an empty file)
     if (g.SettingsLoaded && g.IO.IniFilename != NULL)
         SaveIniSettingsToDisk(g.IO.IniFilename);
+    SettingsSaveWorkerDestroy(&g);
 
     // Destroy platform windows
     DestroyPlatformWindows();
@@ -5366,6 +7082,7 @@ void ImGui::NewFrame()
 
     // Load settings on first frame, save settings when modified (after a delay)
     UpdateSettings();
+    UpdateTextSizeCache();
 
     g.Time += g.IO.DeltaTime;
     g.WithinFrameScope = true;
@@ -5388,6 +7105,13 @@ void ImGui::NewFrame()
     // Update viewports (after processing input queue, so io.MouseHoveredViewport is set)
     UpdateViewportsNewFrame();
 
+    // Rasterize glyphs requested during previous frame (ImFontAtlasFlags_DynamicGlyphs)
+    if (g.IO.Fonts->DynamicData != NULL)
+    {
+        IM_ASSERT((g.IO.BackendFlags & ImGuiBackendFlags_RendererHasTexUpdates) && "ImFontAtlasFlags_DynamicGlyphs requires a renderer backend supporting texture updates!");
+        ImFontAtlasUpdateDynamicGlyphs(g.IO.Fonts);
+    }
+
     // Setup current font and draw list shared data
     // FIXME-VIEWPORT: the concept of a single ClipRectFullscreen is not ideal!
     g.IO.Fonts->Locked = true;
@@ -6039,6 +7763,30 @@ void ImGui::Render()
     CallContextHooks(&g, ImGuiContextHookType_RenderPost);
 }
 
+// Hash for CalcTextSize() cache keys, reading 8 bytes at a time: ImHashStr() would cost about as much as measuring the text.
+// Each step is a bijection of the state, so texts of a same length differing by a single 8 bytes block never collide.
+static ImU64 ImHashTextForSizeCache(const char* text, size_t text_len, ImU64 seed)
+{
+    ImU64 h = seed ^ ((ImU64)text_len * 0x9E3779B97F4A7C15ULL);
+    ImU64 v;
+    for (; text_len >= 8; text += 8, text_len -= 8)
+    {
+        memcpy(&v, text, 8);
+        h = (h ^ v) * 0xFF51AFD7ED558CCDULL;
+        h ^= h >> 32;
+    }
+    if (text_len > 0)
+    {
+        v = 0;
+        memcpy(&v, text, text_len);
+        h = (h ^ v) * 0xFF51AFD7ED558CCDULL;
+        h ^= h >> 32;
+    }
+    h *= 0xC4CEB9FE1A85EC53ULL;
+    h ^= h >> 29;
+    return h;
+}
+
 // Calculate text size. Text can be multi-line. Optionally ignore text after a ## marker.
 // CalcTextSize("") should return ImVec2(0.0f, g.FontSize)
 ImVec2 ImGui::CalcTextSize(const char* text, const char* text_end, bool hide_text_after_double_hash, float wrap_width)
@@ -6055,6 +7803,43 @@ ImVec2 ImGui::CalcTextSize(const char* text, const char* text_end, bool hide_tex
     const float font_size = g.FontSize;
     if (text == text_display_end)
         return ImVec2(0.0f, font_size);
+    if (text_display_end == NULL)
+        text_display_end = text + ImStrlen(text);
+
+    // Lookup in cache (io.ConfigTextSizeCacheSize)
+    // Fonts without lookup tables (e.g. password font, which is reconfigured on every use) are not cached.
+    ImGuiTextSizeCache& cache = g.TextSizeCache;
+    ImGuiTextSizeCacheEntry* cache_entry = NULL;
+    ImU64 cache_key = 0;
+    const int text_len = (int)(text_display_end - text);
+    if (cache.Entries.Size > 0 && font->IndexAdvanceX.Size > 0)
+    {
+        ImU32 size_bits, wrap_bits;
+        memcpy(&size_bits, &font_size, 4);
+        memcpy(&wrap_bits, &wrap_width, 4);
+        const ImU64 seed = ((ImU64)(size_t)font ^ ((ImU64)font->ContainerAtlas->BuildCount << 48)) ^ ((((ImU64)size_bits << 32) | wrap_bits) * 0x9E3779B97F4A7C15ULL);
+        const ImU64 hash = ImHashTextForSizeCache(text, (size_t)text_len, seed);
+        cache_key = (hash != 0) ? hash : 1;
+        ImGuiTextSizeCacheEntry* set = &cache.Entries.Data[(int)(hash >> 32) & (cache.Entries.Size - 4)];
+        cache_entry = &set[0];
+        for (int n = 0; n < 4; n++)
+        {
+            if (set[n].Key == cache_key && set[n].TextLen == text_len)
+            {
+                set[n].LastUsedFrame = g.FrameCount;
+                cache.Hits++;
+                return set[n].Size;
+            }
+            if (set[n].LastUsedFrame < cache_entry->LastUsedFrame)
+                cache_entry = &set[n];
+        }
+        cache.Misses++;
+        if (cache_entry->LastUsedFrame == g.FrameCount)
+            cache_entry = NULL; // Set is full of entries used this frame: don't evict them, they are likely to be used again next frame (LRU would thrash)
+        else if (cache_entry->Key != 0)
+            cache.Evictions++;
+    }
+
     ImVec2 text_size = font->CalcTextSizeA(font_size, FLT_MAX, wrap_width, text, text_display_end, NULL);
 
     // Round
@@ -6064,9 +7849,36 @@ ImVec2 ImGui::CalcTextSize(const char* text, const char* text_end, bool hide_tex
     // - https://embarkstudios.github.io/rust-gpu/api/src/libm/math/ceilf.rs.html
     text_size.x = IM_TRUNC(text_size.x + 0.99999f);
 
+    if (cache_entry != NULL)
+    {
+        cache_entry->Key = cache_key;
+        cache_entry->TextLen = text_len;
+        cache_entry->Size = text_size;
+        cache_entry->LastUsedFrame = g.FrameCount;
+    }
     return text_size;
 }
 
+// Apply io.ConfigTextSizeCacheSize and roll stats over
+static void ImGui::UpdateTextSizeCache()
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiTextSizeCache& cache = g.TextSizeCache;
+    cache.LastFrameHits = cache.Hits;
+    cache.LastFrameMisses = cache.Misses;
+    cache.LastFrameEvictions = cache.Evictions;
+    cache.Hits = cache.Misses = cache.Evictions = 0;
+
+    const int entries_count = (g.IO.ConfigTextSizeCacheSize > 0) ? ImMax(ImUpperPowerOfTwo(g.IO.ConfigTextSizeCacheSize), 4) : 0;
+    if (cache.Entries.Size != entries_count)
+    {
+        cache.Entries.clear();
+        cache.Entries.resize(entries_count);
+        if (entries_count > 0)
+            memset(cache.Entries.Data, 0, (size_t)cache.Entries.size_in_bytes());
+    }
+}
+
 // Find window given position, search front-to-back
 // - Typically write output back to g.HoveredWindow and g.HoveredWindowUnderMovingWindow.
 // - FIXME: Note that we have an inconsequential lag here: OuterRectClipped is updated in Begin(), so windows moved programmatically
@@ -15311,7 +17123,9 @@ void ImGui::LogButtons()
 // - LoadIniSettingsFromDisk()
 // - LoadIniSettingsFromMemory()
 // - SaveIniSettingsToDisk()
+// - SaveIniSettingsToDiskAsync() [Internal]
 // - SaveIniSettingsToMemory()
+// - SettingsWriteCacheCopy(), SettingsWriteCacheStore() [Internal]
 //-----------------------------------------------------------------------------
 // - CreateNewWindowSettings() [Internal]
 // - FindWindowSettingsByID() [Internal]
@@ -15320,6 +17134,102 @@ void ImGui::LogButtons()
 // - WindowSettingsHandler_***() [Internal]
 //-----------------------------------------------------------------------------
 
+// Binary .ini format (io.ConfigIniSettingsBinary)
+// - Header: 8 bytes magic + ImU32 version.
+// - Followed by one section per handler: ImU32 TypeHash, ImU32 type (0: text, 1: binary), ImU32 size, data.
+// - Text sections are parsed like a regular .ini file. Sections of unknown handlers are skipped.
+static const char       IMGUI_SETTINGS_BINARY_MAGIC[8] = { 'I', 'm', 'G', 'u', 'i', 'B', 'i', 'n' };
+static const ImU32      IMGUI_SETTINGS_BINARY_VERSION = 1;
+
+static bool IsIniSettingsDataBinary(const void* data, size_t data_size)
+{
+    return data_size >= sizeof(IMGUI_SETTINGS_BINARY_MAGIC) && memcmp(data, IMGUI_SETTINGS_BINARY_MAGIC, sizeof(IMGUI_SETTINGS_BINARY_MAGIC)) == 0;
+}
+
+#ifdef IMGUI_ENABLE_THREADS
+// Background thread writing .ini settings to disk, so NewFrame() never blocks on file I/O.
+// - Main thread serializes settings and submits a snapshot. A snapshot submitted while another is pending replaces it.
+// - Buffers are only (re)allocated by the main thread. The worker thread swaps them and doesn't call IM_ALLOC()/IM_FREE().
+struct ImGuiSettingsSaveWorker
+{
+    std::thread             Thread;
+    std::mutex              Mutex;
+    std::condition_variable Cond;               // Signaled when a snapshot is submitted, when quitting and when a write is done
+    ImVector<char>          PendingData;        // Snapshot to write: zero-terminated filename followed by .ini data
+    ImVector<char>          WritingData;        // Snapshot being written (only accessed by worker thread while Busy)
+    bool                    Pending;
+    bool                    Busy;
+    bool                    Quit;
+    bool                    LastWriteFailed;
+
+    ImGuiSettingsSaveWorker() { Pending = Busy = Quit = LastWriteFailed = false; }
+};
+
+static void SettingsSaveWorkerThreadMain(ImGuiSettingsSaveWorker* worker)
+{
+    std::unique_lock<std::mutex> lock(worker->Mutex);
+    while (true)
+    {
+        while (!worker->Pending && !worker->Quit)
+            worker->Cond.wait(lock);
+        if (!worker->Pending) // Only quit once pending snapshot is written
+            break;
+        worker->PendingData.swap(worker->WritingData);
+        worker->Pending = false;
+        worker->Busy = true;
+        lock.unlock();
+
+        const char* filename = worker->WritingData.Data;
+        const size_t filename_size = strlen(filename) + 1;
+        const char* data = filename + filename_size;
+        const size_t data_size = (size_t)worker->WritingData.Size - filename_size;
+        const bool ret = ImFileWriteAtomically(filename, IsIniSettingsDataBinary(data, data_size) ? "wb" : "wt", data, data_size);
+
+        lock.lock();
+        worker->Busy = false;
+        worker->LastWriteFailed |= !ret;
+        worker->Cond.notify_all();
+    }
+}
+
+static void SettingsSaveWorkerCreate(ImGuiContext* ctx)
+{
+    IM_ASSERT(ctx->SettingsSaveWorker == NULL);
+    ImGuiSettingsSaveWorker* worker = IM_NEW(ImGuiSettingsSaveWorker)();
+    worker->Thread = std::thread(SettingsSaveWorkerThreadMain, worker);
+    ctx->SettingsSaveWorker = worker;
+}
+
+static void SettingsSaveWorkerWaitIdle(ImGuiContext* ctx)
+{
+    if (ImGuiSettingsSaveWorker* worker = ctx->SettingsSaveWorker)
+    {
+        std::unique_lock<std::mutex> lock(worker->Mutex);
+        while (worker->Pending || worker->Busy)
+            worker->Cond.wait(lock);
+    }
+}
+
+// Pending snapshot is written before the thread exits.
+static void SettingsSaveWorkerDestroy(ImGuiContext* ctx)
+{
+    if (ImGuiSettingsSaveWorker* worker = ctx->SettingsSaveWorker)
+    {
+        {
+            std::lock_guard<std::mutex> lock(worker->Mutex);
+            worker->Quit = true;
+            worker->Cond.notify_all();
+        }
+        worker->Thread.join();
+        IM_DELETE(worker);
+        ctx->SettingsSaveWorker = NULL;
+    }
+}
+#else
+static void SettingsSaveWorkerWaitIdle(ImGuiContext*)   {}
+static void SettingsSaveWorkerDestroy(ImGuiContext*)    {}
+#endif
+
 // Called by NewFrame()
 void ImGui::UpdateSettings()
 {
@@ -15340,7 +17250,7 @@ void ImGui::UpdateSettings()
         if (g.SettingsDirtyTimer <= 0.0f)
         {
             if (g.IO.IniFilename != NULL)
-                SaveIniSettingsToDisk(g.IO.IniFilename);
+                SaveIniSettingsToDiskAsync(g.IO.IniFilename);
             else
                 g.IO.WantSaveIniSettings = true;  // Let user know they can call SaveIniSettingsToMemory(). user will need to clear io.WantSaveIniSettings themselves.
             g.SettingsDirtyTimer = 0.0f;
@@ -15392,6 +17302,7 @@ void ImGui::ClearIniSettings()
 {
     ImGuiContext& g = *GImGui;
     g.SettingsIniData.clear();
+    g.SettingsSaveCount++; // Invalidate write caches
     for (ImGuiSettingsHandler& handler : g.SettingsHandlers)
         if (handler.ClearAllFn != NULL)
             handler.ClearAllFn(&g, &handler);
@@ -15408,31 +17319,10 @@ void ImGui::LoadIniSettingsFromDisk(const char* ini_filename)
     IM_FREE(file_data);
 }
 
-// Zero-tolerance, no error reporting, cheap .ini parsing
-// Set ini_size==0 to let us use strlen(ini_data). Do not call this function with a 0 if your buffer is actually empty!
-void ImGui::LoadIniSettingsFromMemory(const char* ini_data, size_t ini_size)
+// Parse .ini text, calling handlers ReadOpenFn()/ReadLineFn(). Writes zero-terminators within the buffer, including at buf_end[0].
+static void LoadIniSettingsFromMemoryText(ImGuiContext* ctx, char* buf, char* buf_end)
 {
-    ImGuiContext& g = *GImGui;
-    IM_ASSERT(g.Initialized);
-    //IM_ASSERT(!g.WithinFrameScope && "Cannot be called between NewFrame() and EndFrame()");
-    //IM_ASSERT(g.SettingsLoaded == false && g.FrameCount == 0);
-
-    // For user convenience, we allow passing a non zero-terminated string (hence the ini_size parameter).
-    // For our convenience and to make the code simpler, we'll also write zero-terminators within the buffer. So let's create a writable copy..
-    if (ini_size == 0)
-        ini_size = ImStrlen(ini_data);
-    g.SettingsIniData.Buf.resize((int)ini_size + 1);
-    char* const buf = g.SettingsIniData.Buf.Data;
-    char* const buf_end = buf + ini_size;
-    memcpy(buf, ini_data, ini_size);
-    buf_end[0] = 0;
-
-    // Call pre-read handlers
-    // Some types will clear their data (e.g. dock information) some types will allow merge/override (window)
-    for (ImGuiSettingsHandler& handler : g.SettingsHandlers)
-        if (handler.ReadInitFn != NULL)
-            handler.ReadInitFn(&g, &handler);
-
+    ImGuiContext& g = *ctx;
     void* entry_data = NULL;
     ImGuiSettingsHandler* entry_handler = NULL;
 
@@ -15460,7 +17350,7 @@ void ImGui::LoadIniSettingsFromMemory(const char* ini_data, size_t ini_size)
                 continue;
             *type_end = 0; // Overwrite first ']'
             name_start++;  // Skip second '['
-            entry_handler = FindSettingsHandler(type_start);
+            entry_handler = ImGui::FindSettingsHandler(type_start);
             entry_data = entry_handler ? entry_handler->ReadOpenFn(&g, entry_handler, name_start) : NULL;
         }
         else if (entry_handler != NULL && entry_data != NULL)
@@ -15469,10 +17359,81 @@ void ImGui::LoadIniSettingsFromMemory(const char* ini_data, size_t ini_size)
             entry_handler->ReadLineFn(&g, entry_handler, entry_data, line);
         }
     }
+}
+
+// Single pass over the sections of binary .ini data. Stops at the first invalid section.
+static void LoadIniSettingsFromMemoryBinary(ImGuiContext* ctx, char* buf, char* buf_end)
+{
+    ImGuiContext& g = *ctx;
+    ImGuiSettingsBinaryReader reader(buf, (size_t)(buf_end - buf));
+    char magic[sizeof(IMGUI_SETTINGS_BINARY_MAGIC)];
+    reader.Read(magic, sizeof(magic));
+    if (reader.Read<ImU32>() != IMGUI_SETTINGS_BINARY_VERSION)
+        return;
+    while (!reader.IsEnd())
+    {
+        const ImGuiID type_hash = reader.Read<ImU32>();
+        const ImU32 section_type = reader.Read<ImU32>();
+        const ImU32 section_size = reader.Read<ImU32>();
+        if (reader.Overflow || (size_t)(reader.DataEnd - reader.Data) < section_size)
+            return;
+        char* section_data = buf + (reader.Data - buf);
+        char* section_end = section_data + section_size;
+        reader.Data = section_end;
+
+        if (section_type == 0)
+        {
+            // Text data from a handler without binary support. Zero-terminate temporarily as our text parser requires it.
+            const char section_end_backup = section_end[0];
+            LoadIniSettingsFromMemoryText(&g, section_data, section_end);
+            section_end[0] = section_end_backup;
+            continue;
+        }
+        for (ImGuiSettingsHandler& handler : g.SettingsHandlers)
+            if (handler.TypeHash == type_hash && handler.ReadAllBinaryFn != NULL)
+            {
+                ImGuiSettingsBinaryReader section_reader(section_data, section_size);
+                handler.ReadAllBinaryFn(&g, &handler, &section_reader);
+                break;
+            }
+    }
+}
+
+// Zero-tolerance, no error reporting, cheap .ini parsing
+// Set ini_size==0 to let us use strlen(ini_data). Do not call this function with a 0 if your buffer is actually empty!
+// Binary data (see io.ConfigIniSettingsBinary) is detected from its header, and always requires a valid ini_size.
+void ImGui::LoadIniSettingsFromMemory(const char* ini_data, size_t ini_size)
+{
+    ImGuiContext& g = *GImGui;
+    IM_ASSERT(g.Initialized);
+    //IM_ASSERT(!g.WithinFrameScope && "Cannot be called between NewFrame() and EndFrame()");
+    //IM_ASSERT(g.SettingsLoaded == false && g.FrameCount == 0);
+
+    // For user convenience, we allow passing a non zero-terminated string (hence the ini_size parameter).
+    // For our convenience and to make the code simpler, we'll also write zero-terminators within the buffer. So let's create a writable copy..
+    if (ini_size == 0)
+        ini_size = ImStrlen(ini_data);
+    g.SettingsIniData.Buf.resize((int)ini_size + 1);
+    char* const buf = g.SettingsIniData.Buf.Data;
+    char* const buf_end = buf + ini_size;
+    memcpy(buf, ini_data, ini_size);
+    buf_end[0] = 0;
+
+    // Call pre-read handlers
+    // Some types will clear their data (e.g. dock information) some types will allow merge/override (window)
+    for (ImGuiSettingsHandler& handler : g.SettingsHandlers)
+        if (handler.ReadInitFn != NULL)
+            handler.ReadInitFn(&g, &handler);
+
+    if (IsIniSettingsDataBinary(buf, ini_size))
+        LoadIniSettingsFromMemoryBinary(&g, buf, buf_end);
+    else
+        LoadIniSettingsFromMemoryText(&g, buf, buf_end);
     g.SettingsLoaded = true;
 
     // [DEBUG] Restore untouched copy so it can be browsed in Metrics (not strictly necessary)
     memcpy(buf, ini_data, ini_size);
+    g.SettingsSaveCount++; // SettingsIniData doesn't hold the output of the last save anymore: invalidate write caches
 
     // Call post-read handlers
     for (ImGuiSettingsHandler& handler : g.SettingsHandlers)
@@ -15480,6 +17441,7 @@ void ImGui::LoadIniSettingsFromMemory(const char* ini_data, size_t ini_size)
             handler.ApplyAllFn(&g, &handler);
 }
 
+// Write synchronously. Waits for a pending asynchronous save to complete first, so it cannot overwrite our data.
 void ImGui::SaveIniSettingsToDisk(const char* ini_filename)
 {
     ImGuiContext& g = *GImGui;
@@ -15489,27 +17451,120 @@ void ImGui::SaveIniSettingsToDisk(const char* ini_filename)
 
     size_t ini_data_size = 0;
     const char* ini_data = SaveIniSettingsToMemory(&ini_data_size);
-    ImFileHandle f = ImFileOpen(ini_filename, "wt");
-    if (!f)
+    SettingsSaveWorkerWaitIdle(&g);
+    const ImGuiID ini_data_hash = ImHashStr(ini_filename, 0, ImHashData(ini_data, ini_data_size));
+    g.SettingsIniDataSavedHash = ImFileWriteAtomically(ini_filename, IsIniSettingsDataBinary(ini_data, ini_data_size) ? "wb" : "wt", ini_data, ini_data_size) ? ini_data_hash : 0;
+}
+
+// Called by UpdateSettings() when settings have been modified.
+// Serializing needs to happen on the main thread, but file I/O may take a long time (e.g. network home directories): hand it to a worker thread.
+void ImGui::SaveIniSettingsToDiskAsync(const char* ini_filename)
+{
+    ImGuiContext& g = *GImGui;
+    g.SettingsDirtyTimer = 0.0f;
+    if (!ini_filename)
         return;
-    ImFileWrite(ini_data, sizeof(char), ini_data_size, f);
-    ImFileClose(f);
+
+    size_t ini_data_size = 0;
+    const char* ini_data = SaveIniSettingsToMemory(&ini_data_size);
+    const ImGuiID ini_data_hash = ImHashStr(ini_filename, 0, ImHashData(ini_data, ini_data_size));
+#ifdef IMGUI_ENABLE_THREADS
+    if (g.SettingsSaveWorker == NULL)
+        SettingsSaveWorkerCreate(&g);
+    ImGuiSettingsSaveWorker* worker = g.SettingsSaveWorker;
+    std::lock_guard<std::mutex> lock(worker->Mutex);
+    if (worker->LastWriteFailed)
+        g.SettingsIniDataSavedHash = 0;
+    worker->LastWriteFailed = false;
+    if (ini_data_hash == g.SettingsIniDataSavedHash)
+        return;
+
+    // Replace pending snapshot, if any: only the latest one matters.
+    const size_t filename_size = strlen(ini_filename) + 1;
+    worker->PendingData.resize((int)(filename_size + ini_data_size));
+    memcpy(worker->PendingData.Data, ini_filename, filename_size);
+    memcpy(worker->PendingData.Data + filename_size, ini_data, ini_data_size);
+    worker->Pending = true;
+    worker->Cond.notify_all();
+    g.SettingsIniDataSavedHash = ini_data_hash;
+#else
+    if (ini_data_hash == g.SettingsIniDataSavedHash)
+        return;
+    g.SettingsIniDataSavedHash = ImFileWriteAtomically(ini_filename, IsIniSettingsDataBinary(ini_data, ini_data_size) ? "wb" : "wt", ini_data, ini_data_size) ? ini_data_hash : 0;
+#endif
 }
 
 // Call registered handlers (e.g. SettingsHandlerWindow_WriteAll() + custom handlers) to write their stuff into a text buffer
+// Previous output is kept in g.SettingsIniDataPrev so handlers can copy unchanged entries from it (see SettingsWriteCacheCopy()).
 const char* ImGui::SaveIniSettingsToMemory(size_t* out_size)
 {
     ImGuiContext& g = *GImGui;
     g.SettingsDirtyTimer = 0.0f;
+    g.SettingsSaveCount++;
+    g.SettingsIniDataPrev.Buf.swap(g.SettingsIniData.Buf);
     g.SettingsIniData.Buf.resize(0);
     g.SettingsIniData.Buf.push_back(0);
-    for (ImGuiSettingsHandler& handler : g.SettingsHandlers)
-        handler.WriteAllFn(&g, &handler, &g.SettingsIniData);
+    g.SettingsIniData.reserve(g.SettingsIniDataPrev.Buf.Size);
+    if (g.IO.ConfigIniSettingsBinary)
+    {
+        ImGuiSettingsBinaryWriter writer(&g.SettingsIniData);
+        writer.Write(IMGUI_SETTINGS_BINARY_MAGIC, sizeof(IMGUI_SETTINGS_BINARY_MAGIC));
+        writer.Write(IMGUI_SETTINGS_BINARY_VERSION);
+        for (ImGuiSettingsHandler& handler : g.SettingsHandlers)
+        {
+            // Write section header, then patch its size once handler is done
+            writer.Write((ImU32)handler.TypeHash);
+            writer.Write((ImU32)(handler.WriteAllBinaryFn ? 1 : 0));
+            writer.Write((ImU32)0);
+            const int section_offset = g.SettingsIniData.size();
+            if (handler.WriteAllBinaryFn)
+                handler.WriteAllBinaryFn(&g, &handler, &g.SettingsIniData);
+            else
+                handler.WriteAllFn(&g, &handler, &g.SettingsIniData);
+            const ImU32 section_size = (ImU32)(g.SettingsIniData.size() - section_offset);
+            memcpy(g.SettingsIniData.Buf.Data + section_offset - sizeof(ImU32), &section_size, sizeof(ImU32));
+        }
+    }
+    else
+    {
+        for (ImGuiSettingsHandler& handler : g.SettingsHandlers)
+            handler.WriteAllFn(&g, &handler, &g.SettingsIniData);
+    }
     if (out_size)
         *out_size = (size_t)g.SettingsIniData.size();
     return g.SettingsIniData.c_str();
 }
 
+// Append the text of an entry written by the previous SaveIniSettingsToMemory() call, if it is still valid.
+// - Handlers either call cache->Invalidate() whenever entry data changes, or pass a hash of the entry data.
+// - Only used when writing to g.SettingsIniData: handlers may be called with another buffer.
+bool ImGui::SettingsWriteCacheCopy(ImGuiSettingsWriteCache* cache, ImGuiTextBuffer* out_buf, ImGuiID data_hash)
+{
+    ImGuiContext& g = *GImGui;
+    if (out_buf != &g.SettingsIniData || cache->SaveCount == 0 || cache->SaveCount != g.SettingsSaveCount - 1 || cache->DataHash != data_hash)
+        return false;
+    IM_ASSERT(cache->Offset >= 0 && cache->Offset + cache->Size <= g.SettingsIniDataPrev.size());
+    const char* src = g.SettingsIniDataPrev.begin() + cache->Offset;
+    cache->Offset = out_buf->size();
+    cache->SaveCount = g.SettingsSaveCount;
+    out_buf->append(src, src + cache->Size);
+    return true;
+}
+
+void ImGui::SettingsWriteCacheStore(ImGuiSettingsWriteCache* cache, ImGuiTextBuffer* out_buf, int entry_offset, ImGuiID data_hash)
+{
+    ImGuiContext& g = *GImGui;
+    if (out_buf != &g.SettingsIniData)
+    {
+        cache->Invalidate();
+        return;
+    }
+    cache->Offset = entry_offset;
+    cache->Size = out_buf->size() - entry_offset;
+    cache->SaveCount = g.SettingsSaveCount;
+    cache->DataHash = data_hash;
+}
+
 ImGuiWindowSettings* ImGui::CreateNewWindowSettings(const char* name)
 {
     ImGuiContext& g = *GImGui;
@@ -15621,10 +17676,10 @@ static void WindowSettingsHandler_ApplyAll(ImGuiContext* ctx, ImGuiSettingsHandl
         }
 }
 
-static void WindowSettingsHandler_WriteAll(ImGuiContext* ctx, ImGuiSettingsHandler* handler, ImGuiTextBuffer* buf)
+// Gather data from windows that were active during this session
+// (if a window wasn't opened in this session we preserve its settings)
+static void WindowSettingsHandler_GatherAll(ImGuiContext* ctx)
 {
-    // Gather data from windows that were active during this session
-    // (if a window wasn't opened in this session we preserve its settings)
     ImGuiContext& g = *ctx;
     for (ImGuiWindow* window : g.Windows)
     {
@@ -15650,6 +17705,12 @@ static void WindowSettingsHandler_WriteAll(ImGuiContext* ctx, ImGuiSettingsHandl
         settings->IsChild = (window->RootWindow != window); // Cannot rely on ImGuiWindowFlags_ChildWindow here as docked windows have this set.
         settings->WantDelete = false;
     }
+}
+
+static void WindowSettingsHandler_WriteAll(ImGuiContext* ctx, ImGuiSettingsHandler* handler, ImGuiTextBuffer* buf)
+{
+    ImGuiContext& g = *ctx;
+    WindowSettingsHandler_GatherAll(ctx);
 
     // Write to text buffer
     buf->reserve(buf->size() + g.SettingsWindows.size() * 6); // ballpark reserve
@@ -15657,6 +17718,12 @@ static void WindowSettingsHandler_WriteAll(ImGuiContext* ctx, ImGuiSettingsHandl
     {
         if (settings->WantDelete)
             continue;
+
+        // Copy text from previous save if unchanged. Settings are also modified by docking code: compare a hash of all written fields (Pos..IsChild).
+        const ImGuiID data_hash = ImHashData(&settings->Pos, (size_t)((const char*)(&settings->IsChild + 1) - (const char*)&settings->Pos));
+        if (ImGui::SettingsWriteCacheCopy(&settings->WriteCache, buf, data_hash))
+            continue;
+        const int entry_offset = buf->size();
         const char* settings_name = settings->GetName();
         buf->appendf("[%s][%s]\n", handler->TypeName, settings_name);
         if (settings->IsChild)
@@ -15688,6 +17755,62 @@ static void WindowSettingsHandler_WriteAll(ImGuiContext* ctx, ImGuiSettingsHandl
             }
         }
         buf->append("\n");
+        ImGui::SettingsWriteCacheStore(&settings->WriteCache, buf, entry_offset, data_hash);
+    }
+}
+
+static void WindowSettingsHandler_WriteAllBinary(ImGuiContext* ctx, ImGuiSettingsHandler*, ImGuiTextBuffer* buf)
+{
+    ImGuiContext& g = *ctx;
+    WindowSettingsHandler_GatherAll(ctx);
+
+    ImGuiSettingsBinaryWriter writer(buf);
+    for (ImGuiWindowSettings* settings = g.SettingsWindows.begin(); settings != NULL; settings = g.SettingsWindows.next_chunk(settings))
+    {
+        if (settings->WantDelete)
+            continue;
+        writer.WriteString(settings->GetName());
+        writer.Write(settings->Pos);
+        writer.Write(settings->Size);
+        writer.Write(settings->ViewportPos);
+        writer.Write(settings->ViewportId);
+        writer.Write(settings->DockId);
+        writer.Write(settings->ClassId);
+        writer.Write(settings->DockOrder);
+        writer.Write((ImU8)((settings->Collapsed ? 1 : 0) | (settings->IsChild ? 2 : 0)));
+    }
+}
+
+static void WindowSettingsHandler_ReadAllBinary(ImGuiContext* ctx, ImGuiSettingsHandler* handler, ImGuiSettingsBinaryReader* reader)
+{
+    // When loading into empty storage (common case) entries are known to be unique: skip the linear search done by WindowSettingsHandler_ReadOpen().
+    ImGuiContext& g = *ctx;
+    const bool merge_existing = !g.SettingsWindows.empty();
+    while (!reader->IsEnd())
+    {
+        const char* name = reader->ReadString();
+        ImGuiWindowSettings data;
+        data.Pos = reader->Read<ImVec2ih>();
+        data.Size = reader->Read<ImVec2ih>();
+        data.ViewportPos = reader->Read<ImVec2ih>();
+        data.ViewportId = reader->Read<ImGuiID>();
+        data.DockId = reader->Read<ImGuiID>();
+        data.ClassId = reader->Read<ImGuiID>();
+        data.DockOrder = reader->Read<short>();
+        const ImU8 flags = reader->Read<ImU8>();
+        if (reader->Overflow)
+            break;
+        ImGuiWindowSettings* settings = merge_existing ? (ImGuiWindowSettings*)WindowSettingsHandler_ReadOpen(ctx, handler, name) : ImGui::CreateNewWindowSettings(name);
+        settings->WantApply = true;
+        settings->Pos = data.Pos;
+        settings->Size = data.Size;
+        settings->ViewportPos = data.ViewportPos;
+        settings->ViewportId = data.ViewportId;
+        settings->DockId = data.DockId;
+        settings->ClassId = data.ClassId;
+        settings->DockOrder = data.DockOrder;
+        settings->Collapsed = (flags & 1) != 0;
+        settings->IsChild = (flags & 2) != 0;
     }
 }
 
@@ -21145,6 +23268,26 @@ void ImGui::ShowFontAtlas(ImFontAtlas* atlas)
         DebugNodeFont(font);
         PopID();
     }
+    const ImFontAtlasBuildStats& stats = atlas->BuildStats;
+    if (stats.LoadedFromCache)
+        BulletText("Loaded from cache file \"%s\" (%.2f ms, %d glyphs)", atlas->CacheFilename, stats.TimeTotal, stats.GlyphsCount);
+    else if (stats.TimeTotal > 0.0f && TreeNode("Build Stats", "Build Stats (%.2f ms, %d glyphs)", stats.TimeTotal, stats.GlyphsCount))
+    {
+        BulletText("Init: %.2f ms", stats.TimeInit);
+        BulletText("Gather: %.2f ms", stats.TimeGather);
+        BulletText("Pack: %.2f ms", stats.TimePack);
+        BulletText("Render: %.2f ms (%d jobs on %d threads)", stats.TimeRender, stats.RenderJobsCount, stats.RenderThreadsCount);
+        BulletText("Setup: %.2f ms", stats.TimeSetup);
+        if (stats.KerningPairsCount > 0)
+            BulletText("Kerning pairs: %d", stats.KerningPairsCount);
+        TreePop();
+    }
+    if (atlas->DynamicData != NULL && TreeNode("Dynamic Glyphs", "Dynamic Glyphs (%d/%d resident)", stats.DynamicGlyphsResident, stats.DynamicGlyphsAvailable))
+    {
+        BulletText("Rasterized: %d glyphs (last frame: %.2f ms)", stats.DynamicGlyphsRasterized, stats.TimeDynamic);
+        BulletText("Pages: %d, evicted: %d", stats.DynamicPagesCount, stats.DynamicPagesEvicted);
+        TreePop();
+    }
     if (TreeNode("Font Atlas", "Font Atlas (%dx%d pixels)", atlas->TexWidth, atlas->TexHeight))
     {
         ImGuiContext& g = *GImGui;
@@ -21482,6 +23625,24 @@ void ImGui::ShowMetricsWindow(bool* p_open)
         TreePop();
     }
 
+    // Details for CalcTextSize() cache
+    ImGuiTextSizeCache& text_size_cache = g.TextSizeCache;
+    if (TreeNode("TextSizeCache", "Text Size Cache (%d)", text_size_cache.Entries.Size))
+    {
+        int used_count = 0;
+        for (const ImGuiTextSizeCacheEntry& entry : text_size_cache.Entries)
+            used_count += (entry.Key != 0) ? 1 : 0;
+        const int lookups_count = text_size_cache.LastFrameHits + text_size_cache.LastFrameMisses;
+        SetNextItemWidth(GetFontSize() * 8);
+        DragInt("io.ConfigTextSizeCacheSize", &g.IO.ConfigTextSizeCacheSize, 16.0f, 0, 1 << 20);
+        BulletText("Entries: %d/%d used (%d KB)", used_count, text_size_cache.Entries.Size, text_size_cache.Entries.size_in_bytes() / 1024);
+        BulletText("Last frame: %d lookups, %d hits (%.1f%%), %d misses, %d evictions", lookups_count, text_size_cache.LastFrameHits,
+            lookups_count > 0 ? text_size_cache.LastFrameHits * 100.0f / lookups_count : 0.0f, text_size_cache.LastFrameMisses, text_size_cache.LastFrameEvictions);
+        if (SmallButton("Clear") && text_size_cache.Entries.Size > 0)
+            memset(text_size_cache.Entries.Data, 0, (size_t)text_size_cache.Entries.size_in_bytes());
+        TreePop();
+    }
+
     // Details for InputText
     if (TreeNode("InputText"))
     {
@@ -21543,7 +23704,8 @@ void ImGui::ShowMetricsWindow(bool* p_open)
         else
             TextUnformatted("<NULL>");
         Checkbox("io.ConfigDebugIniSettings", &io.ConfigDebugIniSettings);
-        Text("SettingsDirtyTimer %.2f", g.SettingsDirtyTimer);
+        Checkbox("io.ConfigIniSettingsBinary", &io.ConfigIniSettingsBinary);
+        Text("SettingsDirtyTimer %.2f, SettingsIniDataSavedHash 0x%08X", g.SettingsDirtyTimer, g.SettingsIniDataSavedHash);
         if (TreeNode("SettingsHandlers", "Settings handlers: (%d)", g.SettingsHandlers.Size))
         {
             for (ImGuiSettingsHandler& handler : g.SettingsHandlers)
@@ -21592,7 +23754,10 @@ void ImGui::ShowMetricsWindow(bool* p_open)
 
         if (TreeNode("SettingsIniData", "Settings unpacked data (.ini): %d bytes", g.SettingsIniData.size()))
         {
-            InputTextMultiline("##Ini", (char*)(void*)g.SettingsIniData.c_str(), g.SettingsIniData.Buf.Size, ImVec2(-FLT_MIN, GetTextLineHeight() * 20), ImGuiInputTextFlags_ReadOnly);
+            if (IsIniSettingsDataBinary(g.SettingsIniData.c_str(), (size_t)g.SettingsIniData.size()))
+                TextDisabled("(binary data)");
+            else
+                InputTextMultiline("##Ini", (char*)(void*)g.SettingsIniData.c_str(), g.SettingsIniData.Buf.Size, ImVec2(-FLT_MIN, GetTextLineHeight() * 20), ImGuiInputTextFlags_ReadOnly);
             TreePop();
         }
         TreePop();
@@ -22066,9 +24231,10 @@ void ImGui::DebugNodeDrawList(ImGuiWindow* window, ImGuiViewportP* viewport, con
                 for (int n = 0; n < 3; n++, idx_i++)
                 {
                     const ImDrawVert& v = vtx_buffer[idx_buffer ? idx_buffer[idx_i] : idx_i];
-                    triangle[n] = v.pos;
+                    const ImVec2 v_pos = v.pos, v_uv = v.uv;
+                    triangle[n] = v_pos;
                     buf_p += ImFormatString(buf_p, buf_end - buf_p, "%s %04d: pos (%8.2f,%8.2f), uv (%.6f,%.6f), col %08X\n",
-                        (n == 0) ? "Vert:" : "     ", idx_i, v.pos.x, v.pos.y, v.uv.x, v.uv.y, v.col);
+                        (n == 0) ? "Vert:" : "     ", idx_i, v_pos.x, v_pos.y, v_uv.x, v_uv.y, v.col);
                 }
 
                 Selectable(buf, false);
@@ -47,7 +47,7 @@ Index of this file:
 // [SECTION] ImGuiStyle
 // [SECTION] ImGuiIO
 // [SECTION] Misc data structures (ImGuiInputTextCallbackData, ImGuiSizeCallbackData, ImGuiWindowClass, ImGuiPayload)
-// [SECTION] Helpers (ImGuiOnceUponAFrame, ImGuiTextFilter, ImGuiTextBuffer, ImGuiStorage, ImGuiListClipper, Math Operators, ImColor)
+// [SECTION] Helpers (ImGuiOnceUponAFrame, ImGuiTextFilter, ImGuiTextBuffer, ImGuiStorage, ImGuiListClipper, ImGuiListClipperHeightIndex, ImGuiTextWrapLayout, ImGuiPlotBuffer, Math Operators, ImColor)
 // [SECTION] Multi-Select API flags and structures (ImGuiMultiSelectFlags, ImGuiMultiSelectIO, ImGuiSelectionRequest, ImGuiSelectionBasicStorage, ImGuiSelectionExternalStorage)
 // [SECTION] Drawing API (ImDrawCallback, ImDrawCmd, ImDrawIdx, ImDrawVert, ImDrawChannel, ImDrawListSplitter, ImDrawFlags, ImDrawListFlags, ImDrawList, ImDrawData)
 // [SECTION] Font API (ImFontConfig, ImFontGlyph, ImFontGlyphRangesBuilder, ImFontAtlasFlags, ImFontAtlas, ImFont)
@@ -168,13 +168,16 @@ struct ImDrawData;                  // All draw command lists required to render
 struct ImDrawList;                  // A single draw command list (generally one per window, conceptually you may see this as a dynamic "mesh" builder)
 struct ImDrawListSharedData;        // Data shared among multiple draw lists (typically owned by parent ImGui context, but you may create one yourself)
 struct ImDrawListSplitter;          // Helper to split a draw list into different layers which can be drawn into out of order, then flattened back.
-struct ImDrawVert;                  // A single vertex (pos + uv + col = 20 bytes by default. Override layout with IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT)
+struct ImDrawVert;                  // A single vertex (pos + uv + col = 20 bytes by default, 12 bytes with IMGUI_USE_COMPACT_DRAWVERT. Override layout with IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT)
 struct ImFont;                      // Runtime data for a single font within a parent ImFontAtlas
 struct ImFontAtlas;                 // Runtime data for multiple fonts, bake multiple fonts into a single texture, TTF/OTF font loader
+struct ImFontAtlasBuildStats;       // Timings of the last ImFontAtlas::Build() call
+struct ImFontAtlasDynamicData;      // Opaque storage for glyphs rasterized on demand (ImFontAtlasFlags_DynamicGlyphs)
 struct ImFontBuilderIO;             // Opaque interface to a font builder (stb_truetype or FreeType).
 struct ImFontConfig;                // Configuration data when adding a font or merging fonts
 struct ImFontGlyph;                 // A single font glyph (code point + coordinates within in ImFontAtlas + offset)
 struct ImFontGlyphRangesBuilder;    // Helper to build glyph ranges from text/string data
+struct ImFontKerningPair;           // Advance adjustment between two code points (see ImFontConfig::Kerning)
 struct ImColor;                     // Helper functions to create a color that can be converted to either u32 or float4 (*OBSOLETE* please avoid using)
 
 // Forward declarations: ImGui layer
@@ -183,6 +186,7 @@ struct ImGuiIO;                     // Main configuration and I/O between your a
 struct ImGuiInputTextCallbackData;  // Shared state of InputText() when using custom ImGuiInputTextCallback (rare/advanced use)
 struct ImGuiKeyData;                // Storage for ImGuiIO and IsKeyDown(), IsKeyPressed() etc functions.
 struct ImGuiListClipper;            // Helper to manually clip large list of items
+struct ImGuiListClipperHeightIndex; // Helper to store heights of items for ImGuiListClipper, to clip large list of items of variable height
 struct ImGuiMultiSelectIO;          // Structure to interact with a BeginMultiSelect()/EndMultiSelect() block
 struct ImGuiOnceUponAFrame;         // Helper for running a block of code not more than once a frame
 struct ImGuiPayload;                // User data payload for drag and drop operations
@@ -198,8 +202,15 @@ struct ImGuiStoragePair;            // Helper for key->value storage (pair)
 struct ImGuiStyle;                  // Runtime data for styling/colors
 struct ImGuiTableSortSpecs;         // Sorting specifications for a table (often handling sort specs for a single column, occasionally more)
 struct ImGuiTableColumnSortSpecs;   // Sorting specification for one column of a table
+struct ImGuiTableSorter;            // Helper to sort rows of a table according to ImGuiTableSortSpecs, outputting a permutation of your rows
 struct ImGuiTextBuffer;             // Helper to hold and append into a text buffer (~string builder)
 struct ImGuiTextFilter;             // Helper to parse and apply text filters (e.g. "aaaaa[,bbbbb][,ccccc]")
+struct ImGuiTextFilterIndex;        // Helper to apply a ImGuiTextFilter to a large number of lines and store indices of lines passing it, to display with ImGuiListClipper
+struct ImGuiTextLog;                // Helper to store lines of a log with a fixed memory budget, appended from any thread, to display with ImGuiListClipper
+struct ImGuiTextFileView;           // Helper to view a large text file, memory-mapped and indexed in the background, with TextFileView()
+struct ImGuiTextWrapLayout;         // Helper to cache line breaks of a word-wrapped text, to display it with ImGuiListClipper
+struct ImGuiPlotBuffer;             // Helper to store samples in a ring buffer with a min/max pyramid, to display millions of values with PlotLines()/PlotHistogram()
+struct ImGuiVirtualGrid;            // State of a VirtualGrid(): a scrolling grid of millions of rows and thousands of columns, only submitting visible cells
 struct ImGuiViewport;               // A Platform Window (always 1 unless multi-viewport are enabled. One per platform window to output to). In the future may represent Platform Monitor
 struct ImGuiWindowClass;            // Window class (rare/advanced uses: provide hints to the platform backend via altered viewport flags and parent/child info)
 
@@ -551,6 +562,7 @@ namespace ImGui
     IMGUI_API void          BulletText(const char* fmt, ...)                                IM_FMTARGS(1); // shortcut for Bullet()+Text()
     IMGUI_API void          BulletTextV(const char* fmt, va_list args)                      IM_FMTLIST(1);
     IMGUI_API void          SeparatorText(const char* label);                               // currently: formatted text with a horizontal line
+    IMGUI_API void          TextFileView(const char* str_id, ImGuiTextFileView* view, const ImVec2& size = ImVec2(0, 0)); // read-only view of a (large) text file opened with ImGuiTextFileView::Open(). Only visible lines are processed.
 
     // Widgets: Main
     // - Most widgets return true when the value has been changed or when pressed/selected
@@ -718,6 +730,8 @@ namespace ImGui
     IMGUI_API void          PlotLines(const char* label, float(*values_getter)(void* data, int idx), void* data, int values_count, int values_offset = 0, const char* overlay_text = NULL, float scale_min = FLT_MAX, float scale_max = FLT_MAX, ImVec2 graph_size = ImVec2(0, 0));
     IMGUI_API void          PlotHistogram(const char* label, const float* values, int values_count, int values_offset = 0, const char* overlay_text = NULL, float scale_min = FLT_MAX, float scale_max = FLT_MAX, ImVec2 graph_size = ImVec2(0, 0), int stride = sizeof(float));
     IMGUI_API void          PlotHistogram(const char* label, float (*values_getter)(void* data, int idx), void* data, int values_count, int values_offset = 0, const char* overlay_text = NULL, float scale_min = FLT_MAX, float scale_max = FLT_MAX, ImVec2 graph_size = ImVec2(0, 0));
+    IMGUI_API void          PlotLines(const char* label, const ImGuiPlotBuffer* buffer, const char* overlay_text = NULL, float scale_min = FLT_MAX, float scale_max = FLT_MAX, ImVec2 graph_size = ImVec2(0, 0));      // Each pixel column shows the min..max range of its samples
+    IMGUI_API void          PlotHistogram(const char* label, const ImGuiPlotBuffer* buffer, const char* overlay_text = NULL, float scale_min = FLT_MAX, float scale_max = FLT_MAX, ImVec2 graph_size = ImVec2(0, 0));
 
     // Widgets: Value() Helpers.
     // - Those are merely shortcut to calling Text() with a format string. Output single value in "name: value" format (tip: freely declare more in your code to handle your types. you can add functions to the ImGui namespace)
@@ -856,6 +870,11 @@ namespace ImGui
     IMGUI_API int                   TableGetHoveredColumn();                    // return hovered column. return -1 when table is not hovered. return columns_count if the unused space at the right of visible columns is hovered. Can also use (TableGetColumnFlags() & ImGuiTableColumnFlags_IsHovered) instead.
     IMGUI_API void                  TableSetBgColor(ImGuiTableBgTarget target, ImU32 color, int column_n = -1);  // change the color of a cell, row, or column. See ImGuiTableBgTarget_ flags for details.
 
+    // Tables: Virtual Grid
+    // - Display a scrolling grid of any number of rows and columns (e.g. 1M rows x 10K columns). Contents of visible cells are pulled through a callback.
+    // - Unlike BeginTable(), columns have no state other than their width: the cost of a frame only depends on the number of visible cells. See ImGuiVirtualGrid.
+    IMGUI_API void                  VirtualGrid(const char* str_id, ImGuiVirtualGrid* grid, const ImVec2& size = ImVec2(0.0f, 0.0f));
+
     // Legacy Columns API (prefer using Tables!)
     // - You can also use SameLine(pos_x) to mimic simplified columns.
     IMGUI_API void          Columns(int count = 1, const char* id = NULL, bool borders = true);
@@ -1679,6 +1698,7 @@ enum ImGuiBackendFlags_
     ImGuiBackendFlags_HasMouseCursors       = 1 << 1,   // Backend Platform supports honoring GetMouseCursor() value to change the OS cursor shape.
     ImGuiBackendFlags_HasSetMousePos        = 1 << 2,   // Backend Platform supports io.WantSetMousePos requests to reposition the OS mouse position (only used if io.ConfigNavMoveSetMousePos is set).
     ImGuiBackendFlags_RendererHasVtxOffset  = 1 << 3,   // Backend Renderer supports ImDrawCmd::VtxOffset. This enables output of large meshes (64K+ vertices) while still using 16-bit indices.
+    ImGuiBackendFlags_RendererHasTexUpdates = 1 << 4,   // Backend Renderer supports partial updates of the font atlas texture (see ImFontAtlas::GetTexUpdateRect()). Required by ImFontAtlasFlags_DynamicGlyphs.
 
     // [BETA] Viewports
     ImGuiBackendFlags_PlatformHasViewports  = 1 << 10,  // Backend Platform supports multiple viewports.
@@ -2372,6 +2392,8 @@ struct ImGuiIO
     bool        ConfigWindowsCopyContentsWithCtrlC; // = false      // [EXPERIMENTAL] CTRL+C copy the contents of focused window into the clipboard. Experimental because: (1) has known issues with nested Begin/End pairs (2) text output quality varies (3) text output is in submission order rather than spatial order.
     bool        ConfigScrollbarScrollByPage;    // = true           // Enable scrolling page by page when clicking outside the scrollbar grab. When disabled, always scroll to clicked location. When enabled, Shift+Click scrolls to clicked location.
     float       ConfigMemoryCompactTimer;       // = 60.0f          // Timer (in seconds) to free transient windows/tables memory buffers when unused. Set to -1.0f to disable.
+    int         ConfigTextSizeCacheSize;        // = 0              // [EXPERIMENTAL] Number of CalcTextSize() results to cache (rounded up to a power of two, 16 bytes each). Labels are measured every frame: this helps most with long, wrapped, non-ASCII or kerned text. Set to 0 to disable.
+    bool        ConfigIniSettingsBinary;        // = false          // [EXPERIMENTAL] Save .ini settings in a compact binary format, which loads in a single pass without text parsing. Loading detects either format. Entries from handlers without binary support are stored as text.
 
     // Inputs Behaviors
     // (other variables, ones which are expected to be tweaked within UI code, are exposed in ImGuiStyle)
@@ -2659,7 +2681,7 @@ struct ImGuiPayload
 };
 
 //-----------------------------------------------------------------------------
-// [SECTION] Helpers (ImGuiOnceUponAFrame, ImGuiTextFilter, ImGuiTextBuffer, ImGuiStorage, ImGuiListClipper, Math Operators, ImColor)
+// [SECTION] Helpers (ImGuiOnceUponAFrame, ImGuiTextFilter, ImGuiTextBuffer, ImGuiStorage, ImGuiListClipper, ImGuiListClipperHeightIndex, ImGuiTextWrapLayout, ImGuiPlotBuffer, Math Operators, ImColor)
 //-----------------------------------------------------------------------------
 
 // Helper: Unicode defines
@@ -2705,6 +2727,50 @@ struct ImGuiTextFilter
     int                     CountGrep;
 };
 
+// Helper: Apply a ImGuiTextFilter to a large number of lines and store the indices of lines passing it, e.g. for a log of millions of lines.
+// - Filter terms are compiled once. Lines are searched with SIMD when available, in chunks spread over worker threads (see IMGUI_ENABLE_THREADS).
+// - Only lines added since the last Update() are tested, unless the filter changed. Lines already tested must not change.
+// - When the filter is refined (e.g. more characters typed in a word, or an exclusion added), only lines which passed the previous filter are tested again.
+// - Without an active filter, GetMatch(n) == n.
+// - The get_line callback is called from worker threads: it must not call ImGui functions.
+// Usage:
+//   index.Update(filter, buf, line_offsets, lines_count);   // Line n is [buf + line_offsets[n], buf + line_offsets[n + 1] - 1), excluding its '\n'.
+//   ImGuiListClipper clipper;
+//   clipper.Begin(index.GetMatchesCount());
+//   while (clipper.Step())
+//       for (int n = clipper.DisplayStart; n < clipper.DisplayEnd; n++)
+//           DrawLine(index.GetMatch(n));
+typedef const char* (*ImGuiTextFilterIndexGetLineFn)(void* user_data, int line_n, const char** out_line_end);
+
+struct ImGuiTextFilterIndex
+{
+    ImVector<int>       Matches;            // Indices of lines passing the filter, in increasing order
+    int                 LinesCount;         // Number of lines tested
+    bool                FilterActive;
+    char                FilterText[256];    // Copy of ImGuiTextFilter::InputBuf used to build Matches
+
+    // [Internal]
+    struct ImGuiTextFilterTerm
+    {
+        int             Offset;             // Offset of term in TermsBuf[]
+        int             Len;
+        bool            Exclude;
+    };
+    ImVector<ImGuiTextFilterTerm> Terms;    // Non-empty terms of the filter
+    char                TermsBuf[256];      // Lower-case copy of FilterText
+    int                 TermsIncludeCount;  // Number of non-excluding terms (== ImGuiTextFilter::CountGrep)
+    ImVector<int>       TempMatches;
+    ImVector<int>       TempCounts;
+
+    ImGuiTextFilterIndex()  { LinesCount = 0; FilterActive = false; FilterText[0] = TermsBuf[0] = 0; TermsIncludeCount = 0; }
+    IMGUI_API void      Clear();                                                                    // Forget all lines, e.g. after clearing a log.
+    IMGUI_API void      Update(const ImGuiTextFilter& filter, const char* buf, const int* line_offsets, int lines_count);
+    IMGUI_API void      Update(const ImGuiTextFilter& filter, int lines_count, ImGuiTextFilterIndexGetLineFn get_line, void* user_data);
+    IMGUI_API bool      PassFilter(const char* text, const char* text_end) const;                  // Same as ImGuiTextFilter::PassFilter() using compiled terms. Thread-safe.
+    int                 GetMatchesCount() const     { return FilterActive ? Matches.Size : LinesCount; }
+    int                 GetMatch(int n) const       { return FilterActive ? Matches[n] : n; }
+};
+
 // Helper: Growable text buffer for logging/accumulating text
 // (this could be called 'ImGuiTextBuilder' / 'ImGuiStringBuilder')
 struct ImGuiTextBuffer
@@ -2727,6 +2793,134 @@ struct ImGuiTextBuffer
     IMGUI_API void      appendfv(const char* fmt, va_list args) IM_FMTLIST(2);
 };
 
+// Helper: Store lines of a log with a fixed memory budget, e.g. for a log/console window receiving millions of lines.
+// - Lines are stored in fixed-size chunks. When the budget is reached, the oldest chunk and its lines are evicted and the chunk
+//   is recycled: existing text is never moved, eviction is O(1) and no allocation happens once all chunks are in use.
+//   Line offsets are stored in the chunks along with text (4 bytes per line), so the budget holds for any line length.
+// - Append() must be called from the thread using the log (generally the main thread). Any thread can call AppendThreadSafe():
+//   text goes through a lock-free queue (multiple producers, single consumer), moved to the log by Drain() once per frame.
+//   Each AppendThreadSafe() call appends whole lines. When the queue is full, the text is dropped and counted in DroppedCount.
+// - Lines are indexed from the oldest line still stored, so indices change when lines are evicted. Call UpdateFilter() every
+//   frame to maintain the list of lines passing a ImGuiTextFilter: only new lines are tested, unless the filter changed.
+//   Without an active filter, GetFilteredLine(n) == n.
+// - Lines longer than the chunk size (minus 4 bytes) are truncated.
+// Usage:
+//   static ImGuiTextLog log;                   // Call log.Init() before starting threads calling AppendThreadSafe()
+//   log.Drain();
+//   log.UpdateFilter(filter);
+//   ImGuiListClipper clipper;
+//   clipper.Begin(log.GetFilteredLinesCount());
+//   while (clipper.Step())
+//       for (int n = clipper.DisplayStart; n < clipper.DisplayEnd; n++)
+//       {
+//           int line_n = log.GetFilteredLine(n);
+//           ImGui::TextUnformatted(log.GetLineBegin(line_n), log.GetLineEnd(line_n));
+//       }
+struct ImGuiTextLogQueue;
+
+struct ImGuiTextLogChunk
+{
+    char*               Data;               // ChunkSize bytes: text grows up from the start, line offsets grow down from the end
+    int                 Size;               // Size of text
+    int                 LinesCount;
+    int*                LineOffsetsEnd;     // End of Data[]. Offset of line n in Data[] is LineOffsetsEnd[-1 - n]
+    ImS64               FirstLine;          // Absolute index of first line (counting evicted lines)
+
+    int                 GetLineOffset(int line_n) const     { IM_ASSERT(line_n >= 0 && line_n < LinesCount); return LineOffsetsEnd[-1 - line_n]; }
+};
+
+struct ImGuiTextLog
+{
+    ImVector<ImGuiTextLogChunk*> Chunks;    // Ring buffer of chunks, oldest is Chunks[ChunksHead]. Chunks are allocated on first use and recycled.
+    int                 ChunksHead;
+    int                 ChunksCount;
+    int                 ChunkSize;
+    ImS64               LinesEvicted;       // Number of lines evicted since last Clear() == absolute index of oldest line
+    ImS64               LinesTotal;         // Number of lines appended since last Clear() == absolute index of next line
+    bool                LastLineOpen;       // Last line doesn't end with a '\n' yet
+    ImS64               DroppedCount;       // Number of AppendThreadSafe() calls dropped because the queue was full
+    ImVector<ImS64>     FilteredLines;      // Absolute indices of lines passing filter, starting from FilteredLines[FilteredHead]
+    int                 FilteredHead;
+    ImS64               FilterNextLine;     // Absolute index of first line not tested by the filter yet
+    bool                FilterActive;
+    char                FilterText[256];    // Copy of ImGuiTextFilter::InputBuf used to build FilteredLines
+    int                 LookupSlot;         // [Internal] Last chunk accessed, to speed up sequential accesses
+    ImGuiTextLogQueue*  Queue;              // [Internal] Queue for AppendThreadSafe()
+
+    ImGuiTextLog()      { ChunksHead = ChunksCount = ChunkSize = 0; LinesEvicted = LinesTotal = DroppedCount = 0; LastLineOpen = false; FilteredHead = 0; FilterNextLine = 0; FilterActive = false; FilterText[0] = 0; LookupSlot = 0; Queue = NULL; }
+    ~ImGuiTextLog()     { Shutdown(); }
+    IMGUI_API void      Init(size_t max_size = 16 * 1024 * 1024, size_t queue_size = 4 * 1024 * 1024, int chunk_size = 64 * 1024); // Called by first Append()/Drain() if not called before.
+    IMGUI_API void      Shutdown();
+    IMGUI_API void      Clear();
+    IMGUI_API void      Append(const char* text, const char* text_end = NULL);
+    IMGUI_API void      Appendf(const char* fmt, ...) IM_FMTARGS(2);
+    IMGUI_API bool      AppendThreadSafe(const char* text, const char* text_end = NULL);   // Can be called from any thread after Init(). Return false if text was dropped.
+    IMGUI_API bool      AppendfThreadSafe(const char* fmt, ...) IM_FMTARGS(2);
+    IMGUI_API void      Drain();                                                            // Move text appended by AppendThreadSafe() to the log.
+    int                 GetLinesCount() const               { return (int)(LinesTotal - LinesEvicted); }
+    IMGUI_API const char* GetLineBegin(int line_n);
+    IMGUI_API const char* GetLineEnd(int line_n);
+    IMGUI_API void      UpdateFilter(const ImGuiTextFilter& filter);
+    int                 GetFilteredLinesCount() const       { return FilterActive ? FilteredLines.Size - FilteredHead : GetLinesCount(); }
+    int                 GetFilteredLine(int n) const        { return FilterActive ? (int)(FilteredLines[FilteredHead + n] - LinesEvicted) : n; }
+};
+
+// Helper: Read-only view of a large text file (e.g. multi-GB logs or CSV files), displayed with ImGui::TextFileView().
+// - The file is memory-mapped: only the parts being viewed or indexed are read. Open() returns immediately, lines are counted
+//   by a background thread (with IMGUI_ENABLE_THREADS, otherwise by Update() within a time budget per frame), and the file can
+//   be viewed while indexing is in progress.
+// - The index stores the number of lines before each block of IndexGranularity bytes: 8 bytes per block, e.g. 512 KB for a
+//   4 GB file with 64 KB blocks. Finding a line scans at most one block. Consecutive lines are found sequentially.
+// - The file must not be modified while it is opened.
+// Usage:
+//   static ImGuiTextFileView view;
+//   if (!view.IsOpen())
+//       view.Open("big.log");
+//   ImGui::TextFileView("##view", &view);
+struct ImGuiTextFileViewIndexer;
+
+struct ImGuiTextFileViewLine
+{
+    ImS64               LineN;
+    ImU64               VisibleOffset;      // Offset of first visible character from start of line, for current horizontal scrolling
+    float               VisibleX;           // Position of first visible character from start of line
+    float               Width;              // Width of line (estimated from its beginning for very long lines)
+};
+
+struct ImGuiTextFileView
+{
+    const char*         Data;               // File contents (not zero-terminated)
+    ImU64               Size;
+    int                 IndexGranularity;   // Size of index blocks, in bytes
+    int                 BlocksCount;
+    int                 BlocksIndexed;      // Number of blocks indexed so far (updated by Update())
+    ImS64               LinesCount;         // Number of lines indexed so far (updated by Update())
+    ImS64               ScrollLine;         // First visible line in TextFileView()
+    float               ScrollLineRemainder;
+    ImS64               HoveredLine;        // Output: line under mouse cursor in TextFileView(), or -1
+    float               MaxLineWidth;       // Width of longest line seen so far. Lines are measured when they become visible.
+    float               MaxLineWidthFontSize;
+
+    // [Internal]
+    ImS64               LookupLine;         // Last line found by GetLineBegin(), to speed up sequential accesses
+    ImU64               LookupOffset;
+    ImVector<ImGuiTextFileViewLine> VisibleLines;   // Horizontal-scroll cache: lines visible last frame
+    ImVector<ImGuiTextFileViewLine> TempLines;
+    ImGuiTextFileViewIndexer* Indexer;
+
+    ImGuiTextFileView() { Data = NULL; Size = 0; IndexGranularity = BlocksCount = BlocksIndexed = 0; LinesCount = ScrollLine = 0; ScrollLineRemainder = 0.0f; HoveredLine = -1; MaxLineWidth = MaxLineWidthFontSize = 0.0f; LookupLine = 0; LookupOffset = 0; Indexer = NULL; }
+    ~ImGuiTextFileView()    { Close(); }
+    IMGUI_API bool      Open(const char* filename, int index_granularity = 64 * 1024);
+    IMGUI_API void      Close();
+    IMGUI_API void      Update();                               // Called by TextFileView(). Update LinesCount with indexing progress.
+    bool                IsOpen() const                          { return Indexer != NULL; }
+    bool                IsIndexing() const                      { return BlocksIndexed < BlocksCount; }
+    float               GetIndexingProgress() const             { return BlocksCount > 0 ? (float)BlocksIndexed / (float)BlocksCount : 1.0f; }
+    ImS64               GetLinesCount() const                   { return LinesCount; }
+    IMGUI_API const char* GetLineBegin(ImS64 line_n);           // line_n < GetLinesCount()
+    IMGUI_API const char* GetLineEnd(ImS64 line_n);             // Excluding '\n'
+};
+
 // [Internal] Key+Value for ImGuiStorage
 struct ImGuiStoragePair
 {
@@ -2812,12 +3006,14 @@ struct ImGuiListClipper
     float           StartPosY;          // [Internal] Cursor position at the time of Begin() or after table frozen rows are all processed
     double          StartSeekOffsetY;   // [Internal] Account for frozen rows in a table and initial loss of precision in very large windows.
     void*           TempData;           // [Internal] Internal data
+    ImGuiListClipperHeightIndex* HeightIndex; // [Internal] Heights of items, when using Begin() with a ImGuiListClipperHeightIndex
 
     // items_count: Use INT_MAX if you don't know how many items you have (in which case the cursor won't be advanced in the final step, and you can call SeekCursorForItem() manually if you need)
     // items_height: Use -1.0f to be calculated automatically on first step. Otherwise pass in the distance between your items, typically GetTextLineHeightWithSpacing() or GetFrameHeightWithSpacing().
     IMGUI_API ImGuiListClipper();
     IMGUI_API ~ImGuiListClipper();
     IMGUI_API void  Begin(int items_count, float items_height = -1.0f);
+    IMGUI_API void  Begin(int items_count, ImGuiListClipperHeightIndex* height_index); // For items of variable height. Items are displayed one by one so the clipper can measure them.
     IMGUI_API void  End();             // Automatically called on the last call of Step() that returns false.
     IMGUI_API bool  Step();            // Call until it returns false. The DisplayStart/DisplayEnd fields will be set and you can process/draw those items.
 
@@ -2838,6 +3034,186 @@ struct ImGuiListClipper
 #endif
 };
 
+// Helper: Heights of items for ImGuiListClipper::Begin(items_count, height_index), to clip large lists of items of variable height.
+// (e.g. chat or log views with wrapped multi-line entries)
+// - Heights are stored in a Fenwick tree (binary indexed tree) of prefix sums, so finding the item at a scrolling offset and the
+//   offset of an item are O(log n). The cost of a frame only depends on the number of visible items.
+// - Items which have never been displayed are assumed to be DefaultHeight high. The clipper measures each item it displays and
+//   updates its height (e.g. after a change of wrap width), so the total height becomes exact as the list is scrolled through.
+// - Keep one instance per list, alive across frames. Items count may change between frames (e.g. appending to a log).
+//   If items are inserted/removed elsewhere than at the end, call Clear() or update heights yourself with SetHeight().
+// Usage:
+//   static ImGuiListClipperHeightIndex heights;
+//   ImGuiListClipper clipper;
+//   clipper.Begin(messages.Size, &heights);
+//   while (clipper.Step())
+//       for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++)
+//           ImGui::TextWrapped("%s", messages[i]);
+struct ImGuiListClipperHeightIndex
+{
+    ImVector<float>     Heights;        // Height of each item, including spacing
+    ImVector<double>    Tree;           // Fenwick tree of Heights[]: Tree[n - 1] is the sum of Heights[] in the (n - lowbit(n), n] range (1-based)
+    float               DefaultHeight;  // Height of items which have not been measured yet. Set to GetTextLineHeightWithSpacing() on first use if <= 0.0f.
+
+    ImGuiListClipperHeightIndex()       { DefaultHeight = 0.0f; }
+    void                Clear()         { Heights.clear(); Tree.clear(); }
+    IMGUI_API void      Resize(int items_count);                // Called by ImGuiListClipper::Begin(). New items are DefaultHeight high.
+    IMGUI_API void      SetHeight(int item_n, float height);
+    IMGUI_API double    GetOffset(int item_n) const;            // Sum of heights of items before 'item_n'.
+    IMGUI_API int       FindItem(double offset) const;          // Return index of the item at given offset from the start of the list (clamped to valid items).
+    double              GetTotalHeight() const                  { return GetOffset(Heights.Size); }
+};
+
+// Helper: Cache line breaks of a word-wrapped text, to display it with ImGuiListClipper.
+// - Displaying a wrapped text with e.g. TextWrapped() needs to scan it from the beginning every frame, so the cost grows with the size
+//   of the text. Instead, call Build() every frame and submit visible lines with ImGuiListClipper + TextUnformatted().
+// - Lines are broken like RenderText()/CalcTextSize() would with the same font, size and wrap width.
+// - Build() only re-wraps what changed. Appended text is detected automatically (e.g. a log). For any other modification of
+//   the text, call NotifyEdit() before the next Build(): lines after the modified range are reused as soon as wrapping catches up with them.
+// - Changing the font, font size or wrap width (e.g. resizing a window) requires a full rebuild.
+// Usage:
+//   layout.Build(ImGui::GetFont(), ImGui::GetFontSize(), ImGui::GetContentRegionAvail().x, buf, buf_end);
+//   ImGuiListClipper clipper;
+//   clipper.Begin(layout.GetLinesCount());
+//   while (clipper.Step())
+//       for (int line_n = clipper.DisplayStart; line_n < clipper.DisplayEnd; line_n++)
+//           ImGui::TextUnformatted(layout.GetLineBegin(buf, line_n), layout.GetLineEnd(buf, line_n));
+struct ImGuiTextWrapLayout
+{
+    ImVector<int>   LineOffsets;        // Offset of the beginning of each line
+    int             TextLen;            // Length of text at the time of last Build(), adjusted by NotifyEdit()
+    int             DirtyBegin;         // Range of text modified by NotifyEdit() since last Build()
+    int             DirtyEnd;
+    ImFont*         Font;               // Parameters of last Build()
+    float           FontSize;
+    float           WrapWidth;
+    int             FontAtlasBuildCount;
+
+    ImGuiTextWrapLayout()               { Clear(); }
+    IMGUI_API void  Clear();
+    IMGUI_API void  Build(ImFont* font, float font_size, float wrap_width, const char* text, const char* text_end = NULL);
+    IMGUI_API void  NotifyEdit(int offset, int removed_len, int inserted_len);     // Call after replacing 'removed_len' bytes at 'offset' with 'inserted_len' bytes.
+    IMGUI_API int   FindLineIndex(int offset) const;                               // Return index of the line containing given text offset.
+    int             GetLinesCount() const                               { return LineOffsets.Size; }
+    const char*     GetLineBegin(const char* text, int line_n) const    { return text + LineOffsets[line_n]; }
+    IMGUI_API const char* GetLineEnd(const char* text, int line_n) const;         // Trailing blanks and line return are excluded.
+};
+
+// Helper: Ring buffer of samples for PlotLines()/PlotHistogram(), with a min/max pyramid.
+// - Plotting from an array or a getter point-samples one value per pixel column (spikes between samples are lost) and scans
+//   every value each frame to auto-scale. With a ImGuiPlotBuffer, each pixel column displays the min..max range of all its
+//   samples, read from the pyramid: cost is O(width * log(n)) per frame regardless of the number of samples.
+// - When the buffer is full, AddValue()/AddValues() overwrite the oldest samples. Prefer AddValues() to append in batches.
+// - Each level of the pyramid stores the min/max of blocks of 8 entries of the level below: memory is 4 bytes per sample + ~14%.
+// - NaN values are ignored, like other plotting functions.
+// Usage:
+//   static ImGuiPlotBuffer buf;
+//   if (buf.Capacity == 0)
+//       buf.Reserve(10000000);
+//   buf.AddValues(new_samples, new_samples_count);
+//   ImGui::PlotLines("Telemetry", &buf);
+struct ImGuiPlotBuffer
+{
+    ImVector<float>     Values;         // Ring buffer of samples
+    ImVector<ImVec2>    Levels;         // All levels of the pyramid above level 0, concatenated. x = min, y = max of the block (FLT_MAX, -FLT_MAX when it has no valid samples)
+    int                 LevelsOffset[12]; // Offset of each level in Levels[]. Level 0 is Values[] itself and isn't stored here.
+    int                 LevelsCount;    // Number of levels, including level 0
+    int                 Capacity;       // Maximum number of samples
+    int                 Count;          // Number of samples (<= Capacity)
+    int                 Head;           // Index in Values[] where the next sample will be written
+
+    ImGuiPlotBuffer()                   { memset(LevelsOffset, 0, sizeof(LevelsOffset)); LevelsCount = Capacity = Count = Head = 0; }
+    IMGUI_API void      Reserve(int capacity);                      // Set capacity and clear samples.
+    IMGUI_API void      Clear();                                    // Clear samples, keep capacity.
+    void                AddValue(float v)                           { AddValues(&v, 1); }
+    IMGUI_API void      AddValues(const float* values, int count);
+    IMGUI_API void      GetMinMax(int idx_begin, int idx_end, float* out_min, float* out_max) const; // Min/max of samples in [idx_begin, idx_end). Set to FLT_MAX, -FLT_MAX if there are no valid samples.
+    float               GetValue(int idx) const                     { IM_ASSERT(idx >= 0 && idx < Count); idx += Head - Count; return Values[idx < 0 ? idx + Capacity : idx]; } // Index 0 is the oldest sample.
+};
+
+// Helper: Sort rows of a table according to ImGuiTableSortSpecs, outputting a permutation of your rows in Indices[].
+// - Register a key getter for each sortable column (identified by ColumnIndex). Getters write the key of row 'idx' into 'out_key',
+//   which points to a value of the registered ImGuiDataType ('const char*' for ImGuiDataType_String).
+// - Keys are extracted once into contiguous arrays (strings are converted to their rank), then rows are sorted with a stable radix sort
+//   for each sort spec, from the last one to the first. With IMGUI_ENABLE_THREADS, sorting uses worker threads (getters are always called from the calling thread).
+// - Keys are cached: when only sort specs changed, rows are sorted again without calling getters. Call SetDataDirty() when your data changed.
+//   Toggling the direction of a single sort spec reverses Indices[] (the order of equal rows is reversed too).
+// - Float/Double keys: -0.0 and +0.0 are equal. NaN values are equal to each other and sort after +INF (last in ascending order, first in descending order).
+// Usage:
+//   static ImGuiTableSorter sorter;
+//   if (sorter.Columns.empty()) { sorter.SetupColumn(0, ImGuiDataType_S32, MyGetID); sorter.SetupColumn(1, ImGuiDataType_String, MyGetName); }
+//   if (ImGuiTableSortSpecs* sort_specs = ImGui::TableGetSortSpecs())
+//       sorter.Sort(sort_specs, items_count, my_data); // Only sort if needed, clear sort_specs->SpecsDirty
+//   [...] display items[sorter.Indices[row_n]]
+typedef void (*ImGuiTableSorterKeyGetter)(void* user_data, int idx, void* out_key);
+
+struct ImGuiTableSorterColumn
+{
+    ImGuiDataType               DataType;
+    ImGuiTableSorterKeyGetter   Getter;         // NULL if column isn't sortable
+    int                         KeysOffset;     // Offset of extracted keys in ImGuiTableSorter::Keys[], -1 if not extracted yet
+};
+
+struct ImGuiTableSorter
+{
+    ImVector<int>                       Indices;        // Output: Indices[n] = index of the row to display at position n
+    ImVector<ImGuiTableSorterColumn>    Columns;        // Indexed by column index
+    ImVector<ImU64>                     Keys;           // Keys of all extracted columns, converted to unsigned integers sorting in the same order
+    ImVector<ImGuiTableColumnSortSpecs> SortedSpecs;    // Copy of sort specs used by last sort
+    int                                 ItemsCount;     // Number of rows when keys were extracted
+    ImVector<int>                       TempIndices;    // Scratch buffers
+    ImVector<ImU64>                     TempKeys[2];
+    ImVector<int>                       TempCounts;
+    ImVector<const char*>               TempStrings;
+
+    ImGuiTableSorter()                  { ItemsCount = 0; }
+    IMGUI_API void  SetupColumn(int column_index, ImGuiDataType data_type, ImGuiTableSorterKeyGetter getter);
+    void            SetDataDirty()      { Keys.resize(0); for (int n = 0; n < Columns.Size; n++) Columns[n].KeysOffset = -1; ItemsCount = -1; } // Your data changed: keys will be extracted again on next Sort().
+    IMGUI_API bool  Sort(ImGuiTableSortSpecs* sort_specs, int items_count, void* user_data); // Sort if data or sort specs changed, clear sort_specs->SpecsDirty. Return true if Indices[] was modified.
+    IMGUI_API void  SortWithSpecs(const ImGuiTableColumnSortSpecs* specs, int specs_count, int items_count, void* user_data); // Sort unconditionally
+};
+
+// Helper: State of a VirtualGrid(): a scrolling grid of any number of rows and columns, only submitting visible cells.
+// - All rows have the same height. Column widths are stored in an ImGuiListClipperHeightIndex (prefix sums), so visible columns
+//   are found in O(log n) whatever the number of columns.
+// - CellFn() is called for each visible cell, with the cursor at the top-left of the cell (after CellPadding). Cells are submitted
+//   column by column, each column with its own clipping rectangle: this doesn't use draw channels, and consecutive cells of a column
+//   are merged in a same draw command.
+// - Supported flags: ImGuiTableFlags_RowBg, ImGuiTableFlags_Borders*, ImGuiTableFlags_Resizable (drag the right border of a column).
+// - The headers row (if HeaderFn is set) and the FrozenColumns leftmost columns stay visible while scrolling.
+// Usage:
+//   static ImGuiVirtualGrid grid;
+//   grid.RowsCount = 1000000;
+//   grid.ColumnsCount = 5000;
+//   grid.CellFn = [](void* user_data, int row_n, int column_n) { ImGui::Text("%.3f", ((MyMatrix*)user_data)->Get(row_n, column_n)); };
+//   grid.UserData = &my_matrix;
+//   ImGui::VirtualGrid("##matrix", &grid, ImVec2(0.0f, 400.0f));
+typedef void        (*ImGuiVirtualGridCellFn)(void* user_data, int row_n, int column_n);
+typedef const char* (*ImGuiVirtualGridHeaderFn)(void* user_data, int column_n);
+
+struct ImGuiVirtualGrid
+{
+    int                         RowsCount;
+    int                         ColumnsCount;
+    int                         FrozenColumns;      // Number of leftmost columns staying visible when scrolling horizontally
+    float                       RowHeight;          // Height of all rows, including CellPadding. Default to GetFrameHeight() if <= 0.0f.
+    ImGuiListClipperHeightIndex ColumnWidths;       // Width of each column, in ColumnWidths.Heights[]. New columns are ColumnWidths.DefaultHeight wide (default to 8 * font size if <= 0.0f).
+    ImGuiTableFlags             Flags;
+    ImGuiVirtualGridCellFn      CellFn;             // Submit contents of a cell
+    ImGuiVirtualGridHeaderFn    HeaderFn;           // Optional: return the label of a column. The headers row is only displayed if this is set.
+    void*                       UserData;
+
+    // [Output] Updated by VirtualGrid()
+    int                         DisplayRowStart;    // Range of visible rows
+    int                         DisplayRowEnd;
+    int                         DisplayColumnStart; // Range of visible (non-frozen) columns
+    int                         DisplayColumnEnd;
+    int                         HoveredRow;         // Row under mouse cursor, -1 if none or if hovering the headers row
+    int                         HoveredColumn;      // Column under mouse cursor, -1 if none
+
+    ImGuiVirtualGrid()          { RowsCount = ColumnsCount = FrozenColumns = 0; RowHeight = 0.0f; Flags = 0; CellFn = NULL; HeaderFn = NULL; UserData = NULL; DisplayRowStart = DisplayRowEnd = DisplayColumnStart = DisplayColumnEnd = 0; HoveredRow = HoveredColumn = -1; }
+};
+
 // Helpers: ImVec2/ImVec4 operators
 // - It is important that we are keeping those disabled by default so they don't leak in user space.
 // - This is in order to allow user enabling implicit cast operators between ImVec2/ImVec4 and their own types (using IM_VEC2_CLASS_EXTRA in imconfig.h)
@@ -3125,13 +3501,42 @@ struct ImDrawCmd
 };
 
 // Vertex layout
-#ifndef IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT
+#if !defined(IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT) && !defined(IMGUI_USE_COMPACT_DRAWVERT)
 struct ImDrawVert
 {
     ImVec2  pos;
     ImVec2  uv;
     ImU32   col;
 };
+#elif !defined(IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT)
+// Compact 12 bytes layout, enabled by defining IMGUI_USE_COMPACT_DRAWVERT in imconfig.h. Needs backend support (see imgui_impl_opengl3.cpp).
+// - pos is stored as signed 16-bit fixed point with IMGUI_COMPACT_DRAWVERT_POS_FRAC_BITS fractional bits (default 2: 1/4 pixel precision, coordinates within +/-8192).
+//   Coordinates outside of that range are clamped, which may distort shapes straddling the limit. Use on single viewport or with DisplayPos-relative coordinates.
+// - uv is stored as unsigned normalized 16-bit, clamped to 0.0f..1.0f: textures cannot be repeated by using UV outside of that range.
+// Both fields convert from/to ImVec2, e.g. 'vtx.pos = ImVec2(x, y)' and 'ImVec2 p = vtx.pos'. They don't expose float .x/.y members.
+#ifndef IMGUI_COMPACT_DRAWVERT_POS_FRAC_BITS
+#define IMGUI_COMPACT_DRAWVERT_POS_FRAC_BITS    2
+#endif
+struct ImDrawVertPos
+{
+    ImS16   Fixed[2];
+    static ImS16    Pack(float v)                       { v = v * (float)(1 << IMGUI_COMPACT_DRAWVERT_POS_FRAC_BITS) + 32768.5f; v = (v < 0.0f) ? 0.0f : (v > 65535.0f) ? 65535.0f : v; return (ImS16)((int)v - 32768); }
+    ImDrawVertPos&  operator=(const ImVec2& v)          { Fixed[0] = Pack(v.x); Fixed[1] = Pack(v.y); return *this; }
+    operator        ImVec2() const                      { const float scale = 1.0f / (float)(1 << IMGUI_COMPACT_DRAWVERT_POS_FRAC_BITS); return ImVec2(Fixed[0] * scale, Fixed[1] * scale); }
+};
+struct ImDrawVertUV
+{
+    ImU16   Unorm[2];
+    static ImU16    Pack(float v)                       { v = v * 65535.0f + 0.5f; v = (v < 0.0f) ? 0.0f : (v > 65535.0f) ? 65535.0f : v; return (ImU16)(int)v; }
+    ImDrawVertUV&   operator=(const ImVec2& v)          { Unorm[0] = Pack(v.x); Unorm[1] = Pack(v.y); return *this; }
+    operator        ImVec2() const                      { const float scale = 1.0f / 65535.0f; return ImVec2(Unorm[0] * scale, Unorm[1] * scale); }
+};
+struct ImDrawVert
+{
+    ImDrawVertPos   pos;
+    ImDrawVertUV    uv;
+    ImU32           col;
+};
 #else
 // You can override the vertex format layout by defining IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT in imconfig.h
 // The code expect ImVec2 pos (8 bytes), ImVec2 uv (8 bytes), ImU32 col (4 bytes), but you can re-order them or add other fields as needed to simplify integration in your engine.
@@ -3411,6 +3816,9 @@ struct ImFontConfig
     float           RasterizerMultiply;     // 1.0f     // Linearly brighten (>1.0f) or darken (<1.0f) font output. Brightening small fonts may be a good workaround to make them more readable. This is a silly thing we may remove in the future.
     float           RasterizerDensity;      // 1.0f     // DPI scale for rasterization, not altering other font metrics: make it easy to swap between e.g. a 100% and a 400% fonts for a zooming display, or handle Retina screen. IMPORTANT: If you change this it is expected that you increase/decrease font scale roughly to the inverse of this, otherwise quality may look lowered.
     ImWchar         EllipsisChar;           // 0        // Explicitly specify Unicode codepoint of ellipsis character. When fonts are being merged first specified ellipsis will be used.
+    bool            Kerning;                // false    // Adjust spacing between pairs of characters using the font 'GPOS'/'kern' tables (stb_truetype builder only). Applied by CalcTextSize(), text rendering and InputText().
+    bool            SDF;                    // false    // Bake glyphs as signed distance fields (stb_truetype builder only). They can be drawn sharply at any scale, so one font can replace multiple sizes. Requires a renderer backend setting io.Fonts->TexIDSDF. Oversampling and RasterizerMultiply are ignored.
+    int             SDFPadding;             // 4        // SDF: distance range in pixels around glyph edges. Larger values allow stronger downscaling, at the cost of texture space.
 
     // [Internal]
     char            Name[40];               // Name (strictly to ease debugging)
@@ -3431,6 +3839,14 @@ struct ImFontGlyph
     float           U0, V0, U1, V1;     // Texture coordinates
 };
 
+// Advance adjustment applied between two consecutive characters, in ImFont::KerningPairs[].
+struct ImFontKerningPair
+{
+    ImWchar         Left;               // 0 for empty slots
+    ImWchar         Right;
+    float           AdvanceX;           // Added to the advance of 'Left' when followed by 'Right'. Usually negative.
+};
+
 // Helper to build glyph ranges from text/string data. Feed your application strings/characters to it then call BuildRanges().
 // This is essentially a tightly packed of vector of 64k booleans = 8KB storage.
 struct ImFontGlyphRangesBuilder
@@ -3470,6 +3886,33 @@ enum ImFontAtlasFlags_
     ImFontAtlasFlags_NoPowerOfTwoHeight = 1 << 0,   // Don't round the height to next power of two
     ImFontAtlasFlags_NoMouseCursors     = 1 << 1,   // Don't build software mouse cursors into the atlas (save a little texture memory)
     ImFontAtlasFlags_NoBakedLines       = 1 << 2,   // Don't build thick line textures into the atlas (save a little texture memory, allow support for point/nearest filtering). The AntiAliasedLinesUseTex features uses them, otherwise they will be rendered using polygons (more expensive for CPU/GPU).
+    ImFontAtlasFlags_DynamicGlyphs      = 1 << 3,   // Only bake Basic Latin + Latin-1 glyphs during Build(), rasterize other requested glyphs on first use into a reserved texture area (evicting least recently used ones). Requires stb_truetype builder + a backend with ImGuiBackendFlags_RendererHasTexUpdates. Keep input data: don't call ClearInputData()/ClearTexData() after building.
+};
+
+// Timings and counters of the last ImFontAtlas::Build() call (filled by the stb_truetype builder or the cache loader). Timings are in milliseconds.
+struct ImFontAtlasBuildStats
+{
+    float           TimeInit;           // Parse font data and collect requested codepoints
+    float           TimeGather;         // Measure glyph bounding boxes
+    float           TimePack;           // Pack rectangles
+    float           TimeRender;         // Rasterize glyphs into the texture (spread across worker threads when IMGUI_ENABLE_THREADS is defined)
+    float           TimeSetup;          // Register glyphs into ImFont and build lookup tables
+    float           TimeTotal;
+    int             GlyphsCount;
+    int             KerningPairsCount;  // Total kerning pairs of all fonts (ImFontConfig::Kerning)
+    int             RenderJobsCount;    // Number of chunks the render phase was split into
+    int             RenderThreadsCount; // Number of threads used by the render phase
+    bool            LoadedFromCache;    // Atlas was reloaded from CacheFilename (only TimeTotal is measured)
+
+    // ImFontAtlasFlags_DynamicGlyphs (updated every frame)
+    int             DynamicGlyphsAvailable;     // Glyphs which may be rasterized on demand
+    int             DynamicGlyphsResident;      // Glyphs currently stored in the dynamic area
+    int             DynamicGlyphsRasterized;    // Total glyphs rasterized on demand
+    int             DynamicPagesCount;
+    int             DynamicPagesEvicted;        // Total pages evicted to make room for new glyphs
+    float           TimeDynamic;                // Time spent rasterizing glyphs during the last ImGui::NewFrame()
+
+    ImFontAtlasBuildStats()     { memset(this, 0, sizeof(*this)); }
 };
 
 // Load and rasterize multiple TTF/OTF fonts into a same texture. The font atlas will build a single texture holding:
@@ -3515,6 +3958,12 @@ struct ImFontAtlas
     bool                        IsBuilt() const             { return Fonts.Size > 0 && TexReady; } // Bit ambiguous: used to detect when user didn't build texture but effectively we should check TexID != 0 except that would be backend dependent...
     void                        SetTexID(ImTextureID id)    { TexID = id; }
 
+    // Partial texture updates (ImFontAtlasFlags_DynamicGlyphs)
+    // Texture data is modified by ImGui::NewFrame() when glyphs are rasterized on demand. Renderer backends (with ImGuiBackendFlags_RendererHasTexUpdates)
+    // should upload the dirty region of the pixels returned by GetTexData*** before rendering, then call ClearTexUpdateRect().
+    bool                        GetTexUpdateRect(int* out_x, int* out_y, int* out_w, int* out_h) const { if (TexUpdateRect[2] <= TexUpdateRect[0]) return false; *out_x = TexUpdateRect[0]; *out_y = TexUpdateRect[1]; *out_w = TexUpdateRect[2] - TexUpdateRect[0]; *out_h = TexUpdateRect[3] - TexUpdateRect[1]; return true; }
+    void                        ClearTexUpdateRect()        { TexUpdateRect[0] = TexUpdateRect[1] = TexUpdateRect[2] = TexUpdateRect[3] = 0; }
+
     //-------------------------------------------
     // Glyph Ranges
     //-------------------------------------------
@@ -3558,14 +4007,17 @@ struct ImFontAtlas
     // Input
     ImFontAtlasFlags            Flags;              // Build flags (see ImFontAtlasFlags_)
     ImTextureID                 TexID;              // User data to refer to the texture once it has been uploaded to user's graphic systems. It is passed back to you during rendering via the ImDrawCmd structure.
+    ImTextureID                 TexIDSDF;           // Passed in ImDrawCmd for text using SDF fonts (ImFontConfig::SDF). Set by renderer backends supporting them: refers to the same texture as TexID, telling the backend to use a distance field shader.
     int                         TexDesiredWidth;    // Texture width desired by user before Build(). Must be a power-of-two. If have many glyphs your graphics API have texture size restrictions you may want to increase texture width to decrease height.
     int                         TexGlyphPadding;    // FIXME: Should be called "TexPackPadding". Padding between glyphs within texture in pixels. Defaults to 1. If your rendering method doesn't rely on bilinear filtering you may set this to 0 (will also need to set AntiAliasedLinesUseTex = false).
     void*                       UserData;           // Store your own atlas related user-data (if e.g. you have multiple font atlas).
+    const char*                 CacheFilename;      // = NULL // Path to a baked atlas cache file. When set, Build() reloads the atlas from it if all inputs match (fonts data, sizes, ranges, flags...), otherwise builds then saves it. String must persist.
 
     // [Internal]
     // NB: Access texture data via GetTexData*() calls! Which will setup a default font for you.
     bool                        Locked;             // Marked as Locked by ImGui::NewFrame() so attempt to modify the atlas will assert.
     bool                        TexReady;           // Set when texture was built matching current font input
+    int                         BuildCount;         // Incremented every time fonts are built or loaded from cache (e.g. to invalidate data derived from fonts)
     bool                        TexPixelsUseColors; // Tell whether our texture data is known to use colors (rather than just alpha channel), in order to help backend select a format.
     unsigned char*              TexPixelsAlpha8;    // 1 component per pixel, each component is unsigned 8-bit. Total size = TexWidth * TexHeight
     unsigned int*               TexPixelsRGBA32;    // 4 component per pixel, each component is unsigned 8-bit. Total size = TexWidth * TexHeight * 4
@@ -3577,6 +4029,8 @@ struct ImFontAtlas
     ImVector<ImFontAtlasCustomRect> CustomRects;    // Rectangles for packing custom texture data into the atlas.
     ImVector<ImFontConfig>      Sources;            // Source/configuration data
     ImVec4                      TexUvLines[IM_DRAWLIST_TEX_LINES_WIDTH_MAX + 1];  // UVs for baked anti-aliased lines
+    int                         TexUpdateRect[4];   // Texture region modified since last ClearTexUpdateRect() (x0, y0, x1, y1), empty when x1 <= x0.
+    ImFontAtlasDynamicData*     DynamicData;        // Glyphs rasterized on demand (ImFontAtlasFlags_DynamicGlyphs), NULL otherwise.
 
     // [Internal] Font builder
     const ImFontBuilderIO*      FontBuilderIO;      // Opaque interface to a font builder (default to stb_truetype, can be changed to use FreeType by defining IMGUI_ENABLE_FREETYPE).
@@ -3585,6 +4039,7 @@ struct ImFontAtlas
     // [Internal] Packing data
     int                         PackIdMouseCursors; // Custom texture rectangle ID for white pixel and mouse cursors
     int                         PackIdLines;        // Custom texture rectangle ID for baked anti-aliased lines
+    ImFontAtlasBuildStats       BuildStats;         // Timings of the last Build(), displayed in Metrics/Debugger window
 
     // [Obsolete]
     //typedef ImFontAtlasCustomRect    CustomRect;              // OBSOLETED in 1.72+
@@ -3619,7 +4074,15 @@ struct ImFont
     float                       Ascent, Descent;    // 4+4   // out // Ascent: distance from top to bottom of e.g. 'A' [0..FontSize] (unscaled)
     int                         MetricsTotalSurface;// 4     // out // Total surface in pixels to get an idea of the font rasterization/texture cost (not exact, we approximate the cost of padding between glyphs)
     bool                        DirtyLookupTables;  // 1     // out //
+    bool                        SDF;                // 1     // out // Glyphs are signed distance fields (ImFontConfig::SDF)
     ImU8                        Used8kPagesMap[(IM_UNICODE_CODEPOINT_MAX+1)/8192/8]; // 1 bytes if ImWchar=ImWchar16, 16 bytes if ImWchar==ImWchar32. Store 1-bit for each block of 4K codepoints that has one active glyph. This is mainly used to facilitate iterations across all used codepoints.
+    ImVector<ImFontKerningPair> KerningPairs;       // 12-16 // out // Hash table of kerning pairs (open addressing, power-of-two size, at most a quarter full). Empty if no source uses ImFontConfig::Kerning.
+
+    // [Internal] Members: Dynamic glyphs (ImFontAtlasFlags_DynamicGlyphs)
+    ImVector<ImU8>              DynamicIndexSrc;    // 12-16 // out // Sparse. 1 + index of the source able to rasterize a code-point on demand, 0 if none. 0x80 bit set while queued.
+    ImVector<ImU8>              DynamicGlyphsPage;  // 12-16 // out // Glyphs[] index -> page of the atlas dynamic area, 0xFF for glyphs baked by Build().
+    ImVector<ImU16>             DynamicFreeGlyphs;  // 12-16 // out // Glyphs[] slots released by evicted glyphs.
+    ImFontGlyph                 DynamicPendingGlyph;//       // out // Returned by FindGlyph() while a glyph is queued: invisible, with correct AdvanceX.
 
     // Methods
     IMGUI_API ImFont();
@@ -3627,6 +4090,7 @@ struct ImFont
     IMGUI_API ImFontGlyph*      FindGlyph(ImWchar c);
     IMGUI_API ImFontGlyph*      FindGlyphNoFallback(ImWchar c);
     float                       GetCharAdvance(ImWchar c)       { return ((int)c < IndexAdvanceX.Size) ? IndexAdvanceX[(int)c] : FallbackAdvanceX; }
+    IMGUI_API float             GetCharKerning(ImWchar c_prev, ImWchar c) const; // Adjustment to the advance of 'c_prev' when followed by 'c' (unscaled). 0.0f when the font has no kerning.
     bool                        IsLoaded() const                { return ContainerAtlas != NULL; }
     const char*                 GetDebugName() const            { return Sources ? Sources->Name : "<unknown>"; }
 
@@ -2052,6 +2052,35 @@ static void DemoWindowWidgetsPlotting()
         ImGui::PlotLines("Lines##2", func, NULL, display_count, 0, NULL, -1.0f, 1.0f, ImVec2(0, 80));
         ImGui::PlotHistogram("Histogram##2", func, NULL, display_count, 0, NULL, -1.0f, 1.0f, ImVec2(0, 80));
 
+        // Use ImGuiPlotBuffer to plot millions of samples
+        // Each pixel column displays the min..max range of its samples, so isolated spikes are always visible.
+        ImGui::SeparatorText("Large data (ImGuiPlotBuffer)");
+        static ImGuiPlotBuffer plot_buffer;
+        static int samples_per_frame = 20000;
+        if (plot_buffer.Capacity == 0)
+            plot_buffer.Reserve(2000000);
+        ImGui::SetNextItemWidth(ImGui::GetFontSize() * 8);
+        ImGui::SliderInt("Samples per frame", &samples_per_frame, 0, 100000);
+        if (animate && samples_per_frame > 0)
+        {
+            static ImVector<float> new_samples;
+            static unsigned int seed = 1;
+            static float phase = 0.0f;
+            new_samples.resize(samples_per_frame);
+            for (float& v : new_samples)
+            {
+                seed = seed * 1664525u + 1013904223u;
+                v = sinf(phase) * 0.5f + (float)(seed >> 8) / (float)(1 << 24) * 0.1f;
+                if ((seed >> 8) % 200000 == 0) // Rare spikes
+                    v += 1.0f;
+                phase += 0.00001f;
+            }
+            plot_buffer.AddValues(new_samples.Data, new_samples.Size);
+        }
+        ImGui::Text("%d / %d samples", plot_buffer.Count, plot_buffer.Capacity);
+        ImGui::PlotLines("Lines##3", &plot_buffer, NULL, FLT_MAX, FLT_MAX, ImVec2(0, 80));
+        ImGui::PlotHistogram("Histogram##3", &plot_buffer, NULL, FLT_MAX, FLT_MAX, ImVec2(0, 80));
+
         ImGui::TreePop();
     }
 }
@@ -3643,6 +3672,32 @@ static void DemoWindowWidgetsText()
             ImGui::InputText("UTF-8 input", buf, IM_ARRAYSIZE(buf));
             ImGui::TreePop();
         }
+
+        IMGUI_DEMO_MARKER("Widgets/Text/Large Text File");
+        if (ImGui::TreeNode("Large Text File"))
+        {
+            // ImGuiTextFileView memory-maps a file and indexes its lines in the background: opening is immediate even for
+            // multi-GB files, and TextFileView() can display the file while indexing is in progress.
+            static ImGuiTextFileView view;
+            static char filename[256] = "imgui.ini";
+            static bool open_failed = false;
+            ImGui::SetNextItemWidth(ImGui::GetFontSize() * 20);
+            ImGui::InputText("##filename", filename, IM_ARRAYSIZE(filename));
+            ImGui::SameLine();
+            if (ImGui::Button("Open"))
+                open_failed = !view.Open(filename);
+            ImGui::SameLine();
+            if (open_failed)
+                ImGui::TextColored(ImVec4(1.0f, 0.4f, 0.4f, 1.0f), "Error opening file.");
+            else if (view.IsIndexing())
+                ImGui::Text("Indexing... %.0f%%, %lld lines", view.GetIndexingProgress() * 100.0f, (long long)view.GetLinesCount());
+            else if (view.IsOpen())
+                ImGui::Text("%lld lines, %.1f MB", (long long)view.GetLinesCount(), view.Size / (1024.0 * 1024.0));
+            ImGui::TextFileView("##view", &view, ImVec2(0.0f, ImGui::GetTextLineHeight() * 16));
+            if (view.HoveredLine >= 0)
+                ImGui::SetItemTooltip("Line %lld", (long long)view.HoveredLine + 1);
+            ImGui::TreePop();
+        }
         ImGui::TreePop();
     }
 }
@@ -3670,6 +3725,36 @@ static void DemoWindowWidgetsTextFilter()
         for (int i = 0; i < IM_ARRAYSIZE(lines); i++)
             if (filter.PassFilter(lines[i]))
                 ImGui::BulletText("%s", lines[i]);
+
+        // Use ImGuiTextLog to store a large log with a fixed memory budget, and filter it incrementally.
+        // AppendThreadSafe()/AppendfThreadSafe() may be called from any thread, lines are moved to the log by Drain().
+        ImGui::SeparatorText("Large log (ImGuiTextLog)");
+        static ImGuiTextLog log;
+        static int lines_per_frame = 1000;
+        if (log.Chunks.Size == 0)
+            log.Init(8 * 1024 * 1024);
+        ImGui::SetNextItemWidth(ImGui::GetFontSize() * 8);
+        ImGui::SliderInt("Lines per frame", &lines_per_frame, 0, 20000);
+        static int line_counter = 0;
+        for (int n = 0; n < lines_per_frame; n++, line_counter++)
+            log.AppendfThreadSafe("[%05d] %s message %d", ImGui::GetFrameCount() % 100000, (line_counter % 3) ? "info" : "warning", line_counter);
+        log.Drain();
+        log.UpdateFilter(filter);
+        ImGui::Text("%d lines stored (%d shown), %d evicted, %d dropped", log.GetLinesCount(), log.GetFilteredLinesCount(), (int)log.LinesEvicted, (int)log.DroppedCount);
+        if (ImGui::BeginChild("##log", ImVec2(0.0f, ImGui::GetTextLineHeightWithSpacing() * 10), ImGuiChildFlags_Borders))
+        {
+            ImGuiListClipper clipper;
+            clipper.Begin(log.GetFilteredLinesCount());
+            while (clipper.Step())
+                for (int n = clipper.DisplayStart; n < clipper.DisplayEnd; n++)
+                {
+                    const int line_n = log.GetFilteredLine(n);
+                    ImGui::TextUnformatted(log.GetLineBegin(line_n), log.GetLineEnd(line_n));
+                }
+            if (ImGui::GetScrollY() >= ImGui::GetScrollMaxY())
+                ImGui::SetScrollHereY(1.0f);
+        }
+        ImGui::EndChild();
         ImGui::TreePop();
     }
 }
@@ -6281,6 +6366,51 @@ static void DemoWindowTables()
         ImGui::TreePop();
     }
 
+    if (open_action != -1)
+        ImGui::SetNextItemOpen(open_action != 0);
+    IMGUI_DEMO_MARKER("Tables/Virtual grid");
+    if (ImGui::TreeNode("Virtual grid"))
+    {
+        HelpMarker(
+            "VirtualGrid() displays a grid of any number of rows and columns, only submitting visible cells through a callback. "
+            "Columns have no state besides their width, so the cost doesn't depend on the number of columns "
+            "(BeginTable() is limited to 512 columns).\n\n"
+            "Here: 1,000,000 rows x 5,000 columns.");
+        static ImGuiVirtualGrid grid;
+        if (grid.CellFn == NULL)
+        {
+            grid.RowsCount = 1000000;
+            grid.ColumnsCount = 5000;
+            grid.FrozenColumns = 1;
+            grid.Flags = ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_Resizable;
+            grid.CellFn = [](void*, int row_n, int column_n)
+            {
+                if (column_n == 0)
+                    ImGui::Text("Row %d", row_n);
+                else
+                    ImGui::Text("%.2f", (float)((row_n * 31 + column_n * 17) % 1000) * 0.01f);
+            };
+            grid.HeaderFn = [](void*, int column_n)
+            {
+                static char label[32];
+                snprintf(label, IM_ARRAYSIZE(label), "Sensor %d", column_n);
+                return (const char*)label;
+            };
+        }
+        PushStyleCompact();
+        ImGui::CheckboxFlags("ImGuiTableFlags_RowBg", &grid.Flags, ImGuiTableFlags_RowBg);
+        ImGui::CheckboxFlags("ImGuiTableFlags_Borders", &grid.Flags, ImGuiTableFlags_Borders);
+        ImGui::CheckboxFlags("ImGuiTableFlags_Resizable", &grid.Flags, ImGuiTableFlags_Resizable);
+        ImGui::SetNextItemWidth(ImGui::GetFrameHeight());
+        ImGui::DragInt("FrozenColumns", &grid.FrozenColumns, 0.2f, 0, 9, NULL, ImGuiSliderFlags_NoInput);
+        PopStyleCompact();
+
+        ImGui::VirtualGrid("##grid", &grid, ImVec2(0.0f, TEXT_BASE_HEIGHT * 15));
+        ImGui::Text("Visible: rows %d..%d, columns %d..%d. Hovered: row %d, column %d",
+            grid.DisplayRowStart, grid.DisplayRowEnd, grid.DisplayColumnStart, grid.DisplayColumnEnd, grid.HoveredRow, grid.HoveredColumn);
+        ImGui::TreePop();
+    }
+
     if (open_action != -1)
         ImGui::SetNextItemOpen(open_action != 0);
     IMGUI_DEMO_MARKER("Tables/Columns flags");
@@ -9057,12 +9187,16 @@ struct ExampleAppLog
 {
     ImGuiTextBuffer     Buf;
     ImGuiTextFilter     Filter;
+    ImGuiTextFilterIndex FilterIndex; // Index to lines passing Filter.
     ImVector<int>       LineOffsets; // Index to lines offset. We maintain this with AddLog() calls.
+    ImGuiTextWrapLayout WrapLayout;  // Index to wrapped lines offset, when WrapText is enabled.
     bool                AutoScroll;  // Keep scrolling if already at the bottom.
+    bool                WrapText;
 
     ExampleAppLog()
     {
         AutoScroll = true;
+        WrapText = false;
         Clear();
     }
 
@@ -9071,6 +9205,8 @@ struct ExampleAppLog
         Buf.clear();
         LineOffsets.clear();
         LineOffsets.push_back(0);
+        FilterIndex.Clear();
+        WrapLayout.Clear();
     }
 
     void    AddLog(const char* fmt, ...) IM_FMTARGS(2)
@@ -9097,6 +9233,7 @@ struct ExampleAppLog
         if (ImGui::BeginPopup("Options"))
         {
             ImGui::Checkbox("Auto-scroll", &AutoScroll);
+            ImGui::Checkbox("Wrap text", &WrapText);
             ImGui::EndPopup();
         }
 
@@ -9124,17 +9261,33 @@ struct ExampleAppLog
             const char* buf_end = Buf.end();
             if (Filter.IsActive())
             {
-                // In this example we don't use the clipper when Filter is enabled.
-                // This is because we don't have random access to the result of our filter.
-                // A real application processing logs with ten of thousands of entries may want to store the result of
-                // search/filter.. especially if the filtering function is not trivial (e.g. reg-exp).
-                for (int line_no = 0; line_no < LineOffsets.Size; line_no++)
+                // ImGuiTextFilterIndex stores the indices of lines passing the filter, which gives us random access to
+                // the result of our filter, so we can use the clipper. It only tests lines added since the last frame,
+                // unless the filter changed. We only pass complete lines: the last line is tested once it ends with '\n'.
+                FilterIndex.Update(Filter, buf, LineOffsets.Data, LineOffsets.Size - 1);
+                ImGuiListClipper clipper;
+                clipper.Begin(FilterIndex.GetMatchesCount());
+                while (clipper.Step())
                 {
-                    const char* line_start = buf + LineOffsets[line_no];
-                    const char* line_end = (line_no + 1 < LineOffsets.Size) ? (buf + LineOffsets[line_no + 1] - 1) : buf_end;
-                    if (Filter.PassFilter(line_start, line_end))
-                        ImGui::TextUnformatted(line_start, line_end);
+                    for (int n = clipper.DisplayStart; n < clipper.DisplayEnd; n++)
+                    {
+                        const int line_no = FilterIndex.GetMatch(n);
+                        ImGui::TextUnformatted(buf + LineOffsets[line_no], buf + LineOffsets[line_no + 1] - 1);
+                    }
                 }
+                clipper.End();
+            }
+            else if (WrapText)
+            {
+                // Same as below, but lines are word-wrapped. ImGuiTextWrapLayout maintains the offsets of wrapped lines.
+                // It only processes text added since the last frame, unless the font or the window width changed.
+                WrapLayout.Build(ImGui::GetFont(), ImGui::GetFontSize(), ImGui::GetContentRegionAvail().x, buf, buf_end);
+                ImGuiListClipper clipper;
+                clipper.Begin(WrapLayout.GetLinesCount());
+                while (clipper.Step())
+                    for (int line_no = clipper.DisplayStart; line_no < clipper.DisplayEnd; line_no++)
+                        ImGui::TextUnformatted(WrapLayout.GetLineBegin(buf, line_no), WrapLayout.GetLineEnd(buf, line_no));
+                clipper.End();
             }
             else
             {
@@ -9448,7 +9601,8 @@ static void ShowExampleAppLongText(bool* p_open)
     ImGui::Combo("Test type", &test_type,
         "Single call to TextUnformatted()\0"
         "Multiple calls to Text(), clipped\0"
-        "Multiple calls to Text(), not clipped (slow)\0");
+        "Multiple calls to Text(), not clipped (slow)\0"
+        "Multiple calls to TextWrapped(), variable height, clipped\0");
     ImGui::Text("Buffer contents: %d lines, %d bytes", lines, log.size());
     if (ImGui::Button("Clear")) { log.clear(); lines = 0; }
     ImGui::SameLine();
@@ -9484,6 +9638,20 @@ static void ShowExampleAppLongText(bool* p_open)
             ImGui::Text("%i The quick brown fox jumps over the lazy dog", i);
         ImGui::PopStyleVar();
         break;
+    case 3:
+        {
+            // Multiple calls to TextWrapped(), with lines of different lengths, manually coarsely clipped.
+            // ImGuiListClipperHeightIndex stores the height of each line, as measured by the clipper when the line is displayed.
+            static ImGuiListClipperHeightIndex heights;
+            ImGui::PushStyleVar(ImGuiStyleVar_ItemSpacing, ImVec2(0, 0));
+            ImGuiListClipper clipper;
+            clipper.Begin(lines, &heights);
+            while (clipper.Step())
+                for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++)
+                    ImGui::TextWrapped("%i The quick brown fox jumps over the lazy dog%s", i, (i % 5 == 0) ? ". The five boxing wizards jump quickly. How vexingly quick daft zebras jump! Pack my box with five dozen liquor jugs." : "");
+            ImGui::PopStyleVar();
+            break;
+        }
     }
     ImGui::EndChild();
     ImGui::End();
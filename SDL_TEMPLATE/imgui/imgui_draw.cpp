@@ -133,10 +133,21 @@ namespace IMGUI_STB_NAMESPACE
 #endif
 
 #ifdef  IMGUI_ENABLE_STB_TRUETYPE
+// Glyphs may be rasterized from worker threads (see ImParallelFor()), where we cannot use IM_ALLOC()/IM_FREE().
+// Worker threads set stbtt_fontinfo::userdata to an allocator obtained from ImGui::GetAllocatorFunctions(). It is NULL everywhere else.
+struct ImFontBuildThreadAllocator
+{
+    ImGuiMemAllocFunc   AllocFunc;
+    ImGuiMemFreeFunc    FreeFunc;
+    void*               UserData;
+};
+static inline void* ImFontAtlasBuildStbttAlloc(size_t size, void* user_data)    { ImFontBuildThreadAllocator* a = (ImFontBuildThreadAllocator*)user_data; return a ? a->AllocFunc(size, a->UserData) : IM_ALLOC(size); }
+static inline void  ImFontAtlasBuildStbttFree(void* ptr, void* user_data)       { ImFontBuildThreadAllocator* a = (ImFontBuildThreadAllocator*)user_data; if (a) a->FreeFunc(ptr, a->UserData); else IM_FREE(ptr); }
+
 #ifndef STB_TRUETYPE_IMPLEMENTATION                         // in case the user already have an implementation in the _same_ compilation unit (e.g. unity builds)
 #ifndef IMGUI_DISABLE_STB_TRUETYPE_IMPLEMENTATION           // in case the user already have an implementation in another compilation unit
-#define STBTT_malloc(x,u)   ((void)(u), IM_ALLOC(x))
-#define STBTT_free(x,u)     ((void)(u), IM_FREE(x))
+#define STBTT_malloc(x,u)   ImFontAtlasBuildStbttAlloc(x,u)
+#define STBTT_free(x,u)     ImFontAtlasBuildStbttFree(x,u)
 #define STBTT_assert(x)     do { IM_ASSERT(x); } while(0)
 #define STBTT_fmod(x,y)     ImFmod(x,y)
 #define STBTT_sqrt(x)       ImSqrt(x)
@@ -145,6 +156,9 @@ namespace IMGUI_STB_NAMESPACE
 #define STBTT_ifloor(x)     ((int)ImFloor(x))
 #define STBTT_iceil(x)      ((int)ImCeil(x))
 #define STBTT_strlen(x)     ImStrlen(x)
+#if defined(IMGUI_ENABLE_SSE) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+#define STBTT_SSE2          // Use SSE2 in rasterizer and oversampling filters
+#endif
 #define STBTT_STATIC
 #define STB_TRUETYPE_IMPLEMENTATION
 #else
@@ -770,6 +784,107 @@ void ImDrawList::PrimQuadUV(const ImVec2& a, const ImVec2& b, const ImVec2& c, c
 #define IM_FIXNORMAL2F_MAX_INVLEN2          100.0f // 500.0f (see #4053, #3366)
 #define IM_FIXNORMAL2F(VX,VY)               { float d2 = VX*VX + VY*VY; if (d2 > 0.000001f) { float inv_len2 = 1.0f / d2; if (inv_len2 > IM_FIXNORMAL2F_MAX_INVLEN2) inv_len2 = IM_FIXNORMAL2F_MAX_INVLEN2; VX *= inv_len2; VY *= inv_len2; } } (void)0
 
+// SSE versions of the AddPolyline() inner loops, processing 4 points per iteration.
+// They perform the same operations as the scalar code in the same order (including the ImRsqrt() approximation), so output is identical.
+// Each function returns the number of items processed, the caller processes the remaining ones with the scalar code.
+#if defined(IMGUI_ENABLE_SSE) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+#define IMGUI_ENABLE_POLYLINE_SSE
+static inline __m128 ImPolylineLengthSq4(__m128 v)  { __m128 sq = _mm_mul_ps(v, v); return _mm_add_ps(sq, _mm_shuffle_ps(sq, sq, _MM_SHUFFLE(2, 3, 0, 1))); }   // (x*x+y*y, y*y+x*x) for each of the 2 ImVec2
+static inline __m128 ImPolylineSelect4(__m128 mask, __m128 a, __m128 b) { return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b)); }
+
+// Normals of segments [0,segments_count) going from points[n] to points[n+1]. Same as IM_NORMALIZE2F_OVER_ZERO() + rotation.
+static int ImPolylineComputeNormals_SSE(const ImVec2* points, ImVec2* out_normals, int segments_count)
+{
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 neg_y = _mm_castsi128_ps(_mm_set_epi32((int)0x80000000, 0, (int)0x80000000, 0));
+    int n = 0;
+    for (; n + 4 <= segments_count; n += 4)
+    {
+        const float* p = &points[n].x;
+        __m128 d0 = _mm_sub_ps(_mm_loadu_ps(p + 2), _mm_loadu_ps(p + 0));
+        __m128 d1 = _mm_sub_ps(_mm_loadu_ps(p + 6), _mm_loadu_ps(p + 4));
+        __m128 d2_0 = ImPolylineLengthSq4(d0);
+        __m128 d2_1 = ImPolylineLengthSq4(d1);
+        d0 = _mm_mul_ps(d0, ImPolylineSelect4(_mm_cmpgt_ps(d2_0, zero), _mm_rsqrt_ps(d2_0), one));
+        d1 = _mm_mul_ps(d1, ImPolylineSelect4(_mm_cmpgt_ps(d2_1, zero), _mm_rsqrt_ps(d2_1), one));
+        _mm_storeu_ps(&out_normals[n + 0].x, _mm_xor_ps(_mm_shuffle_ps(d0, d0, _MM_SHUFFLE(2, 3, 0, 1)), neg_y)); // (dy, -dx)
+        _mm_storeu_ps(&out_normals[n + 2].x, _mm_xor_ps(_mm_shuffle_ps(d1, d1, _MM_SHUFFLE(2, 3, 0, 1)), neg_y));
+    }
+    return n;
+}
+
+// Average normals at points [1,points_count) and write 2 (+/- scale_outer) or 4 (+/- scale_outer, +/- scale_inner) edge points for each. Same as IM_FIXNORMAL2F().
+static int ImPolylineComputeEdges_SSE(const ImVec2* points, const ImVec2* normals, ImVec2* out_points, int points_count, int edges_per_point, float scale_outer, float scale_inner)
+{
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 half = _mm_set1_ps(0.5f);
+    const __m128 min_d2 = _mm_set1_ps(0.000001f);
+    const __m128 max_invlen2 = _mm_set1_ps(IM_FIXNORMAL2F_MAX_INVLEN2);
+    const __m128 outer = _mm_set1_ps(scale_outer);
+    const __m128 inner = _mm_set1_ps(scale_inner);
+    int n = 1;
+    for (; n + 4 <= points_count; n += 4)
+    {
+        for (int k = 0; k < 4; k += 2)
+        {
+            __m128 dm = _mm_mul_ps(_mm_add_ps(_mm_loadu_ps(&normals[n + k - 1].x), _mm_loadu_ps(&normals[n + k].x)), half);
+            __m128 d2 = ImPolylineLengthSq4(dm);
+            __m128 inv_len2 = _mm_min_ps(_mm_div_ps(one, d2), max_invlen2);
+            dm = _mm_mul_ps(dm, ImPolylineSelect4(_mm_cmpgt_ps(d2, min_d2), inv_len2, one));
+            const __m128 p = _mm_loadu_ps(&points[n + k].x);
+            const __m128 dm_out = _mm_mul_ps(dm, outer);
+            const __m128 p_out_a = _mm_add_ps(p, dm_out);
+            const __m128 p_out_b = _mm_sub_ps(p, dm_out);
+            if (edges_per_point == 2)
+            {
+                ImVec2* out = &out_points[(n + k) * 2];
+                _mm_storeu_ps(&out[0].x, _mm_shuffle_ps(p_out_a, p_out_b, _MM_SHUFFLE(1, 0, 1, 0)));
+                _mm_storeu_ps(&out[2].x, _mm_shuffle_ps(p_out_a, p_out_b, _MM_SHUFFLE(3, 2, 3, 2)));
+            }
+            else
+            {
+                const __m128 dm_in = _mm_mul_ps(dm, inner);
+                const __m128 p_in_a = _mm_add_ps(p, dm_in);
+                const __m128 p_in_b = _mm_sub_ps(p, dm_in);
+                ImVec2* out = &out_points[(n + k) * 4];
+                _mm_storeu_ps(&out[0].x, _mm_shuffle_ps(p_out_a, p_in_a, _MM_SHUFFLE(1, 0, 1, 0)));
+                _mm_storeu_ps(&out[2].x, _mm_shuffle_ps(p_in_b, p_out_b, _MM_SHUFFLE(1, 0, 1, 0)));
+                _mm_storeu_ps(&out[4].x, _mm_shuffle_ps(p_out_a, p_in_a, _MM_SHUFFLE(3, 2, 3, 2)));
+                _mm_storeu_ps(&out[6].x, _mm_shuffle_ps(p_in_b, p_out_b, _MM_SHUFFLE(3, 2, 3, 2)));
+            }
+        }
+    }
+    return n - 1;
+}
+
+// Write indices for consecutive segments: segment n uses 'pattern' offset by 'idx + n * idx_stride', 8 segments per iteration.
+static int ImPolylineWriteIndices_SSE(ImDrawIdx* idx_write, const unsigned int* pattern, int pattern_size, unsigned int idx, unsigned int idx_stride, int segments_count)
+{
+    IM_ASSERT(pattern_size <= 18);
+    const int block_vectors = (8 * pattern_size * (int)sizeof(ImDrawIdx)) / 16;
+    ImDrawIdx block_data[8 * 18];
+    for (int seg = 0; seg < 8; seg++)
+        for (int k = 0; k < pattern_size; k++)
+            block_data[seg * pattern_size + k] = (ImDrawIdx)(idx + seg * idx_stride + pattern[k]);
+    __m128i block[8 * 18 * sizeof(ImDrawIdx) / 16];
+    for (int v = 0; v < block_vectors; v++)
+        block[v] = _mm_loadu_si128((const __m128i*)(const void*)&block_data[v * (16 / sizeof(ImDrawIdx))]);
+    const __m128i step = (sizeof(ImDrawIdx) == 2) ? _mm_set1_epi16((short)(8 * idx_stride)) : _mm_set1_epi32((int)(8 * idx_stride));
+    int n = 0;
+    for (; n + 8 <= segments_count; n += 8)
+    {
+        __m128i* out = (__m128i*)(void*)(idx_write + n * pattern_size);
+        for (int v = 0; v < block_vectors; v++)
+        {
+            _mm_storeu_si128(out + v, block[v]);
+            block[v] = (sizeof(ImDrawIdx) == 2) ? _mm_add_epi16(block[v], step) : _mm_add_epi32(block[v], step);
+        }
+    }
+    return n;
+}
+#endif // #if defined(IMGUI_ENABLE_SSE) && (SSE2)
+
 // TODO: Thickness anti-aliased lines cap are missing their AA fringe.
 // We avoid using the ImVec2 math operators here to reduce cost to a minimum for debug/non-inlined builds.
 void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32 col, ImDrawFlags flags, float thickness)
@@ -812,7 +927,11 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
         ImVec2* temp_points = temp_normals + points_count;
 
         // Calculate normals (tangents) for each line segment
-        for (int i1 = 0; i1 < count; i1++)
+        int i1 = 0;
+#ifdef IMGUI_ENABLE_POLYLINE_SSE
+        i1 = ImPolylineComputeNormals_SSE(points, temp_normals, points_count - 1);
+#endif
+        for (; i1 < count; i1++)
         {
             const int i2 = (i1 + 1) == points_count ? 0 : i1 + 1;
             float dx = points[i2].x - points[i1].x;
@@ -846,14 +965,16 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
                 temp_points[(points_count-1)*2+1] = points[points_count-1] - temp_normals[points_count-1] * half_draw_size;
             }
 
-            // Generate the indices to form a number of triangles for each line segment, and the vertices for the line edges
+            // Generate the vertices for the line edges
             // This takes points n and n+1 and writes into n+1, with the first point in a closed line being generated from the final one (as n+1 wraps)
             // FIXME-OPT: Merge the different loops, possibly remove the temporary buffer.
-            unsigned int idx1 = _VtxCurrentIdx; // Vertex index for start of line segment
-            for (int i1 = 0; i1 < count; i1++) // i1 is the first point of the line segment
+            i1 = 0;
+#ifdef IMGUI_ENABLE_POLYLINE_SSE
+            i1 = ImPolylineComputeEdges_SSE(points, temp_normals, temp_points, points_count, 2, half_draw_size, 0.0f);
+#endif
+            for (; i1 < count; i1++) // i1 is the first point of the line segment
             {
                 const int i2 = (i1 + 1) == points_count ? 0 : i1 + 1; // i2 is the second point of the line segment
-                const unsigned int idx2 = ((i1 + 1) == points_count) ? _VtxCurrentIdx : (idx1 + (use_texture ? 2 : 3)); // Vertex index for end of segment
 
                 // Average normals
                 float dm_x = (temp_normals[i1].x + temp_normals[i2].x) * 0.5f;
@@ -868,7 +989,23 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
                 out_vtx[0].y = points[i2].y + dm_y;
                 out_vtx[1].x = points[i2].x - dm_x;
                 out_vtx[1].y = points[i2].y - dm_y;
+            }
 
+            // Generate the indices to form a number of triangles for each line segment
+            unsigned int idx1 = _VtxCurrentIdx; // Vertex index for start of line segment
+            i1 = 0;
+#ifdef IMGUI_ENABLE_POLYLINE_SSE
+            {
+                static const unsigned int pattern_tex[6] = { 2, 0, 1, 3, 1, 2 };
+                static const unsigned int pattern_no_tex[12] = { 3, 0, 2, 2, 5, 3, 4, 1, 0, 0, 3, 4 };
+                i1 = ImPolylineWriteIndices_SSE(_IdxWritePtr, use_texture ? pattern_tex : pattern_no_tex, use_texture ? 6 : 12, idx1, use_texture ? 2 : 3, points_count - 1);
+                _IdxWritePtr += i1 * (use_texture ? 6 : 12);
+                idx1 += i1 * (use_texture ? 2 : 3);
+            }
+#endif
+            for (; i1 < count; i1++) // i1 is the first point of the line segment
+            {
+                const unsigned int idx2 = ((i1 + 1) == points_count) ? _VtxCurrentIdx : (idx1 + (use_texture ? 2 : 3)); // Vertex index for end of segment
                 if (use_texture)
                 {
                     // Add indices for two triangles
@@ -942,14 +1079,16 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
                 temp_points[points_last * 4 + 3] = points[points_last] - temp_normals[points_last] * (half_inner_thickness + AA_SIZE);
             }
 
-            // Generate the indices to form a number of triangles for each line segment, and the vertices for the line edges
+            // Generate the vertices for the line edges
             // This takes points n and n+1 and writes into n+1, with the first point in a closed line being generated from the final one (as n+1 wraps)
             // FIXME-OPT: Merge the different loops, possibly remove the temporary buffer.
-            unsigned int idx1 = _VtxCurrentIdx; // Vertex index for start of line segment
-            for (int i1 = 0; i1 < count; i1++) // i1 is the first point of the line segment
+            i1 = 0;
+#ifdef IMGUI_ENABLE_POLYLINE_SSE
+            i1 = ImPolylineComputeEdges_SSE(points, temp_normals, temp_points, points_count, 4, half_inner_thickness + AA_SIZE, half_inner_thickness);
+#endif
+            for (; i1 < count; i1++) // i1 is the first point of the line segment
             {
                 const int i2 = (i1 + 1) == points_count ? 0 : (i1 + 1); // i2 is the second point of the line segment
-                const unsigned int idx2 = (i1 + 1) == points_count ? _VtxCurrentIdx : (idx1 + 4); // Vertex index for end of segment
 
                 // Average normals
                 float dm_x = (temp_normals[i1].x + temp_normals[i2].x) * 0.5f;
@@ -970,6 +1109,22 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
                 out_vtx[2].y = points[i2].y - dm_in_y;
                 out_vtx[3].x = points[i2].x - dm_out_x;
                 out_vtx[3].y = points[i2].y - dm_out_y;
+            }
+
+            // Generate the indices to form a number of triangles for each line segment
+            unsigned int idx1 = _VtxCurrentIdx; // Vertex index for start of line segment
+            i1 = 0;
+#ifdef IMGUI_ENABLE_POLYLINE_SSE
+            {
+                static const unsigned int pattern[18] = { 5, 1, 2, 2, 6, 5, 5, 1, 0, 0, 4, 5, 6, 2, 3, 3, 7, 6 };
+                i1 = ImPolylineWriteIndices_SSE(_IdxWritePtr, pattern, 18, idx1, 4, points_count - 1);
+                _IdxWritePtr += i1 * 18;
+                idx1 += i1 * 4;
+            }
+#endif
+            for (; i1 < count; i1++) // i1 is the first point of the line segment
+            {
+                const unsigned int idx2 = (i1 + 1) == points_count ? _VtxCurrentIdx : (idx1 + 4); // Vertex index for end of segment
 
                 // Add indexes
                 _IdxWritePtr[0]  = (ImDrawIdx)(idx2 + 1); _IdxWritePtr[1]  = (ImDrawIdx)(idx1 + 1); _IdxWritePtr[2]  = (ImDrawIdx)(idx1 + 2);
@@ -1014,10 +1169,10 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
             dx *= (thickness * 0.5f);
             dy *= (thickness * 0.5f);
 
-            _VtxWritePtr[0].pos.x = p1.x + dy; _VtxWritePtr[0].pos.y = p1.y - dx; _VtxWritePtr[0].uv = opaque_uv; _VtxWritePtr[0].col = col;
-            _VtxWritePtr[1].pos.x = p2.x + dy; _VtxWritePtr[1].pos.y = p2.y - dx; _VtxWritePtr[1].uv = opaque_uv; _VtxWritePtr[1].col = col;
-            _VtxWritePtr[2].pos.x = p2.x - dy; _VtxWritePtr[2].pos.y = p2.y + dx; _VtxWritePtr[2].uv = opaque_uv; _VtxWritePtr[2].col = col;
-            _VtxWritePtr[3].pos.x = p1.x - dy; _VtxWritePtr[3].pos.y = p1.y + dx; _VtxWritePtr[3].uv = opaque_uv; _VtxWritePtr[3].col = col;
+            _VtxWritePtr[0].pos = ImVec2(p1.x + dy, p1.y - dx); _VtxWritePtr[0].uv = opaque_uv; _VtxWritePtr[0].col = col;
+            _VtxWritePtr[1].pos = ImVec2(p2.x + dy, p2.y - dx); _VtxWritePtr[1].uv = opaque_uv; _VtxWritePtr[1].col = col;
+            _VtxWritePtr[2].pos = ImVec2(p2.x - dy, p2.y + dx); _VtxWritePtr[2].uv = opaque_uv; _VtxWritePtr[2].col = col;
+            _VtxWritePtr[3].pos = ImVec2(p1.x - dy, p1.y + dx); _VtxWritePtr[3].uv = opaque_uv; _VtxWritePtr[3].col = col;
             _VtxWritePtr += 4;
 
             _IdxWritePtr[0] = (ImDrawIdx)(_VtxCurrentIdx); _IdxWritePtr[1] = (ImDrawIdx)(_VtxCurrentIdx + 1); _IdxWritePtr[2] = (ImDrawIdx)(_VtxCurrentIdx + 2);
@@ -1081,8 +1236,8 @@ void ImDrawList::AddConvexPolyFilled(const ImVec2* points, const int points_coun
             dm_y *= AA_SIZE * 0.5f;
 
             // Add vertices
-            _VtxWritePtr[0].pos.x = (points[i1].x - dm_x); _VtxWritePtr[0].pos.y = (points[i1].y - dm_y); _VtxWritePtr[0].uv = uv; _VtxWritePtr[0].col = col;        // Inner
-            _VtxWritePtr[1].pos.x = (points[i1].x + dm_x); _VtxWritePtr[1].pos.y = (points[i1].y + dm_y); _VtxWritePtr[1].uv = uv; _VtxWritePtr[1].col = col_trans;  // Outer
+            _VtxWritePtr[0].pos = ImVec2(points[i1].x - dm_x, points[i1].y - dm_y); _VtxWritePtr[0].uv = uv; _VtxWritePtr[0].col = col;        // Inner
+            _VtxWritePtr[1].pos = ImVec2(points[i1].x + dm_x, points[i1].y + dm_y); _VtxWritePtr[1].uv = uv; _VtxWritePtr[1].col = col_trans;  // Outer
             _VtxWritePtr += 2;
 
             // Add indexes for fringes
@@ -1768,220 +1923,512 @@ void ImDrawList::AddImageRounded(ImTextureID user_texture_id, const ImVec2& p_mi
 //-----------------------------------------------------------------------------
 // [SECTION] ImTriangulator, ImDrawList concave polygon fill
 //-----------------------------------------------------------------------------
-// Triangulate concave polygons. Based on "Triangulation by Ear Clipping" paper, O(N^2) complexity.
-// Reference: https://www.geometrictools.com/Documentation/TriangulationByEarClipping.pdf
+// Triangulate concave polygons. Sweep line decomposition into monotone pieces, O(N log N) complexity.
+// Reference: "Computational Geometry: Algorithms and Applications", de Berg et al., chapter 3 (Polygon Triangulation).
 // Provided as a convenience for user but not used by main library.
 //-----------------------------------------------------------------------------
 // - ImTriangulator [Internal]
 // - AddConcavePolyFilled()
 //-----------------------------------------------------------------------------
 
-enum ImTriangulatorNodeType
+enum ImTriangulatorVertexType
 {
-    ImTriangulatorNodeType_Convex,
-    ImTriangulatorNodeType_Ear,
-    ImTriangulatorNodeType_Reflex
+    ImTriangulatorVertexType_Start,     // Both neighbors below, interior angle < 180
+    ImTriangulatorVertexType_Split,     // Both neighbors below, interior angle > 180
+    ImTriangulatorVertexType_End,       // Both neighbors above, interior angle < 180
+    ImTriangulatorVertexType_Merge,     // Both neighbors above, interior angle > 180
+    ImTriangulatorVertexType_Regular,   // One neighbor above, one below
 };
 
 struct ImTriangulatorNode
 {
-    ImTriangulatorNodeType  Type;
-    int                     Index;
-    ImVec2                  Pos;
-    ImTriangulatorNode*     Next;
-    ImTriangulatorNode*     Prev;
-
-    void    Unlink()        { Next->Prev = Prev; Prev->Next = Next; }
+    ImVec2  Pos;
+    int     Index;      // Index of source point. Splitting the polygon along a diagonal duplicates the nodes at both ends: copies share the same index.
+    int     Prev;       // Neighbors in the current piece of polygon
+    int     Next;
+    int     NextCopy;   // Next node with same Index, or -1
 };
 
-struct ImTriangulatorNodeSpan
+struct ImTriangulatorEvent
 {
-    ImTriangulatorNode**    Data = NULL;
-    int                     Size = 0;
-
-    void    push_back(ImTriangulatorNode* node) { Data[Size++] = node; }
-    void    find_erase_unsorted(int idx)        { for (int i = Size - 1; i >= 0; i--) if (Data[i]->Index == idx) { Data[i] = Data[Size - 1]; Size--; return; } }
+    float   Y, X;
+    int     Index;
 };
 
 struct ImTriangulator
 {
     static int EstimateTriangleCount(int points_count)      { return (points_count < 3) ? 0 : points_count - 2; }
-    static int EstimateScratchBufferSize(int points_count)  { return sizeof(ImTriangulatorNode) * points_count + sizeof(ImTriangulatorNode*) * points_count * 2; }
+    static int EstimateScratchBufferSize(int points_count)  { return (sizeof(ImTriangulatorNode) * 3 + sizeof(ImTriangulatorEvent) + sizeof(int) * 16 + 7) * points_count + 4; }
 
     void    Init(const ImVec2* points, int points_count, void* scratch_buffer);
     void    GetNextTriangle(unsigned int out_triangle[3]);     // Return relative indexes for next triangle
 
     // Internal functions
     void    BuildNodes(const ImVec2* points, int points_count);
-    void    BuildReflexes();
-    void    BuildEars();
-    void    FlipNodeList();
-    bool    IsEar(int i0, int i1, int i2, const ImVec2& v0, const ImVec2& v1, const ImVec2& v2) const;
-    void    ReclassifyNode(ImTriangulatorNode* node);
+    int     RemoveDegenerateNodes(int node, int nodes_count);
+    void    MakeCounterClockwise(int node, int nodes_count);
+    void    BuildMonotonePieces(int node, int nodes_count);
+    void    TriangulateMonotonePieces();
+    void    AddDiagonal(int i0, int i1);
+    int     FindNodeFacing(int i, const ImVec2& target) const;
+    void    AddTriangle(int i0, int i1, int i2)         { if (_TrianglesCount < _TrianglesLeft) { unsigned int* tri = &_Triangles[_TrianglesCount * 3]; tri[0] = (unsigned int)i0; tri[1] = (unsigned int)i1; tri[2] = (unsigned int)i2; } _TrianglesCount++; }
+    bool    IsAbove(int n0, int n1) const               { const ImTriangulatorNode& a = _Nodes[n0]; const ImTriangulatorNode& b = _Nodes[n1]; return (a.Pos.y != b.Pos.y) ? (a.Pos.y < b.Pos.y) : (a.Pos.x != b.Pos.x) ? (a.Pos.x < b.Pos.x) : (a.Index < b.Index); }
+    float   EdgeGetXAt(int edge, float y) const;
+    void    TreeInsert(int edge);
+    void    TreeRemove(int edge);
+    void    TreeRotateUp(int node);
+    int     TreeFindLeftOf(const ImVec2& pos) const;
 
     // Internal members
     int                     _TrianglesLeft = 0;
-    ImTriangulatorNode*     _Nodes = NULL;
-    ImTriangulatorNodeSpan  _Ears;
-    ImTriangulatorNodeSpan  _Reflexes;
+    int                     _TrianglesCount = 0;
+    unsigned int*           _Triangles = NULL;      // 3 x (points_count - 2)
+    ImTriangulatorNode*     _Nodes = NULL;          // points_count x 3 (source points + copies)
+    int                     _NodesCount = 0;
+    int                     _NodesCapacity = 0;
+    ImTriangulatorEvent*    _Events = NULL;         // points_count, sorted from top to bottom
+    int*                    _EdgeNext = NULL;       // points_count, edge 'i' goes from point 'i' to point '_EdgeNext[i]'. Nodes links are modified by AddDiagonal(), not those.
+    int*                    _EdgePrev = NULL;       // points_count
+    int*                    _EdgeHelper = NULL;     // points_count, lowest vertex above sweep line connected to the edge by a horizontal segment inside the polygon
+    int*                    _TreeLeft = NULL;       // points_count, sweep line status: edges crossing sweep line with polygon interior on their right, ordered from left to right (treap)
+    int*                    _TreeRight = NULL;
+    int*                    _TreeParent = NULL;     // -1 for root, -2 when not in tree
+    ImU32*                  _TreePriority = NULL;
+    int                     _TreeRoot = -1;
+    int*                    _PieceNodes = NULL;     // points_count x 3, nodes of the piece being triangulated, sorted from top to bottom
+    int*                    _PieceStack = NULL;     // points_count x 3
+    ImU8*                   _PieceChain = NULL;     // points_count x 3
+    ImU8*                   _NodesVisited = NULL;   // points_count x 3
+    ImU8*                   _Types = NULL;          // points_count
 };
 
-// Distribute storage for nodes, ears and reflexes.
-// FIXME-OPT: if everything is convex, we could report it to caller and let it switch to an convex renderer
-// (this would require first building reflexes to bail to convex if empty, without even building nodes)
+// Orientation of triangle as seen with Y axis going up: > 0.0f for counter-clockwise, == 0.0f for collinear points.
+static inline float ImTriangulatorOrient(const ImVec2& a, const ImVec2& b, const ImVec2& c)
+{
+    return (b.x - a.x) * (a.y - c.y) - (a.y - b.y) * (c.x - a.x);
+}
+
+static int IMGUI_CDECL ImTriangulatorEventComparer(const void* lhs, const void* rhs)
+{
+    const ImTriangulatorEvent* a = (const ImTriangulatorEvent*)lhs;
+    const ImTriangulatorEvent* b = (const ImTriangulatorEvent*)rhs;
+    if (a->Y != b->Y) return (a->Y < b->Y) ? -1 : +1;
+    if (a->X != b->X) return (a->X < b->X) ? -1 : +1;
+    return a->Index - b->Index;
+}
+
+// Distribute storage, then compute all triangles.
+// - Remove vertices where the polygon doesn't turn (collinear, duplicate or spike), each one giving a zero-area triangle.
+// - Sweep from top to bottom to add diagonals splitting the polygon into y-monotone pieces. O(N log N).
+// - Triangulate each monotone piece, going from top to bottom along both its chains. O(N).
+// Each diagonal adds one piece and two nodes, so we always output points_count - 2 triangles. If that doesn't match
+// because geometry is degenerated (e.g. self-intersecting), we fallback to the behavior of convex fill.
 void ImTriangulator::Init(const ImVec2* points, int points_count, void* scratch_buffer)
 {
     IM_ASSERT(scratch_buffer != NULL && points_count >= 3);
-    _TrianglesLeft = EstimateTriangleCount(points_count);
-    _Nodes         = (ImTriangulatorNode*)scratch_buffer;                          // points_count x Node
-    _Ears.Data     = (ImTriangulatorNode**)(_Nodes + points_count);                // points_count x Node*
-    _Reflexes.Data = (ImTriangulatorNode**)(_Nodes + points_count) + points_count; // points_count x Node*
-    BuildNodes(points, points_count);
-    BuildReflexes();
-    BuildEars();
+    const int n = points_count;
+    _TrianglesLeft = EstimateTriangleCount(n);
+    _TrianglesCount = 0;
+    _Nodes          = (ImTriangulatorNode*)scratch_buffer;
+    _Events         = (ImTriangulatorEvent*)(_Nodes + n * 3);
+    _Triangles      = (unsigned int*)(_Events + n);
+    _EdgeNext       = (int*)(_Triangles + n * 3);
+    _EdgePrev       = _EdgeNext + n;
+    _EdgeHelper     = _EdgePrev + n;
+    _TreeLeft       = _EdgeHelper + n;
+    _TreeRight      = _TreeLeft + n;
+    _TreeParent     = _TreeRight + n;
+    _TreePriority   = (ImU32*)(_TreeParent + n);
+    _PieceNodes     = (int*)(_TreePriority + n);
+    _PieceStack     = _PieceNodes + n * 3;
+    _PieceChain     = (ImU8*)(_PieceStack + n * 3);
+    _NodesVisited   = _PieceChain + n * 3;
+    _Types          = _NodesVisited + n * 3;
+    _NodesCapacity  = n * 3;
+    _TreeRoot       = -1;
+
+    BuildNodes(points, n);
+    int node = 0;
+    const int nodes_count = RemoveDegenerateNodes(node, n);
+    while (_NodesVisited[node])
+        node = _Nodes[node].Next;
+    if (nodes_count == 3)
+    {
+        AddTriangle(_Nodes[node].Prev, node, _Nodes[node].Next);
+    }
+    else
+    {
+        MakeCounterClockwise(node, nodes_count);
+        BuildMonotonePieces(node, nodes_count);
+        TriangulateMonotonePieces();
+    }
+
+    // Geometry is degenerated
+    if (_TrianglesCount != _TrianglesLeft)
+    {
+        _TrianglesCount = 0;
+        for (int i = 2; i < n; i++)
+            AddTriangle(0, i - 1, i);
+    }
+}
+
+void ImTriangulator::GetNextTriangle(unsigned int out_triangle[3])
+{
+    IM_ASSERT(_TrianglesLeft > 0);
+    const unsigned int* tri = &_Triangles[(_TrianglesCount - _TrianglesLeft) * 3];
+    out_triangle[0] = tri[0];
+    out_triangle[1] = tri[1];
+    out_triangle[2] = tri[2];
+    _TrianglesLeft--;
 }
 
 void ImTriangulator::BuildNodes(const ImVec2* points, int points_count)
 {
     for (int i = 0; i < points_count; i++)
     {
-        _Nodes[i].Type = ImTriangulatorNodeType_Convex;
-        _Nodes[i].Index = i;
-        _Nodes[i].Pos = points[i];
-        _Nodes[i].Next = _Nodes + i + 1;
-        _Nodes[i].Prev = _Nodes + i - 1;
+        ImTriangulatorNode* node = &_Nodes[i];
+        node->Pos = points[i];
+        node->Index = i;
+        node->Prev = i - 1;
+        node->Next = i + 1;
+        node->NextCopy = -1;
+        _NodesVisited[i] = 0;
     }
-    _Nodes[0].Prev = _Nodes + points_count - 1;
-    _Nodes[points_count - 1].Next = _Nodes;
+    _Nodes[0].Prev = points_count - 1;
+    _Nodes[points_count - 1].Next = 0;
+    _NodesCount = points_count;
 }
 
-void ImTriangulator::BuildReflexes()
+// Clip vertices where the polygon doesn't turn. This doesn't change the polygon shape and ensures vertex types are well defined.
+// We keep track of how many nodes before current one are known to be valid: removing a node only invalidates its neighbors. O(N).
+int ImTriangulator::RemoveDegenerateNodes(int node, int nodes_count)
 {
-    ImTriangulatorNode* n1 = _Nodes;
-    for (int i = _TrianglesLeft; i >= 0; i--, n1 = n1->Next)
+    int valid_count = 0;
+    while (valid_count < nodes_count && nodes_count > 3)
     {
-        if (ImTriangleIsClockwise(n1->Prev->Pos, n1->Pos, n1->Next->Pos))
+        ImTriangulatorNode* n1 = &_Nodes[node];
+        if (ImTriangulatorOrient(_Nodes[n1->Prev].Pos, n1->Pos, _Nodes[n1->Next].Pos) != 0.0f)
+        {
+            node = n1->Next;
+            valid_count++;
             continue;
-        n1->Type = ImTriangulatorNodeType_Reflex;
-        _Reflexes.push_back(n1);
+        }
+        AddTriangle(n1->Prev, node, n1->Next);
+        _Nodes[n1->Prev].Next = n1->Next;
+        _Nodes[n1->Next].Prev = n1->Prev;
+        _NodesVisited[node] = 1;
+        node = n1->Prev;
+        nodes_count--;
+        valid_count = ImMax(ImMin(valid_count - 1, nodes_count - 2), 0);
     }
+    return nodes_count;
 }
 
-void ImTriangulator::BuildEars()
+void ImTriangulator::MakeCounterClockwise(int node, int nodes_count)
 {
-    ImTriangulatorNode* n1 = _Nodes;
-    for (int i = _TrianglesLeft; i >= 0; i--, n1 = n1->Next)
+    // Signed area as seen with Y axis going up, relative to first point for precision.
+    const ImVec2 origin = _Nodes[node].Pos;
+    double area = 0.0;
+    for (int i = 0, n = node; i < nodes_count; i++, n = _Nodes[n].Next)
     {
-        if (n1->Type != ImTriangulatorNodeType_Convex)
-            continue;
-        if (!IsEar(n1->Prev->Index, n1->Index, n1->Next->Index, n1->Prev->Pos, n1->Pos, n1->Next->Pos))
-            continue;
-        n1->Type = ImTriangulatorNodeType_Ear;
-        _Ears.push_back(n1);
+        const ImVec2 p0 = _Nodes[n].Pos - origin;
+        const ImVec2 p1 = _Nodes[_Nodes[n].Next].Pos - origin;
+        area += (double)p1.x * p0.y - (double)p0.x * p1.y;
+    }
+    if (area >= 0.0)
+        return;
+    for (int i = 0, n = node; i < nodes_count; i++)
+    {
+        ImTriangulatorNode* n1 = &_Nodes[n];
+        ImSwap(n1->Prev, n1->Next);
+        n = n1->Prev;
     }
 }
 
-void ImTriangulator::GetNextTriangle(unsigned int out_triangle[3])
+float ImTriangulator::EdgeGetXAt(int edge, float y) const
+{
+    const ImVec2& a = _Nodes[edge].Pos;
+    const ImVec2& b = _Nodes[_EdgeNext[edge]].Pos;
+    if (a.y == b.y)
+        return a.x;
+    const float t = ImClamp((y - a.y) / (b.y - a.y), 0.0f, 1.0f);
+    return a.x + (b.x - a.x) * t;
+}
+
+void ImTriangulator::TreeRotateUp(int node)
+{
+    const int parent = _TreeParent[node];
+    const int grand_parent = _TreeParent[parent];
+    if (_TreeLeft[parent] == node)
+    {
+        _TreeLeft[parent] = _TreeRight[node];
+        if (_TreeRight[node] != -1)
+            _TreeParent[_TreeRight[node]] = parent;
+        _TreeRight[node] = parent;
+    }
+    else
+    {
+        _TreeRight[parent] = _TreeLeft[node];
+        if (_TreeLeft[node] != -1)
+            _TreeParent[_TreeLeft[node]] = parent;
+        _TreeLeft[node] = parent;
+    }
+    _TreeParent[parent] = node;
+    _TreeParent[node] = grand_parent;
+    if (grand_parent == -1)
+        _TreeRoot = node;
+    else if (_TreeLeft[grand_parent] == parent)
+        _TreeLeft[grand_parent] = node;
+    else
+        _TreeRight[grand_parent] = node;
+}
+
+// Insert edge starting at current sweep line position
+void ImTriangulator::TreeInsert(int edge)
 {
-    if (_Ears.Size == 0)
+    const ImVec2& pos = _Nodes[edge].Pos;
+    const ImVec2& pos_end = _Nodes[_EdgeNext[edge]].Pos;
+    int parent = -1;
+    bool insert_left = false;
+    for (int node = _TreeRoot; node != -1; )
     {
-        FlipNodeList();
+        const float x = EdgeGetXAt(node, pos.y);
+        parent = node;
+        insert_left = (pos.x != x) ? (pos.x < x) : (ImTriangulatorOrient(_Nodes[node].Pos, _Nodes[_EdgeNext[node]].Pos, pos_end) < 0.0f); // Ties only happen with degenerated geometry
+        node = insert_left ? _TreeLeft[node] : _TreeRight[node];
+    }
+    _TreeLeft[edge] = _TreeRight[edge] = -1;
+    _TreeParent[edge] = parent;
+    if (parent == -1)
+        _TreeRoot = edge;
+    else if (insert_left)
+        _TreeLeft[parent] = edge;
+    else
+        _TreeRight[parent] = edge;
+    while (_TreeParent[edge] != -1 && _TreePriority[_TreeParent[edge]] < _TreePriority[edge])
+        TreeRotateUp(edge);
+}
 
-        ImTriangulatorNode* node = _Nodes;
-        for (int i = _TrianglesLeft; i >= 0; i--, node = node->Next)
-            node->Type = ImTriangulatorNodeType_Convex;
-        _Reflexes.Size = 0;
-        BuildReflexes();
-        BuildEars();
+void ImTriangulator::TreeRemove(int edge)
+{
+    if (_TreeParent[edge] == -2)
+        return;
+    while (_TreeLeft[edge] != -1 || _TreeRight[edge] != -1)
+    {
+        const int left = _TreeLeft[edge];
+        const int right = _TreeRight[edge];
+        TreeRotateUp((right == -1 || (left != -1 && _TreePriority[left] > _TreePriority[right])) ? left : right);
+    }
+    const int parent = _TreeParent[edge];
+    if (parent == -1)
+        _TreeRoot = -1;
+    else if (_TreeLeft[parent] == edge)
+        _TreeLeft[parent] = -1;
+    else
+        _TreeRight[parent] = -1;
+    _TreeParent[edge] = -2;
+}
 
-        // If we still don't have ears, it means geometry is degenerated.
-        if (_Ears.Size == 0)
+// Return edge directly left of 'pos' on sweep line, or -1
+int ImTriangulator::TreeFindLeftOf(const ImVec2& pos) const
+{
+    int result = -1;
+    for (int node = _TreeRoot; node != -1; )
+    {
+        if (EdgeGetXAt(node, pos.y) <= pos.x)
+        {
+            result = node;
+            node = _TreeRight[node];
+        }
+        else
         {
-            // Return first triangle available, mimicking the behavior of convex fill.
-            IM_ASSERT(_TrianglesLeft > 0); // Geometry is degenerated
-            _Ears.Data[0] = _Nodes;
-            _Ears.Size    = 1;
+            node = _TreeLeft[node];
         }
     }
+    return result;
+}
 
-    ImTriangulatorNode* ear = _Ears.Data[--_Ears.Size];
-    out_triangle[0] = ear->Prev->Index;
-    out_triangle[1] = ear->Index;
-    out_triangle[2] = ear->Next->Index;
-
-    ear->Unlink();
-    if (ear == _Nodes)
-        _Nodes = ear->Next;
-
-    ReclassifyNode(ear->Prev);
-    ReclassifyNode(ear->Next);
-    _TrianglesLeft--;
+// Among nodes for point 'i' (there are multiple once the polygon has been split at this point), find the one facing 'target'.
+int ImTriangulator::FindNodeFacing(int i, const ImVec2& target) const
+{
+    for (int node = i; node != -1; node = _Nodes[node].NextCopy)
+    {
+        const ImVec2& p0 = _Nodes[_Nodes[node].Prev].Pos;
+        const ImVec2& p1 = _Nodes[node].Pos;
+        const ImVec2& p2 = _Nodes[_Nodes[node].Next].Pos;
+        const bool inside_next = ImTriangulatorOrient(p1, p2, target) >= 0.0f;
+        const bool inside_prev = ImTriangulatorOrient(p0, p1, target) >= 0.0f;
+        if (ImTriangulatorOrient(p0, p1, p2) >= 0.0f ? (inside_next && inside_prev) : (inside_next || inside_prev))
+            return node;
+    }
+    return i;
 }
 
-void ImTriangulator::FlipNodeList()
+// Split the piece containing points 'i0' and 'i1' in two
+void ImTriangulator::AddDiagonal(int i0, int i1)
 {
-    ImTriangulatorNode* prev = _Nodes;
-    ImTriangulatorNode* temp = _Nodes;
-    ImTriangulatorNode* current = _Nodes->Next;
-    prev->Next = prev;
-    prev->Prev = prev;
-    while (current != _Nodes)
+    if (i0 == i1 || _NodesCount + 2 > _NodesCapacity)
+        return;
+    const int a = FindNodeFacing(i0, _Nodes[i1].Pos);
+    const int b = FindNodeFacing(i1, _Nodes[i0].Pos);
+    const int a2 = _NodesCount++;
+    const int b2 = _NodesCount++;
+    _Nodes[a2] = _Nodes[a];
+    _Nodes[b2] = _Nodes[b];
+    _Nodes[a].NextCopy = a2;
+    _Nodes[b].NextCopy = b2;
+    _NodesVisited[a2] = _NodesVisited[b2] = 0;
+
+    const int a_next = _Nodes[a].Next;
+    const int b_prev = _Nodes[b].Prev;
+    _Nodes[a].Next = b;       _Nodes[b].Prev = a;           // a -> b -> (b next...)
+    _Nodes[a2].Next = a_next; _Nodes[a_next].Prev = a2;     // a2 -> (a next...) -> b2
+    _Nodes[b_prev].Next = b2; _Nodes[b2].Prev = b_prev;
+    _Nodes[b2].Next = a2;     _Nodes[a2].Prev = b2;
+}
+
+// Polygon is counter-clockwise (as seen with Y axis going up) so interior is on the right of edges going down.
+// Those are stored in the sweep line status, and each of them tracks an 'helper' vertex to connect diagonals to.
+// Reference: "Computational Geometry: Algorithms and Applications", de Berg et al., chapter 3.
+void ImTriangulator::BuildMonotonePieces(int node, int nodes_count)
+{
+    for (int i = 0, n = node; i < nodes_count; i++, n = _Nodes[n].Next)
+    {
+        const int n0 = _Nodes[n].Prev;
+        const int n2 = _Nodes[n].Next;
+        _EdgePrev[n] = n0;
+        _EdgeNext[n] = n2;
+        _EdgeHelper[n] = n;
+        _TreeParent[n] = -2;
+        ImU32 h = (ImU32)n * 0x9E3779B1u; // Deterministic priorities for the treap
+        h ^= h >> 15; h *= 0x85EBCA6Bu; h ^= h >> 13;
+        _TreePriority[n] = h;
+
+        const bool convex = ImTriangulatorOrient(_Nodes[n0].Pos, _Nodes[n].Pos, _Nodes[n2].Pos) > 0.0f;
+        const bool prev_below = IsAbove(n, n0);
+        const bool next_below = IsAbove(n, n2);
+        if (prev_below && next_below)
+            _Types[n] = convex ? ImTriangulatorVertexType_Start : ImTriangulatorVertexType_Split;
+        else if (!prev_below && !next_below)
+            _Types[n] = convex ? ImTriangulatorVertexType_End : ImTriangulatorVertexType_Merge;
+        else
+            _Types[n] = ImTriangulatorVertexType_Regular;
+
+        ImTriangulatorEvent* event = &_Events[i];
+        event->Y = _Nodes[n].Pos.y;
+        event->X = _Nodes[n].Pos.x;
+        event->Index = n;
+    }
+    ImQsort(_Events, (size_t)nodes_count, sizeof(ImTriangulatorEvent), ImTriangulatorEventComparer);
+
+    for (int event_n = 0; event_n < nodes_count; event_n++)
     {
-        temp = current->Next;
+        const int n = _Events[event_n].Index;
+        const int type = _Types[n];
 
-        current->Next = prev;
-        prev->Prev = current;
-        _Nodes->Next = current;
-        current->Prev = _Nodes;
+        // Edge ending here (when interior is on its right)
+        if (type == ImTriangulatorVertexType_End || type == ImTriangulatorVertexType_Merge || (type == ImTriangulatorVertexType_Regular && IsAbove(_EdgePrev[n], n)))
+        {
+            const int edge = _EdgePrev[n];
+            if (_Types[_EdgeHelper[edge]] == ImTriangulatorVertexType_Merge)
+                AddDiagonal(n, _EdgeHelper[edge]);
+            TreeRemove(edge);
+        }
+
+        // Edge on the left when interior is on our left
+        if (type == ImTriangulatorVertexType_Split || type == ImTriangulatorVertexType_Merge || (type == ImTriangulatorVertexType_Regular && !IsAbove(_EdgePrev[n], n)))
+        {
+            const int edge = TreeFindLeftOf(_Nodes[n].Pos);
+            if (edge != -1)
+            {
+                if (type == ImTriangulatorVertexType_Split || _Types[_EdgeHelper[edge]] == ImTriangulatorVertexType_Merge)
+                    AddDiagonal(n, _EdgeHelper[edge]);
+                _EdgeHelper[edge] = n;
+            }
+        }
 
-        prev = current;
-        current = temp;
+        // Edge starting here (when interior is on its right)
+        if (type == ImTriangulatorVertexType_Start || type == ImTriangulatorVertexType_Split || (type == ImTriangulatorVertexType_Regular && IsAbove(_EdgePrev[n], n)))
+        {
+            TreeInsert(n);
+            _EdgeHelper[n] = n;
+        }
     }
-    _Nodes = prev;
 }
 
-// A triangle is an ear is no other vertex is inside it. We can test reflexes vertices only (see reference algorithm)
-bool ImTriangulator::IsEar(int i0, int i1, int i2, const ImVec2& v0, const ImVec2& v1, const ImVec2& v2) const
+// Merge both chains of each piece from top to bottom, then add triangles with a stack of vertices still to be connected.
+void ImTriangulator::TriangulateMonotonePieces()
 {
-    ImTriangulatorNode** p_end = _Reflexes.Data + _Reflexes.Size;
-    for (ImTriangulatorNode** p = _Reflexes.Data; p < p_end; p++)
+    enum { Chain_None, Chain_Next, Chain_Prev };
+    for (int first = 0; first < _NodesCount; first++)
     {
-        ImTriangulatorNode* reflex = *p;
-        if (reflex->Index != i0 && reflex->Index != i1 && reflex->Index != i2)
-            if (ImTriangleContainsPoint(v0, v1, v2, reflex->Pos))
-                return false;
+        if (_NodesVisited[first])
+            continue;
+        int top = first;
+        int count = 0;
+        for (int n = first; !_NodesVisited[n]; n = _Nodes[n].Next, count++)
+        {
+            _NodesVisited[n] = 1;
+            if (IsAbove(n, top))
+                top = n;
+        }
+        if (count < 3)
+            continue;
+
+        int* nodes = _PieceNodes;
+        ImU8* chains = _PieceChain;
+        nodes[0] = top;
+        chains[0] = Chain_None;
+        int a = _Nodes[top].Next;
+        int b = _Nodes[top].Prev;
+        for (int i = 1; i < count - 1; i++)
+        {
+            if (IsAbove(a, b)) { nodes[i] = a; chains[i] = Chain_Next; a = _Nodes[a].Next; }
+            else               { nodes[i] = b; chains[i] = Chain_Prev; b = _Nodes[b].Prev; }
+        }
+        nodes[count - 1] = a;
+
+        int* stack = _PieceStack;
+        int stack_size = 0;
+        stack[stack_size++] = 0;
+        stack[stack_size++] = 1;
+        for (int i = 2; i < count - 1; i++)
+        {
+            const int n = nodes[i];
+            if (chains[i] != chains[stack[stack_size - 1]])
+            {
+                // Opposite chain: connect to all stacked vertices
+                for (int s = stack_size - 1; s > 0; s--)
+                    AddTriangle(_Nodes[n].Index, _Nodes[nodes[stack[s]]].Index, _Nodes[nodes[stack[s - 1]]].Index);
+                stack[0] = i - 1;
+                stack[1] = i;
+                stack_size = 2;
+            }
+            else
+            {
+                // Same chain: connect to stacked vertices as long as the diagonal is inside
+                int last = stack[--stack_size];
+                while (stack_size > 0)
+                {
+                    const ImVec2& p_top = _Nodes[nodes[stack[stack_size - 1]]].Pos;
+                    const ImVec2& p_last = _Nodes[nodes[last]].Pos;
+                    const float orient = (chains[i] == Chain_Next) ? ImTriangulatorOrient(p_top, p_last, _Nodes[n].Pos) : ImTriangulatorOrient(_Nodes[n].Pos, p_last, p_top);
+                    if (orient <= 0.0f)
+                        break;
+                    AddTriangle(_Nodes[n].Index, _Nodes[nodes[last]].Index, _Nodes[nodes[stack[stack_size - 1]]].Index);
+                    last = stack[--stack_size];
+                }
+                stack[stack_size++] = last;
+                stack[stack_size++] = i;
+            }
+        }
+        const int n = nodes[count - 1];
+        for (int s = stack_size - 1; s > 0; s--)
+            AddTriangle(_Nodes[n].Index, _Nodes[nodes[stack[s]]].Index, _Nodes[nodes[stack[s - 1]]].Index);
     }
-    return true;
 }
 
-void ImTriangulator::ReclassifyNode(ImTriangulatorNode* n1)
-{
-    // Classify node
-    ImTriangulatorNodeType type;
-    const ImTriangulatorNode* n0 = n1->Prev;
-    const ImTriangulatorNode* n2 = n1->Next;
-    if (!ImTriangleIsClockwise(n0->Pos, n1->Pos, n2->Pos))
-        type = ImTriangulatorNodeType_Reflex;
-    else if (IsEar(n0->Index, n1->Index, n2->Index, n0->Pos, n1->Pos, n2->Pos))
-        type = ImTriangulatorNodeType_Ear;
-    else
-        type = ImTriangulatorNodeType_Convex;
-
-    // Update lists when a type changes
-    if (type == n1->Type)
-        return;
-    if (n1->Type == ImTriangulatorNodeType_Reflex)
-        _Reflexes.find_erase_unsorted(n1->Index);
-    else if (n1->Type == ImTriangulatorNodeType_Ear)
-        _Ears.find_erase_unsorted(n1->Index);
-    if (type == ImTriangulatorNodeType_Reflex)
-        _Reflexes.push_back(n1);
-    else if (type == ImTriangulatorNodeType_Ear)
-        _Ears.push_back(n1);
-    n1->Type = type;
-}
-
-// Use ear-clipping algorithm to triangulate a simple polygon (no self-interaction, no holes).
+// Triangulate a simple polygon (no self-interaction, no holes).
 // (Reminder: we don't perform any coarse clipping/culling in ImDrawList layer!
 // It is up to caller to ensure not making costly calls that will be outside of visible area.
 // As concave fill is noticeably more expensive than other primitives, be mindful of this...
@@ -2042,8 +2489,8 @@ void ImDrawList::AddConcavePolyFilled(const ImVec2* points, const int points_cou
             dm_y *= AA_SIZE * 0.5f;
 
             // Add vertices
-            _VtxWritePtr[0].pos.x = (points[i1].x - dm_x); _VtxWritePtr[0].pos.y = (points[i1].y - dm_y); _VtxWritePtr[0].uv = uv; _VtxWritePtr[0].col = col;        // Inner
-            _VtxWritePtr[1].pos.x = (points[i1].x + dm_x); _VtxWritePtr[1].pos.y = (points[i1].y + dm_y); _VtxWritePtr[1].uv = uv; _VtxWritePtr[1].col = col_trans;  // Outer
+            _VtxWritePtr[0].pos = ImVec2(points[i1].x - dm_x, points[i1].y - dm_y); _VtxWritePtr[0].uv = uv; _VtxWritePtr[0].col = col;        // Inner
+            _VtxWritePtr[1].pos = ImVec2(points[i1].x + dm_x, points[i1].y + dm_y); _VtxWritePtr[1].uv = uv; _VtxWritePtr[1].col = col_trans;  // Outer
             _VtxWritePtr += 2;
 
             // Add indexes for fringes
@@ -2361,12 +2808,12 @@ void ImGui::ShadeVertsLinearUV(ImDrawList* draw_list, int vert_start_idx, int ve
         const ImVec2 min = ImMin(uv_a, uv_b);
         const ImVec2 max = ImMax(uv_a, uv_b);
         for (ImDrawVert* vertex = vert_start; vertex < vert_end; ++vertex)
-            vertex->uv = ImClamp(uv_a + ImMul(ImVec2(vertex->pos.x, vertex->pos.y) - a, scale), min, max);
+            vertex->uv = ImClamp(uv_a + ImMul((ImVec2)vertex->pos - a, scale), min, max);
     }
     else
     {
         for (ImDrawVert* vertex = vert_start; vertex < vert_end; ++vertex)
-            vertex->uv = uv_a + ImMul(ImVec2(vertex->pos.x, vertex->pos.y) - a, scale);
+            vertex->uv = uv_a + ImMul((ImVec2)vertex->pos - a, scale);
     }
 }
 
@@ -2375,7 +2822,7 @@ void ImGui::ShadeVertsTransformPos(ImDrawList* draw_list, int vert_start_idx, in
     ImDrawVert* vert_start = draw_list->VtxBuffer.Data + vert_start_idx;
     ImDrawVert* vert_end = draw_list->VtxBuffer.Data + vert_end_idx;
     for (ImDrawVert* vertex = vert_start; vertex < vert_end; ++vertex)
-        vertex->pos = ImRotate(vertex->pos- pivot_in, cos_a, sin_a) + pivot_out;
+        vertex->pos = ImRotate((ImVec2)vertex->pos - pivot_in, cos_a, sin_a) + pivot_out;
 }
 
 //-----------------------------------------------------------------------------
@@ -2392,6 +2839,7 @@ ImFontConfig::ImFontConfig()
     RasterizerMultiply = 1.0f;
     RasterizerDensity = 1.0f;
     EllipsisChar = 0;
+    SDFPadding = 4;
 }
 
 //-----------------------------------------------------------------------------
@@ -2419,6 +2867,7 @@ ImFontConfig::ImFontConfig()
 // - ImFontAtlasBuildMultiplyRectAlpha8()
 // - ImFontAtlasBuildWithStbTruetype()
 // - ImFontAtlasGetBuilderForStbTruetype()
+// - ImFontAtlasUpdateDynamicGlyphs()
 // - ImFontAtlasUpdateSourcesPointers()
 // - ImFontAtlasBuildSetupFont()
 // - ImFontAtlasBuildPackCustomRects()
@@ -2428,6 +2877,9 @@ ImFontConfig::ImFontConfig()
 // - ImFontAtlasBuildRenderLinesTexData()
 // - ImFontAtlasBuildInit()
 // - ImFontAtlasBuildFinish()
+// - ImFontAtlasCacheCalcKey()
+// - ImFontAtlasCacheSave()
+// - ImFontAtlasCacheLoad()
 //-----------------------------------------------------------------------------
 
 // A work of art lies ahead! (. = white layer, X = black layer, others are blank)
@@ -2498,6 +2950,7 @@ ImFontAtlas::~ImFontAtlas()
 void    ImFontAtlas::ClearInputData()
 {
     IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
+    ImFontAtlasDynamicShutdown(this); // Dynamic glyphs need the font data
     for (ImFontConfig& font_cfg : Sources)
         if (font_cfg.FontData && font_cfg.FontDataOwnedByAtlas)
         {
@@ -2521,6 +2974,7 @@ void    ImFontAtlas::ClearInputData()
 void    ImFontAtlas::ClearTexData()
 {
     IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
+    ImFontAtlasDynamicShutdown(this); // Dynamic glyphs need the CPU side texture data
     if (TexPixelsAlpha8)
         IM_FREE(TexPixelsAlpha8);
     if (TexPixelsRGBA32)
@@ -2811,8 +3265,17 @@ bool    ImFontAtlas::Build()
 #endif
     }
 
+    // Reload baked data from cache file. Rebuild (and update the cache file) when it is missing or outdated.
+    // (Cache is not used with ImFontAtlasFlags_DynamicGlyphs: there is little to save and runtime state isn't stored)
+    const bool use_cache = (CacheFilename != NULL) && (Flags & ImFontAtlasFlags_DynamicGlyphs) == 0;
+    if (use_cache && ImFontAtlasCacheLoad(this, CacheFilename))
+        return true;
+
     // Build
-    return builder_io->FontBuilder_Build(this);
+    const bool ret = builder_io->FontBuilder_Build(this);
+    if (ret && use_cache)
+        ImFontAtlasCacheSave(this, CacheFilename);
+    return ret;
 }
 
 void    ImFontAtlasBuildMultiplyCalcLookupTable(unsigned char out_table[256], float in_brighten_factor)
@@ -2835,12 +3298,40 @@ void    ImFontAtlasBuildMultiplyRectAlpha8(const unsigned char table[256], unsig
 
 void ImFontAtlasBuildGetOversampleFactors(const ImFontConfig* src, int* out_oversample_h, int* out_oversample_v)
 {
+    // Distance fields are sampled with bilinear filtering at any scale: oversampling doesn't apply
+    if (src->SDF)
+    {
+        *out_oversample_h = *out_oversample_v = 1;
+        return;
+    }
+
     // Automatically disable horizontal oversampling over size 36
     *out_oversample_h = (src->OversampleH != 0) ? src->OversampleH : (src->SizePixels * src->RasterizerDensity > 36.0f || src->PixelSnapH) ? 1 : 2;
     *out_oversample_v = (src->OversampleV != 0) ? src->OversampleV : 1;
 }
 
+// Kerning pairs are stored in an open-addressing hash table with linear probing, at most a quarter full, so a lookup
+// usually touches a single slot. Most pairs have no kerning and stop at the first empty slot.
+static inline ImU32 ImFontKerningHash(unsigned int c_prev, unsigned int c)
+{
+    const ImU32 h = (((ImU32)c_prev * 0x9E3779B1u) ^ (ImU32)c) * 0x85EBCA6Bu; // Pairs often have consecutive code-points: scramble before folding high bits into low bits
+    return h ^ (h >> 16);
+}
+
 #ifdef IMGUI_ENABLE_STB_TRUETYPE
+// Layout of the texture area reserved for glyphs rasterized on demand (ImFontAtlasFlags_DynamicGlyphs)
+#ifndef IM_FONT_ATLAS_DYNAMIC_PAGES_COUNT
+#define IM_FONT_ATLAS_DYNAMIC_PAGES_COUNT   16      // Number of pages (evicted as a whole). Must be < 255.
+#endif
+#ifndef IM_FONT_ATLAS_DYNAMIC_PAGE_ROWS
+#define IM_FONT_ATLAS_DYNAMIC_PAGE_ROWS     2       // Height of a page, in rows of the tallest glyph
+#endif
+// Source fonts with at least that many requested codepoints get decoded cmap/loca tables (see stbtt_InitFontAccel()).
+// Below that, decoding costs more than the lookups it saves. Requires our imstb_truetype.h (STBTT_HAS_FONT_ACCEL).
+#ifndef IM_FONT_ATLAS_ACCEL_MIN_CODEPOINTS
+#define IM_FONT_ATLAS_ACCEL_MIN_CODEPOINTS  4096
+#endif
+
 // Temporary data for one source font (multiple source fonts can be merged into one destination ImFont)
 // (C++03 doesn't allow instancing ImVector<> with function-local types so we declare the type here.)
 struct ImFontBuildSrcData
@@ -2855,6 +3346,7 @@ struct ImFontBuildSrcData
     int                 GlyphsCount;        // Glyph count (excluding missing glyphs and glyphs already set by an earlier source font)
     ImBitVector         GlyphsSet;          // Glyph bit map (random access, 1-bit per codepoint. This will be a maximum of 8KB)
     ImVector<int>       GlyphsList;         // Glyph codepoints list (flattened version of GlyphsSet)
+    ImVector<int>       DynamicGlyphsList;  // Glyph codepoints available but not baked, rasterized on demand (ImFontAtlasFlags_DynamicGlyphs)
 };
 
 // Temporary data for one destination ImFont* (multiple source fonts can be merged into one destination ImFont)
@@ -2866,6 +3358,114 @@ struct ImFontBuildDstData
     ImBitVector         GlyphsSet;          // This is used to resolve collision when multiple sources are merged into a same destination font.
 };
 
+// Measure the texture rectangle of a glyph (this is based on stbtt_PackFontRangesGatherRects). Return false if the glyph has no pixels.
+// Distance fields extend 'SDFPadding' pixels outside of the glyph bitmap box.
+static bool ImFontAtlasBuildCalcGlyphRect(const stbtt_fontinfo* font_info, const ImFontConfig* src, int glyph_index_in_font, float scale, int oversample_h, int oversample_v, int pack_padding, stbrp_rect* r)
+{
+    int x0, y0, x1, y1;
+    stbtt_GetGlyphBitmapBoxSubpixel(font_info, glyph_index_in_font, scale * oversample_h, scale * oversample_v, 0, 0, &x0, &y0, &x1, &y1);
+    const bool has_pixels = (x1 > x0 && y1 > y0);
+    const int sdf_padding = (src->SDF && has_pixels) ? src->SDFPadding * 2 : 0;
+    r->w = (stbrp_coord)(x1 - x0 + sdf_padding + pack_padding + oversample_h - 1);
+    r->h = (stbrp_coord)(y1 - y0 + sdf_padding + pack_padding + oversample_v - 1);
+    return has_pixels;
+}
+
+// Render a glyph as a signed distance field into a packed rectangle.
+// Fill the rectangle and 'out' the same way stbtt_PackFontRangesRenderIntoRects() does (oversampling is always 1 with SDF).
+static void ImFontAtlasBuildRenderGlyphSDF(const stbtt_fontinfo* font_info, const ImFontConfig* src, float scale, int codepoint, int pack_padding, stbrp_rect* r, unsigned char* pixels, int stride, stbtt_packedchar* out)
+{
+    if (!r->was_packed || r->w == 0 || r->h == 0)
+        return;
+    const int glyph = stbtt_FindGlyphIndex(font_info, codepoint);
+    int advance, lsb;
+    stbtt_GetGlyphHMetrics(font_info, glyph, &advance, &lsb);
+    r->x += (stbrp_coord)pack_padding;
+    r->y += (stbrp_coord)pack_padding;
+    r->w -= (stbrp_coord)pack_padding;
+    r->h -= (stbrp_coord)pack_padding;
+
+    // Edge at 128, fading out to 0 at 'SDFPadding' pixels away
+    int w = 0, h = 0, xoff = 0, yoff = 0;
+    unsigned char* sdf = stbtt_GetGlyphSDF(font_info, scale, glyph, src->SDFPadding, 128, 128.0f / src->SDFPadding, &w, &h, &xoff, &yoff);
+    if (sdf != NULL)
+    {
+        IM_ASSERT(w <= r->w && h <= r->h);
+        for (int y = 0; y < h; y++)
+            memcpy(pixels + r->x + (r->y + y) * stride, sdf + y * w, (size_t)w);
+        stbtt_FreeSDF(sdf, font_info->userdata);
+    }
+    out->x0 = (unsigned short)r->x;
+    out->y0 = (unsigned short)r->y;
+    out->x1 = (unsigned short)(r->x + w);
+    out->y1 = (unsigned short)(r->y + h);
+    out->xadvance = scale * advance;
+    out->xoff = (float)xoff;
+    out->yoff = (float)yoff;
+    out->xoff2 = (float)(xoff + w);
+    out->yoff2 = (float)(yoff + h);
+}
+
+// A chunk of consecutive glyphs from one source font, rasterized by a single job.
+struct ImFontBuildRenderJob
+{
+    int                 SrcIndex;
+    int                 GlyphStart;
+    int                 GlyphCount;
+};
+
+struct ImFontBuildRenderJobsData
+{
+    ImFontAtlas*                    Atlas;
+    const stbtt_pack_context*       PackContext;
+    ImVector<ImFontBuildSrcData>*   SrcTmpArray;
+    ImVector<ImFontBuildRenderJob>  Jobs;
+    ImFontBuildThreadAllocator      Allocator;
+};
+
+// Rasterize one chunk of glyphs. This may run concurrently with other chunks:
+// - stb_truetype temporarily writes into the pack context, so we use a local copy.
+// - Packed rectangles never overlap, so each job writes to its own texels and the output is identical to a serial build.
+static void ImFontAtlasBuildRenderGlyphsJob(void* user_data, int job_index)
+{
+    ImFontBuildRenderJobsData* data = (ImFontBuildRenderJobsData*)user_data;
+    const ImFontBuildRenderJob& job = data->Jobs[job_index];
+    ImFontBuildSrcData& src_tmp = (*data->SrcTmpArray)[job.SrcIndex];
+    const ImFontConfig& src = data->Atlas->Sources[job.SrcIndex];
+
+    stbtt_pack_context spc = *data->PackContext;
+    stbtt_fontinfo font_info = src_tmp.FontInfo;
+    font_info.userdata = &data->Allocator;
+    stbtt_pack_range pack_range = src_tmp.PackRange;
+    pack_range.array_of_unicode_codepoints = src_tmp.GlyphsList.Data + job.GlyphStart;
+    pack_range.chardata_for_range = src_tmp.PackedChars + job.GlyphStart;
+    pack_range.num_chars = job.GlyphCount;
+    stbrp_rect* rects = src_tmp.Rects + job.GlyphStart;
+    if (src.SDF)
+    {
+        const float scale = (pack_range.font_size > 0.0f) ? stbtt_ScaleForPixelHeight(&font_info, pack_range.font_size) : stbtt_ScaleForMappingEmToPixels(&font_info, -pack_range.font_size);
+        for (int glyph_i = 0; glyph_i < job.GlyphCount; glyph_i++)
+            ImFontAtlasBuildRenderGlyphSDF(&font_info, &src, scale, pack_range.array_of_unicode_codepoints[glyph_i], spc.padding, &rects[glyph_i], spc.pixels, spc.stride_in_bytes, &pack_range.chardata_for_range[glyph_i]);
+        return;
+    }
+    stbtt_PackFontRangesRenderIntoRects(&spc, &font_info, &pack_range, 1, rects);
+
+    // Apply multiply operator
+    if (src.RasterizerMultiply != 1.0f)
+    {
+        unsigned char multiply_table[256];
+        ImFontAtlasBuildMultiplyCalcLookupTable(multiply_table, src.RasterizerMultiply);
+        stbrp_rect* r = rects;
+        for (int glyph_i = 0; glyph_i < job.GlyphCount; glyph_i++, r++)
+            if (r->was_packed)
+                ImFontAtlasBuildMultiplyRectAlpha8(multiply_table, spc.pixels, r->x, r->y, r->w, r->h, spc.stride_in_bytes);
+    }
+}
+
+static bool ImFontAtlasBuildIsGlyphBakedWhenDynamic(unsigned int codepoint);
+static void ImFontAtlasBuildSetupDynamicGlyphs(ImFontAtlas* atlas, ImVector<ImFontBuildSrcData>& src_tmp_array, int pages_y, int page_height);
+static void ImFontAtlasBuildKerningPairs(ImFontAtlas* atlas, ImVector<ImFontBuildSrcData>& src_tmp_array);
+
 static void UnpackBitVectorToFlatIndexList(const ImBitVector* in, ImVector<int>* out)
 {
     IM_ASSERT(sizeof(in->Storage.Data[0]) == sizeof(int));
@@ -2878,14 +3478,31 @@ static void UnpackBitVectorToFlatIndexList(const ImBitVector* in, ImVector<int>*
                     out->push_back((int)(((it - it_begin) << 5) + bit_n));
 }
 
+static void ImFontAtlasBuildFreeSrcAccel(ImVector<ImFontBuildSrcData>& src_tmp_array)
+{
+#ifdef STBTT_HAS_FONT_ACCEL
+    for (ImFontBuildSrcData& src_tmp : src_tmp_array)
+        stbtt_FreeFontAccel(&src_tmp.FontInfo);
+#else
+    IM_UNUSED(src_tmp_array);
+#endif
+}
+
 static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
 {
     IM_ASSERT(atlas->Sources.Size > 0);
 
+    ImFontAtlasBuildStats& stats = atlas->BuildStats;
+    stats = ImFontAtlasBuildStats();
+    const double time_start = ImTimeGetSeconds();
+    double time_phase = time_start;
+    const bool dynamic_glyphs = (atlas->Flags & ImFontAtlasFlags_DynamicGlyphs) != 0;
+    IM_ASSERT((!dynamic_glyphs || atlas->Sources.Size < 0x7F) && "ImFontAtlasFlags_DynamicGlyphs supports up to 126 source fonts.");
+
     ImFontAtlasBuildInit(atlas);
 
     // Clear atlas
-    atlas->TexID = (ImTextureID)NULL;
+    atlas->TexID = atlas->TexIDSDF = (ImTextureID)NULL;
     atlas->TexWidth = atlas->TexHeight = 0;
     atlas->TexUvScale = ImVec2(0.0f, 0.0f);
     atlas->TexUvWhitePixel = ImVec2(0.0f, 0.0f);
@@ -2914,6 +3531,7 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
         if (src_tmp.DstIndex == -1)
         {
             IM_ASSERT(src_tmp.DstIndex != -1); // src.DstFont not pointing within atlas->Fonts[] array?
+            ImFontAtlasBuildFreeSrcAccel(src_tmp_array);
             return false;
         }
         // Initialize helper structure for font loading and verify that the TTF/OTF data is correct
@@ -2922,12 +3540,14 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
         if (!stbtt_InitFont(&src_tmp.FontInfo, (unsigned char*)src.FontData, font_offset))
         {
             IM_ASSERT(0 && "stbtt_InitFont(): failed to parse FontData. It is correct and complete? Check FontDataSize.");
+            ImFontAtlasBuildFreeSrcAccel(src_tmp_array);
             return false;
         }
 
         // Measure highest codepoints
         ImFontBuildDstData& dst_tmp = dst_tmp_array[src_tmp.DstIndex];
         src_tmp.SrcRanges = src.GlyphRanges ? src.GlyphRanges : atlas->GetGlyphRangesDefault();
+        int codepoints_count = 0;
         for (const ImWchar* src_range = src_tmp.SrcRanges; src_range[0] && src_range[1]; src_range += 2)
         {
             // Check for valid range. This may also help detect *some* dangling pointers, because a common
@@ -2935,13 +3555,20 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
             // or to forget to zero-terminate the glyph range array.
             IM_ASSERT(src_range[0] <= src_range[1] && "Invalid range: is your glyph range array persistent? it is zero-terminated?");
             src_tmp.GlyphsHighest = ImMax(src_tmp.GlyphsHighest, (int)src_range[1]);
+            codepoints_count += (int)src_range[1] - (int)src_range[0] + 1;
         }
+#ifdef STBTT_HAS_FONT_ACCEL
+        if (codepoints_count >= IM_FONT_ATLAS_ACCEL_MIN_CODEPOINTS)
+            stbtt_InitFontAccel(&src_tmp.FontInfo); // Optional: lookups fall back to parsing the font data on failure
+#endif
         dst_tmp.SrcCount++;
         dst_tmp.GlyphsHighest = ImMax(dst_tmp.GlyphsHighest, src_tmp.GlyphsHighest);
     }
 
     // 2. For every requested codepoint, check for their presence in the font data, and handle redundancy or overlaps between source fonts to avoid unused glyphs.
+    // With ImFontAtlasFlags_DynamicGlyphs, only a small subset is baked now and others are set aside for on-demand rasterization.
     int total_glyphs_count = 0;
+    int dynamic_glyphs_count = 0;
     for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
     {
         ImFontBuildSrcData& src_tmp = src_tmp_array[src_i];
@@ -2957,6 +3584,13 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
                     continue;
                 if (!stbtt_FindGlyphIndex(&src_tmp.FontInfo, codepoint))    // It is actually in the font?
                     continue;
+                if (dynamic_glyphs && !ImFontAtlasBuildIsGlyphBakedWhenDynamic(codepoint))
+                {
+                    src_tmp.DynamicGlyphsList.push_back((int)codepoint);
+                    dst_tmp.GlyphsSet.SetBit(codepoint);
+                    dynamic_glyphs_count++;
+                    continue;
+                }
 
                 // Add to avail set/counters
                 src_tmp.GlyphsCount++;
@@ -2979,6 +3613,9 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
     for (int dst_i = 0; dst_i < dst_tmp_array.Size; dst_i++)
         dst_tmp_array[dst_i].GlyphsSet.Clear();
     dst_tmp_array.clear();
+    stats.GlyphsCount = total_glyphs_count;
+    stats.TimeInit = (float)((ImTimeGetSeconds() - time_phase) * 1000.0);
+    time_phase = ImTimeGetSeconds();
 
     // Allocate packing character data and flag packed characters buffer as non-packed (x0=y0=x1=y1=0)
     // (We technically don't need to zero-clear buf_rects, but let's do it for the sake of sanity)
@@ -3023,17 +3660,16 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
         const float scale = (src.SizePixels > 0.0f) ? stbtt_ScaleForPixelHeight(&src_tmp.FontInfo, src.SizePixels * src.RasterizerDensity) : stbtt_ScaleForMappingEmToPixels(&src_tmp.FontInfo, -src.SizePixels * src.RasterizerDensity);
         for (int glyph_i = 0; glyph_i < src_tmp.GlyphsList.Size; glyph_i++)
         {
-            int x0, y0, x1, y1;
             const int glyph_index_in_font = stbtt_FindGlyphIndex(&src_tmp.FontInfo, src_tmp.GlyphsList[glyph_i]);
             IM_ASSERT(glyph_index_in_font != 0);
-            stbtt_GetGlyphBitmapBoxSubpixel(&src_tmp.FontInfo, glyph_index_in_font, scale * oversample_h, scale * oversample_v, 0, 0, &x0, &y0, &x1, &y1);
-            src_tmp.Rects[glyph_i].w = (stbrp_coord)(x1 - x0 + pack_padding + oversample_h - 1);
-            src_tmp.Rects[glyph_i].h = (stbrp_coord)(y1 - y0 + pack_padding + oversample_v - 1);
+            ImFontAtlasBuildCalcGlyphRect(&src_tmp.FontInfo, &src, glyph_index_in_font, scale, oversample_h, oversample_v, pack_padding, &src_tmp.Rects[glyph_i]);
             total_surface += src_tmp.Rects[glyph_i].w * src_tmp.Rects[glyph_i].h;
         }
     }
     for (int i = 0; i < atlas->CustomRects.Size; i++)
         total_surface += (atlas->CustomRects[i].Width + pack_padding) * (atlas->CustomRects[i].Height + pack_padding);
+    stats.TimeGather = (float)((ImTimeGetSeconds() - time_phase) * 1000.0);
+    time_phase = ImTimeGetSeconds();
 
     // We need a width for the skyline algorithm, any width!
     // The exact width doesn't really matter much, but some API/GPU have texture size limitations and increasing width can decrease height.
@@ -3069,8 +3705,36 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
                 atlas->TexHeight = ImMax(atlas->TexHeight, src_tmp.Rects[glyph_i].y + src_tmp.Rects[glyph_i].h);
     }
 
+    stats.TimePack = (float)((ImTimeGetSeconds() - time_phase) * 1000.0);
+    time_phase = ImTimeGetSeconds();
+
     // 7. Allocate texture
+    // With ImFontAtlasFlags_DynamicGlyphs, reserve an area below packed glyphs for glyphs rasterized on demand.
+    // It is split into pages tall enough for a few rows of the tallest glyph, so eviction can work per page.
+    int dynamic_pages_y = 0;
+    int dynamic_page_height = 0;
+    if (dynamic_glyphs_count > 0)
+    {
+        for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
+        {
+            ImFontBuildSrcData& src_tmp = src_tmp_array[src_i];
+            if (src_tmp.DynamicGlyphsList.Size == 0)
+                continue;
+            ImFontConfig& src = atlas->Sources[src_i];
+            int oversample_h, oversample_v;
+            ImFontAtlasBuildGetOversampleFactors(&src, &oversample_h, &oversample_v);
+            const float scale = (src.SizePixels > 0.0f) ? stbtt_ScaleForPixelHeight(&src_tmp.FontInfo, src.SizePixels * src.RasterizerDensity) : stbtt_ScaleForMappingEmToPixels(&src_tmp.FontInfo, -src.SizePixels * src.RasterizerDensity);
+            int x0, y0, x1, y1;
+            stbtt_GetFontBoundingBox(&src_tmp.FontInfo, &x0, &y0, &x1, &y1);
+            const int glyph_height_max = (int)ImCeil((y1 - y0) * scale * oversample_v) + (src.SDF ? src.SDFPadding * 2 : 0) + pack_padding + oversample_v;
+            dynamic_page_height = ImMax(dynamic_page_height, glyph_height_max * IM_FONT_ATLAS_DYNAMIC_PAGE_ROWS);
+        }
+        dynamic_pages_y = atlas->TexHeight + pack_padding;
+        atlas->TexHeight = dynamic_pages_y + dynamic_page_height * IM_FONT_ATLAS_DYNAMIC_PAGES_COUNT;
+    }
     atlas->TexHeight = (atlas->Flags & ImFontAtlasFlags_NoPowerOfTwoHeight) ? (atlas->TexHeight + 1) : ImUpperPowerOfTwo(atlas->TexHeight);
+    if (dynamic_glyphs_count > 0)
+        dynamic_page_height = (atlas->TexHeight - dynamic_pages_y) / IM_FONT_ATLAS_DYNAMIC_PAGES_COUNT; // Make use of rounding slack
     atlas->TexUvScale = ImVec2(1.0f / atlas->TexWidth, 1.0f / atlas->TexHeight);
     atlas->TexPixelsAlpha8 = (unsigned char*)IM_ALLOC(atlas->TexWidth * atlas->TexHeight);
     memset(atlas->TexPixelsAlpha8, 0, atlas->TexWidth * atlas->TexHeight);
@@ -3078,27 +3742,29 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
     spc.height = atlas->TexHeight;
 
     // 8. Render/rasterize font characters into the texture
+    // Split every source font into chunks of glyphs, small enough to balance the work between threads.
+    ImFontBuildRenderJobsData render_data;
+    render_data.Atlas = atlas;
+    render_data.PackContext = &spc;
+    render_data.SrcTmpArray = &src_tmp_array;
+    ImGui::GetAllocatorFunctions(&render_data.Allocator.AllocFunc, &render_data.Allocator.FreeFunc, &render_data.Allocator.UserData);
+    const int glyphs_per_job = ImMax(64, total_glyphs_count / (ImThreadGetWorkersCount() * 8));
     for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
-    {
-        ImFontConfig& src = atlas->Sources[src_i];
-        ImFontBuildSrcData& src_tmp = src_tmp_array[src_i];
-        if (src_tmp.GlyphsCount == 0)
-            continue;
-
-        stbtt_PackFontRangesRenderIntoRects(&spc, &src_tmp.FontInfo, &src_tmp.PackRange, 1, src_tmp.Rects);
-
-        // Apply multiply operator
-        if (src.RasterizerMultiply != 1.0f)
+        for (int glyph_start = 0; glyph_start < src_tmp_array[src_i].GlyphsCount; glyph_start += glyphs_per_job)
         {
-            unsigned char multiply_table[256];
-            ImFontAtlasBuildMultiplyCalcLookupTable(multiply_table, src.RasterizerMultiply);
-            stbrp_rect* r = &src_tmp.Rects[0];
-            for (int glyph_i = 0; glyph_i < src_tmp.GlyphsCount; glyph_i++, r++)
-                if (r->was_packed)
-                    ImFontAtlasBuildMultiplyRectAlpha8(multiply_table, atlas->TexPixelsAlpha8, r->x, r->y, r->w, r->h, atlas->TexWidth * 1);
+            ImFontBuildRenderJob job;
+            job.SrcIndex = src_i;
+            job.GlyphStart = glyph_start;
+            job.GlyphCount = ImMin(glyphs_per_job, src_tmp_array[src_i].GlyphsCount - glyph_start);
+            render_data.Jobs.push_back(job);
         }
-        src_tmp.Rects = NULL;
-    }
+    ImParallelFor(render_data.Jobs.Size, ImFontAtlasBuildRenderGlyphsJob, &render_data);
+    for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
+        src_tmp_array[src_i].Rects = NULL;
+    stats.RenderJobsCount = render_data.Jobs.Size;
+    stats.RenderThreadsCount = ImMin(ImThreadGetWorkersCount(), ImMax(render_data.Jobs.Size, 1));
+    stats.TimeRender = (float)((ImTimeGetSeconds() - time_phase) * 1000.0);
+    time_phase = ImTimeGetSeconds();
 
     // End packing
     stbtt_PackEnd(&spc);
@@ -3142,10 +3808,20 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
         }
     }
 
+    ImFontAtlasBuildFinish(atlas);
+
+    // 10. Register glyphs to rasterize on demand
+    if (dynamic_glyphs_count > 0)
+        ImFontAtlasBuildSetupDynamicGlyphs(atlas, src_tmp_array, dynamic_pages_y, dynamic_page_height);
+
+    // 11. Flatten kerning tables (ImFontConfig::Kerning)
+    ImFontAtlasBuildKerningPairs(atlas, src_tmp_array);
+
     // Cleanup
+    ImFontAtlasBuildFreeSrcAccel(src_tmp_array);
     src_tmp_array.clear_destruct();
-
-    ImFontAtlasBuildFinish(atlas);
+    stats.TimeSetup = (float)((ImTimeGetSeconds() - time_phase) * 1000.0);
+    stats.TimeTotal = (float)((ImTimeGetSeconds() - time_start) * 1000.0);
     return true;
 }
 
@@ -3156,42 +3832,582 @@ const ImFontBuilderIO* ImFontAtlasGetBuilderForStbTruetype()
     return &io;
 }
 
-#endif // IMGUI_ENABLE_STB_TRUETYPE
+// Glyphs rasterized on demand (ImFontAtlasFlags_DynamicGlyphs)
+// - Build() only bakes Latin glyphs + a few special ones. Other requested and available glyphs have their advance registered
+//   (so text layout is final from the first frame) and are rasterized the first time ImFont::FindGlyph() is called for them.
+// - FindGlyph() queues the request and returns an invisible placeholder: glyphs appear on the frame following their first use.
+// - Queued glyphs are rasterized by ImGui::NewFrame() into a texture area reserved by Build(), split in pages packed with stb_rectpack.
+//   Pages use the MaxRects packer: glyphs arrive one at a time in no particular order, which wastes a lot of space with a skyline.
+//   With a stock stb_rect_pack.h (no STBRP_HAS_MAXRECTS), pages use the skyline packer instead.
+// - When no page has room left, the least recently used page is evicted: its glyphs are removed and will be queued again if used.
+// - The renderer backend uploads the modified region (ImFontAtlas::GetTexUpdateRect()) before rendering.
+struct ImFontAtlasDynamicGlyphRef
+{
+    ImFont*             Font;
+    ImWchar             Codepoint;
+    ImU16               GlyphIndex;         // Index into Font->Glyphs[] (unused while queued)
+};
 
-void ImFontAtlasUpdateSourcesPointers(ImFontAtlas* atlas)
+struct ImFontAtlasDynamicSrc
 {
-    for (ImFontConfig& src : atlas->Sources)
-    {
-        ImFont* font = src.DstFont;
-        if (!src.MergeMode)
-        {
-            font->Sources = &src;
-            font->SourcesCount = 0;
-        }
-        font->SourcesCount++;
-    }
+    stbtt_fontinfo      FontInfo;
+    float               Scale;              // Scale at rasterization density
+    int                 OversampleH;
+    int                 OversampleV;
+};
+
+struct ImFontAtlasDynamicPage
+{
+    int                 Y;                  // Top of the page in texture
+    int                 LastUsedFrame;
+    stbrp_context       PackContext;        // Points to its own data: pages are never moved once initialized.
+    ImVector<stbrp_node> PackNodes;
+    ImVector<ImFontAtlasDynamicGlyphRef> Glyphs;
+};
+
+struct ImFontAtlasDynamicData
+{
+    int                 FrameCount;
+    int                 PageHeight;
+    int                 CurrentPage;        // Page we are packing into
+    int                 GlyphsRasterized;
+    int                 PagesEvicted;
+    ImVector<ImFontAtlasDynamicSrc>  Sources;   // Parallel to atlas->Sources[]
+    ImVector<ImFontAtlasDynamicPage> Pages;
+    ImVector<ImFontAtlasDynamicGlyphRef> Queue;
+
+    ImFontAtlasDynamicData()    { FrameCount = PageHeight = CurrentPage = GlyphsRasterized = PagesEvicted = 0; }
+};
+
+// Glyphs always baked by Build() with ImFontAtlasFlags_DynamicGlyphs: Basic Latin + Latin-1, and characters used by ImFont::BuildLookupTable() for fallback and ellipsis.
+static bool ImFontAtlasBuildIsGlyphBakedWhenDynamic(unsigned int codepoint)
+{
+    return codepoint <= 0xFF || codepoint == IM_UNICODE_CODEPOINT_INVALID || codepoint == 0x2026 || codepoint == 0xFF0E;
 }
 
-void ImFontAtlasBuildSetupFont(ImFontAtlas* atlas, ImFont* font, ImFontConfig* font_config, float ascent, float descent)
+// Same as the processing done by ImFont::AddGlyph()
+static float ImFontAtlasDynamicCalcAdvanceX(const ImFontConfig* src, float advance_x)
 {
-    if (!font_config->MergeMode)
-    {
-        font->ClearOutputData();
-        font->FontSize = font_config->SizePixels;
-        IM_ASSERT(font->Sources == font_config);
-        font->ContainerAtlas = atlas;
-        font->Ascent = ascent;
-        font->Descent = descent;
-    }
+    advance_x = ImClamp(advance_x, src->GlyphMinAdvanceX, src->GlyphMaxAdvanceX);
+    if (src->PixelSnapH)
+        advance_x = IM_ROUND(advance_x);
+    return advance_x + src->GlyphExtraAdvanceX;
 }
 
-void ImFontAtlasBuildPackCustomRects(ImFontAtlas* atlas, void* stbrp_context_opaque)
+static void ImFontAtlasDynamicResetPagePacker(ImFontAtlasDynamicPage& page, int width, int height)
 {
-    stbrp_context* pack_context = (stbrp_context*)stbrp_context_opaque;
-    IM_ASSERT(pack_context != NULL);
+#ifdef STBRP_HAS_MAXRECTS
+    stbrp_init_target_maxrects(&page.PackContext, width, height, page.PackNodes.Data, page.PackNodes.Size);
+#else
+    stbrp_init_target(&page.PackContext, width, height, page.PackNodes.Data, page.PackNodes.Size);
+#endif
+}
 
-    ImVector<ImFontAtlasCustomRect>& user_rects = atlas->CustomRects;
-    IM_ASSERT(user_rects.Size >= 1); // We expect at least the default custom rects to be registered, else something went wrong.
+static void ImFontAtlasBuildSetupDynamicGlyphs(ImFontAtlas* atlas, ImVector<ImFontBuildSrcData>& src_tmp_array, int pages_y, int page_height)
+{
+    IM_ASSERT(atlas->DynamicData == NULL);
+    ImFontAtlasDynamicData* data = IM_NEW(ImFontAtlasDynamicData)();
+    atlas->DynamicData = data;
+    data->PageHeight = page_height;
+
+    // Pages (stbrp_context are pointing to themselves, so we never resize this array again)
+    data->Pages.resize(IM_FONT_ATLAS_DYNAMIC_PAGES_COUNT);
+    memset(data->Pages.Data, 0, (size_t)data->Pages.size_in_bytes());
+    for (int page_n = 0; page_n < data->Pages.Size; page_n++)
+    {
+        ImFontAtlasDynamicPage& page = data->Pages[page_n];
+        page.Y = pages_y + page_n * page_height;
+        page.LastUsedFrame = -1;
+        page.PackNodes.resize(atlas->TexWidth);
+        ImFontAtlasDynamicResetPagePacker(page, atlas->TexWidth, page_height);
+    }
+
+    // Map available code-points to their source font
+    data->Sources.resize(atlas->Sources.Size);
+    memset(data->Sources.Data, 0, (size_t)data->Sources.size_in_bytes());
+    for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
+    {
+        ImFontBuildSrcData& src_tmp = src_tmp_array[src_i];
+        ImFontConfig& src = atlas->Sources[src_i];
+        ImFontAtlasDynamicSrc& dyn_src = data->Sources[src_i];
+        dyn_src.FontInfo = src_tmp.FontInfo;
+#ifdef STBTT_HAS_FONT_ACCEL
+        src_tmp.FontInfo.accel = NULL; // Acceleration tables are now owned by dyn_src.FontInfo
+#endif
+        dyn_src.Scale = (src.SizePixels > 0.0f) ? stbtt_ScaleForPixelHeight(&src_tmp.FontInfo, src.SizePixels * src.RasterizerDensity) : stbtt_ScaleForMappingEmToPixels(&src_tmp.FontInfo, -src.SizePixels * src.RasterizerDensity);
+        ImFontAtlasBuildGetOversampleFactors(&src, &dyn_src.OversampleH, &dyn_src.OversampleV);
+
+        ImFont* dst_font = src.DstFont;
+        for (int codepoint : src_tmp.DynamicGlyphsList)
+        {
+            if (codepoint >= dst_font->DynamicIndexSrc.Size)
+                dst_font->DynamicIndexSrc.resize(codepoint + 1, 0);
+            dst_font->DynamicIndexSrc[codepoint] = (ImU8)(src_i + 1);
+        }
+    }
+
+    // Grow lookup tables to cover all available code-points
+    for (ImFont* font : atlas->Fonts)
+    {
+        if (font->DynamicIndexSrc.Size == 0)
+            continue;
+        const int old_size = font->IndexAdvanceX.Size;
+        font->GrowIndex(font->DynamicIndexSrc.Size);
+        for (int n = old_size; n < font->IndexAdvanceX.Size; n++)
+            font->IndexAdvanceX[n] = font->FallbackAdvanceX;
+        font->DynamicGlyphsPage.resize(font->Glyphs.Size, 0xFF);
+    }
+
+    // Register advances, so CalcTextSize() doesn't depend on a glyph being rasterized yet
+    for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
+    {
+        ImFontBuildSrcData& src_tmp = src_tmp_array[src_i];
+        ImFontConfig& src = atlas->Sources[src_i];
+        ImFont* dst_font = src.DstFont;
+        for (int codepoint : src_tmp.DynamicGlyphsList)
+        {
+            int advance, lsb;
+            stbtt_GetGlyphHMetrics(&src_tmp.FontInfo, stbtt_FindGlyphIndex(&src_tmp.FontInfo, codepoint), &advance, &lsb);
+            dst_font->IndexAdvanceX[codepoint] = ImFontAtlasDynamicCalcAdvanceX(&src, advance * data->Sources[src_i].Scale / src.RasterizerDensity);
+            const int page_n = codepoint / 8192;
+            dst_font->Used8kPagesMap[page_n >> 3] |= 1 << (page_n & 7);
+        }
+        atlas->BuildStats.DynamicGlyphsAvailable += src_tmp.DynamicGlyphsList.Size;
+    }
+    atlas->BuildStats.DynamicPagesCount = data->Pages.Size;
+}
+
+static void ImFontBuildKerningTable(ImFont* font, const ImVector<ImFontKerningPair>& pairs)
+{
+    font->KerningPairs.clear();
+    if (pairs.Size == 0)
+        return;
+    font->KerningPairs.resize(ImUpperPowerOfTwo(pairs.Size * 4));
+    memset(font->KerningPairs.Data, 0, (size_t)font->KerningPairs.size_in_bytes());
+    const ImU32 mask = (ImU32)font->KerningPairs.Size - 1;
+    for (const ImFontKerningPair& pair : pairs)
+    {
+        ImU32 slot = ImFontKerningHash(pair.Left, pair.Right) & mask;
+        while (font->KerningPairs.Data[slot].Left != 0)
+            slot = (slot + 1) & mask;
+        font->KerningPairs.Data[slot] = pair;
+    }
+}
+
+// Output every pair of glyphs flagged in glyph_filter[] with a non-zero stbtt_GetGlyphKernAdvance()
+static void ImFontAtlasBuildGetGlyphKernPairs(const stbtt_fontinfo* font_info, const ImVector<unsigned char>& glyph_filter, ImVector<stbtt_kerningentry>* out_entries)
+{
+#ifdef STBTT_HAS_GLYPH_KERN_PAIRS
+    out_entries->resize(out_entries->Capacity);
+    int entries_count = stbtt_GetGlyphKernPairs(font_info, glyph_filter.Data, out_entries->Data, out_entries->Size);
+    if (entries_count > out_entries->Size)
+    {
+        out_entries->resize(entries_count);
+        entries_count = stbtt_GetGlyphKernPairs(font_info, glyph_filter.Data, out_entries->Data, out_entries->Size);
+    }
+    out_entries->resize(ImMax(entries_count, 0)); // -1 on allocation failure
+#else
+    // Stock stb_truetype.h: the 'kern' table can be listed, but 'GPOS' kerning can only be queried pair by pair.
+    // This is quadratic in the number of glyphs: use our imstb_truetype.h with large glyph ranges.
+    out_entries->resize(0);
+    if (font_info->gpos == 0)
+    {
+        out_entries->resize(stbtt_GetKerningTableLength(font_info));
+        out_entries->resize(stbtt_GetKerningTable(font_info, out_entries->Data, out_entries->Size));
+        int entries_count = 0;
+        for (const stbtt_kerningentry& entry : *out_entries)
+            if (entry.advance != 0 && entry.glyph1 >= 0 && entry.glyph1 < glyph_filter.Size && entry.glyph2 >= 0 && entry.glyph2 < glyph_filter.Size && glyph_filter[entry.glyph1] && glyph_filter[entry.glyph2])
+                (*out_entries)[entries_count++] = entry;
+        out_entries->resize(entries_count);
+        return;
+    }
+    ImVector<int> glyphs;
+    for (int glyph_index = 0; glyph_index < glyph_filter.Size; glyph_index++)
+        if (glyph_filter[glyph_index])
+            glyphs.push_back(glyph_index);
+    for (int glyph1 : glyphs)
+        for (int glyph2 : glyphs)
+            if (int advance = stbtt_GetGlyphKernAdvance(font_info, glyph1, glyph2))
+            {
+                stbtt_kerningentry entry;
+                entry.glyph1 = glyph1;
+                entry.glyph2 = glyph2;
+                entry.advance = advance;
+                out_entries->push_back(entry);
+            }
+#endif
+}
+
+static void ImFontAtlasBuildKerningPairs(ImFontAtlas* atlas, ImVector<ImFontBuildSrcData>& src_tmp_array)
+{
+    ImVector<ImFontKerningPair> pairs;
+    ImVector<stbtt_kerningentry> entries;
+    ImVector<unsigned char> glyph_filter;
+    ImVector<int> glyph_first_codepoint;    // Glyph index -> index in codepoints[] (several code-points may share a glyph)
+    ImVector<int> codepoints;
+    ImVector<int> codepoints_next;          // Index in codepoints[] -> next code-point using the same glyph
+    for (ImFont* font : atlas->Fonts)
+    {
+        pairs.resize(0);
+        for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
+        {
+            ImFontBuildSrcData& src_tmp = src_tmp_array[src_i];
+            const ImFontConfig& src = atlas->Sources[src_i];
+            const stbtt_fontinfo& font_info = src_tmp.FontInfo;
+            if (src.DstFont != font || !src.Kerning || (font_info.gpos == 0 && font_info.kern == 0))
+                continue;
+
+            // Only consider glyphs of code-points provided by this source
+            glyph_filter.resize(0);
+            glyph_filter.resize(font_info.numGlyphs, 0);
+            glyph_first_codepoint.resize(0);
+            glyph_first_codepoint.resize(font_info.numGlyphs, -1);
+            codepoints.resize(0);
+            codepoints_next.resize(0);
+            for (int list_n = 0; list_n < 2; list_n++)
+                for (int codepoint : (list_n == 0) ? src_tmp.GlyphsList : src_tmp.DynamicGlyphsList)
+                {
+                    const int glyph_index = stbtt_FindGlyphIndex(&font_info, codepoint);
+                    if (glyph_index <= 0 || glyph_index >= font_info.numGlyphs)
+                        continue;
+                    glyph_filter[glyph_index] = 1;
+                    codepoints_next.push_back(glyph_first_codepoint[glyph_index]);
+                    glyph_first_codepoint[glyph_index] = codepoints.Size;
+                    codepoints.push_back(codepoint);
+                }
+
+            ImFontAtlasBuildGetGlyphKernPairs(&font_info, glyph_filter, &entries);
+
+            const float scale = (src.SizePixels > 0.0f) ? stbtt_ScaleForPixelHeight(&font_info, src.SizePixels) : stbtt_ScaleForMappingEmToPixels(&font_info, -src.SizePixels);
+            for (const stbtt_kerningentry& entry : entries)
+            {
+                float advance_x = entry.advance * scale;
+                if (src.PixelSnapH)
+                    advance_x = IM_ROUND(advance_x);
+                if (advance_x == 0.0f)
+                    continue;
+                for (int cp_prev_n = glyph_first_codepoint[entry.glyph1]; cp_prev_n != -1; cp_prev_n = codepoints_next[cp_prev_n])
+                    for (int cp_n = glyph_first_codepoint[entry.glyph2]; cp_n != -1; cp_n = codepoints_next[cp_n])
+                    {
+                        ImFontKerningPair pair;
+                        pair.Left = (ImWchar)codepoints[cp_prev_n];
+                        pair.Right = (ImWchar)codepoints[cp_n];
+                        pair.AdvanceX = advance_x;
+                        pairs.push_back(pair);
+                    }
+            }
+        }
+        ImFontBuildKerningTable(font, pairs);
+        atlas->BuildStats.KerningPairsCount += pairs.Size;
+    }
+}
+
+static void ImFontAtlasDynamicMarkDirty(ImFontAtlas* atlas, int x, int y, int w, int h)
+{
+    int* r = atlas->TexUpdateRect;
+    if (r[2] <= r[0])
+    {
+        r[0] = x; r[1] = y; r[2] = x + w; r[3] = y + h;
+        return;
+    }
+    r[0] = ImMin(r[0], x); r[1] = ImMin(r[1], y);
+    r[2] = ImMax(r[2], x + w); r[3] = ImMax(r[3], y + h);
+}
+
+// Copy alpha values into the RGBA32 texture data, if it was requested by the backend.
+static void ImFontAtlasDynamicUpdateRGBA32(ImFontAtlas* atlas, int x, int y, int w, int h)
+{
+    if (atlas->TexPixelsRGBA32 == NULL)
+        return;
+    for (int ny = y; ny < y + h; ny++)
+    {
+        const unsigned char* src = atlas->TexPixelsAlpha8 + ny * atlas->TexWidth + x;
+        unsigned int* dst = atlas->TexPixelsRGBA32 + ny * atlas->TexWidth + x;
+        for (int n = w; n > 0; n--)
+            *dst++ = IM_COL32(255, 255, 255, (unsigned int)(*src++));
+    }
+}
+
+static void ImFontAtlasDynamicEvictPage(ImFontAtlas* atlas, int page_n)
+{
+    ImFontAtlasDynamicData* data = atlas->DynamicData;
+    ImFontAtlasDynamicPage& page = data->Pages[page_n];
+    for (const ImFontAtlasDynamicGlyphRef& ref : page.Glyphs)
+    {
+        ImFont* font = ref.Font;
+        font->IndexLookup[ref.Codepoint] = (ImU16)-1;
+        font->DynamicGlyphsPage[ref.GlyphIndex] = 0xFF;
+        font->DynamicFreeGlyphs.push_back(ref.GlyphIndex);
+    }
+    page.Glyphs.resize(0);
+    ImFontAtlasDynamicResetPagePacker(page, atlas->TexWidth, data->PageHeight);
+    memset(atlas->TexPixelsAlpha8 + page.Y * atlas->TexWidth, 0, (size_t)(atlas->TexWidth * data->PageHeight));
+    ImFontAtlasDynamicUpdateRGBA32(atlas, 0, page.Y, atlas->TexWidth, data->PageHeight);
+    ImFontAtlasDynamicMarkDirty(atlas, 0, page.Y, atlas->TexWidth, data->PageHeight);
+    data->PagesEvicted++;
+}
+
+// Pack into current page, otherwise switch to an empty page or evict the least recently used one.
+// Pages which received glyphs during this update are not evicted. Return -1 if no page is available now.
+static int ImFontAtlasDynamicPackRect(ImFontAtlas* atlas, stbrp_rect* r)
+{
+    ImFontAtlasDynamicData* data = atlas->DynamicData;
+    stbrp_pack_rects(&data->Pages[data->CurrentPage].PackContext, r, 1);
+    if (r->was_packed)
+        return data->CurrentPage;
+
+    int best_page_n = -1;
+    for (int page_n = 0; page_n < data->Pages.Size; page_n++)
+    {
+        const ImFontAtlasDynamicPage& page = data->Pages[page_n];
+        if (page.Glyphs.Size == 0 && page_n != data->CurrentPage)
+        {
+            best_page_n = page_n;
+            break;
+        }
+        if (page.LastUsedFrame < data->FrameCount && (best_page_n == -1 || page.LastUsedFrame < data->Pages[best_page_n].LastUsedFrame))
+            best_page_n = page_n;
+    }
+    if (best_page_n == -1)
+        return -1;
+    if (data->Pages[best_page_n].Glyphs.Size > 0)
+        ImFontAtlasDynamicEvictPage(atlas, best_page_n);
+    data->CurrentPage = best_page_n;
+    stbrp_pack_rects(&data->Pages[best_page_n].PackContext, r, 1);
+    IM_ASSERT(r->was_packed);
+    return best_page_n;
+}
+
+// Return false if the glyph couldn't be stored this frame.
+static bool ImFontAtlasDynamicRenderGlyph(ImFontAtlas* atlas, ImFont* font, ImWchar codepoint)
+{
+    ImFontAtlasDynamicData* data = atlas->DynamicData;
+    const int src_i = (font->DynamicIndexSrc[codepoint] & 0x7F) - 1;
+    ImFontConfig& src = atlas->Sources[src_i];
+    ImFontAtlasDynamicSrc& dyn_src = data->Sources[src_i];
+
+    // Measure (same as ImFontAtlasBuildWithStbTruetype() step 4)
+    const int pack_padding = atlas->TexGlyphPadding;
+    const int glyph_index_in_font = stbtt_FindGlyphIndex(&dyn_src.FontInfo, codepoint);
+    stbrp_rect r = {};
+    const bool has_pixels = ImFontAtlasBuildCalcGlyphRect(&dyn_src.FontInfo, &src, glyph_index_in_font, dyn_src.Scale, dyn_src.OversampleH, dyn_src.OversampleV, pack_padding, &r);
+
+    int page_n = 0xFF;
+    stbtt_aligned_quad q = {};
+    if (has_pixels)
+    {
+        if (r.w > atlas->TexWidth || r.h > data->PageHeight)
+        {
+            // Can't fit: stop requesting this glyph, fallback will be used.
+            font->DynamicIndexSrc[codepoint] = 0;
+            return true;
+        }
+        page_n = ImFontAtlasDynamicPackRect(atlas, &r);
+        if (page_n == -1)
+            return false;
+        ImFontAtlasDynamicPage& page = data->Pages[page_n];
+        r.y += (stbrp_coord)page.Y;
+        const int rect_x = r.x, rect_y = r.y, rect_w = r.w, rect_h = r.h;
+
+        // Rasterize
+        int codepoint_int = codepoint;
+        stbtt_packedchar pc = {};
+        if (src.SDF)
+        {
+            ImFontAtlasBuildRenderGlyphSDF(&dyn_src.FontInfo, &src, dyn_src.Scale, codepoint_int, pack_padding, &r, atlas->TexPixelsAlpha8, atlas->TexWidth, &pc);
+        }
+        else
+        {
+            stbtt_pack_range range = {};
+            range.font_size = src.SizePixels * src.RasterizerDensity;
+            range.array_of_unicode_codepoints = &codepoint_int;
+            range.num_chars = 1;
+            range.chardata_for_range = &pc;
+            range.h_oversample = (unsigned char)dyn_src.OversampleH;
+            range.v_oversample = (unsigned char)dyn_src.OversampleV;
+            stbtt_pack_context spc = {};
+            spc.width = atlas->TexWidth;
+            spc.height = atlas->TexHeight;
+            spc.stride_in_bytes = atlas->TexWidth;
+            spc.padding = pack_padding;
+            spc.pixels = atlas->TexPixelsAlpha8;
+            stbtt_PackFontRangesRenderIntoRects(&spc, &dyn_src.FontInfo, &range, 1, &r);
+            if (src.RasterizerMultiply != 1.0f)
+            {
+                unsigned char multiply_table[256];
+                ImFontAtlasBuildMultiplyCalcLookupTable(multiply_table, src.RasterizerMultiply);
+                ImFontAtlasBuildMultiplyRectAlpha8(multiply_table, atlas->TexPixelsAlpha8, r.x, r.y, r.w, r.h, atlas->TexWidth);
+            }
+        }
+        ImFontAtlasDynamicUpdateRGBA32(atlas, rect_x, rect_y, rect_w, rect_h);
+        ImFontAtlasDynamicMarkDirty(atlas, rect_x, rect_y, rect_w, rect_h);
+        page.LastUsedFrame = data->FrameCount;
+
+        float unused_x = 0.0f, unused_y = 0.0f;
+        stbtt_GetPackedQuad(&pc, atlas->TexWidth, atlas->TexHeight, 0, &unused_x, &unused_y, &q, 0);
+    }
+
+    // Register glyph (empty glyphs don't use texture space and are never evicted)
+    // Reuse a slot released by eviction to keep Glyphs[] bounded. AddGlyph() may reallocate Glyphs[], so FallbackGlyph is fixed up.
+    const int fallback_glyph_index = (int)(font->FallbackGlyph - font->Glyphs.Data);
+    const float inv_rasterization_scale = 1.0f / src.RasterizerDensity;
+    const float font_off_x = src.GlyphOffset.x;
+    const float font_off_y = src.GlyphOffset.y + IM_ROUND(font->Ascent);
+    int advance, lsb;
+    stbtt_GetGlyphHMetrics(&dyn_src.FontInfo, glyph_index_in_font, &advance, &lsb);
+    font->AddGlyph(&src, codepoint, q.x0 * inv_rasterization_scale + font_off_x, q.y0 * inv_rasterization_scale + font_off_y, q.x1 * inv_rasterization_scale + font_off_x, q.y1 * inv_rasterization_scale + font_off_y, q.s0, q.t0, q.s1, q.t1, advance * dyn_src.Scale * inv_rasterization_scale);
+    int glyph_index = font->Glyphs.Size - 1;
+    if (font->DynamicFreeGlyphs.Size > 0)
+    {
+        glyph_index = font->DynamicFreeGlyphs.back();
+        font->DynamicFreeGlyphs.pop_back();
+        font->Glyphs[glyph_index] = font->Glyphs.back();
+        font->Glyphs.pop_back();
+    }
+    else
+    {
+        font->DynamicGlyphsPage.push_back(0xFF);
+    }
+    font->DynamicGlyphsPage[glyph_index] = (ImU8)page_n;
+    font->IndexLookup[codepoint] = (ImU16)glyph_index;
+    font->FallbackGlyph = &font->Glyphs[fallback_glyph_index];
+    font->DirtyLookupTables = false;
+    font->DynamicIndexSrc[codepoint] &= 0x7F;
+    if (page_n != 0xFF)
+    {
+        ImFontAtlasDynamicGlyphRef ref;
+        ref.Font = font;
+        ref.Codepoint = codepoint;
+        ref.GlyphIndex = (ImU16)glyph_index;
+        data->Pages[page_n].Glyphs.push_back(ref);
+    }
+    data->GlyphsRasterized++;
+    return true;
+}
+
+void ImFontAtlasUpdateDynamicGlyphs(ImFontAtlas* atlas)
+{
+    ImFontAtlasDynamicData* data = atlas->DynamicData;
+    if (data == NULL)
+        return;
+    IM_ASSERT(atlas->TexPixelsAlpha8 != NULL);
+    data->FrameCount++;
+
+    // Process queue. Requests which can't be satisfied this frame (too many new glyphs) are kept for next frame.
+    const double time_start = ImTimeGetSeconds();
+    int queue_kept = 0;
+    for (int queue_n = 0; queue_n < data->Queue.Size; queue_n++)
+    {
+        const ImFontAtlasDynamicGlyphRef ref = data->Queue[queue_n];
+        if (!ImFontAtlasDynamicRenderGlyph(atlas, ref.Font, ref.Codepoint))
+            data->Queue[queue_kept++] = ref;
+    }
+    data->Queue.resize(queue_kept);
+
+    ImFontAtlasBuildStats& stats = atlas->BuildStats;
+    stats.DynamicGlyphsResident = 0;
+    for (const ImFontAtlasDynamicPage& page : data->Pages)
+        stats.DynamicGlyphsResident += page.Glyphs.Size;
+    stats.DynamicGlyphsRasterized = data->GlyphsRasterized;
+    stats.DynamicPagesEvicted = data->PagesEvicted;
+    stats.TimeDynamic = (float)((ImTimeGetSeconds() - time_start) * 1000.0);
+}
+
+void ImFontAtlasDynamicShutdown(ImFontAtlas* atlas)
+{
+    ImFontAtlasDynamicData* data = atlas->DynamicData;
+    if (data == NULL)
+        return;
+    for (ImFont* font : atlas->Fonts)
+    {
+        font->DynamicIndexSrc.clear();
+        font->DynamicGlyphsPage.clear();
+        font->DynamicFreeGlyphs.clear();
+    }
+#ifdef STBTT_HAS_FONT_ACCEL
+    for (ImFontAtlasDynamicSrc& dyn_src : data->Sources)
+        stbtt_FreeFontAccel(&dyn_src.FontInfo);
+#endif
+    data->Pages.clear_destruct();
+    IM_DELETE(data);
+    atlas->DynamicData = NULL;
+}
+
+ImFontGlyph* ImFontAtlasDynamicQueueGlyph(ImFont* font, ImWchar c)
+{
+    ImU8& src_index = font->DynamicIndexSrc.Data[c];
+    if ((src_index & 0x80) == 0)
+    {
+        src_index |= 0x80;
+        ImFontAtlasDynamicGlyphRef ref;
+        ref.Font = font;
+        ref.Codepoint = c;
+        ref.GlyphIndex = 0;
+        font->ContainerAtlas->DynamicData->Queue.push_back(ref);
+    }
+    ImFontGlyph* glyph = &font->DynamicPendingGlyph;
+    glyph->Codepoint = c;
+    glyph->Visible = 0;
+    glyph->AdvanceX = font->IndexAdvanceX.Data[c];
+    return glyph;
+}
+
+void ImFontAtlasDynamicTouchGlyph(ImFont* font, int glyph_index)
+{
+    const ImU8 page_n = font->DynamicGlyphsPage.Data[glyph_index];
+    if (page_n != 0xFF)
+    {
+        ImFontAtlasDynamicData* data = font->ContainerAtlas->DynamicData;
+        data->Pages[page_n].LastUsedFrame = data->FrameCount;
+    }
+}
+
+#else
+
+// ImFontAtlasFlags_DynamicGlyphs requires the stb_truetype builder: without it fonts never request glyphs.
+void            ImFontAtlasUpdateDynamicGlyphs(ImFontAtlas*)        {}
+void            ImFontAtlasDynamicShutdown(ImFontAtlas*)            {}
+ImFontGlyph*    ImFontAtlasDynamicQueueGlyph(ImFont* font, ImWchar) { return font->FallbackGlyph; }
+void            ImFontAtlasDynamicTouchGlyph(ImFont*, int)          {}
+
+#endif // IMGUI_ENABLE_STB_TRUETYPE
+
+void ImFontAtlasUpdateSourcesPointers(ImFontAtlas* atlas)
+{
+    for (ImFontConfig& src : atlas->Sources)
+    {
+        ImFont* font = src.DstFont;
+        if (!src.MergeMode)
+        {
+            font->Sources = &src;
+            font->SourcesCount = 0;
+        }
+        font->SourcesCount++;
+    }
+}
+
+void ImFontAtlasBuildSetupFont(ImFontAtlas* atlas, ImFont* font, ImFontConfig* font_config, float ascent, float descent)
+{
+    if (!font_config->MergeMode)
+    {
+        font->ClearOutputData();
+        font->FontSize = font_config->SizePixels;
+        IM_ASSERT(font->Sources == font_config);
+        font->ContainerAtlas = atlas;
+        font->Ascent = ascent;
+        font->Descent = descent;
+        font->SDF = font_config->SDF;
+    }
+    IM_ASSERT(font->SDF == font_config->SDF && "Merged font sources must all use the same ImFontConfig::SDF setting.");
+}
+
+void ImFontAtlasBuildPackCustomRects(ImFontAtlas* atlas, void* stbrp_context_opaque)
+{
+    stbrp_context* pack_context = (stbrp_context*)stbrp_context_opaque;
+    IM_ASSERT(pack_context != NULL);
+
+    ImVector<ImFontAtlasCustomRect>& user_rects = atlas->CustomRects;
+    IM_ASSERT(user_rects.Size >= 1); // We expect at least the default custom rects to be registered, else something went wrong.
 #ifdef __GNUC__
     if (user_rects.Size < 1) { __builtin_unreachable(); } // Workaround for GCC bug if IM_ASSERT() is defined to conditionally throw (see #5343)
 #endif
@@ -3378,6 +4594,254 @@ void ImFontAtlasBuildFinish(ImFontAtlas* atlas)
             font->BuildLookupTable();
 
     atlas->TexReady = true;
+    atlas->BuildCount++;
+}
+
+// Baked atlas cache file
+// - Stores the built state of an atlas (texture, glyphs, lookup tables, custom rectangles positions, metrics) so that
+//   a next run using the exact same inputs can skip parsing and rasterizing fonts entirely.
+// - The key is a hash of every input affecting the output, including the font data bytes. Any mismatch triggers a rebuild.
+// - The payload is checksummed and every index it contains is validated on load: a truncated or corrupted file triggers a rebuild too.
+//   The file is replaced atomically (see ImFileWriteAtomically()), so a crash while saving doesn't leave a truncated file behind.
+// - Data is stored in native endianness and structure layout: the file is not meant to be portable across builds/platforms.
+#define IM_FONT_ATLAS_CACHE_VERSION     3
+
+struct ImFontAtlasCacheHeader
+{
+    char        Magic[4];       // "IMFC"
+    ImU32       Version;        // IM_FONT_ATLAS_CACHE_VERSION
+    ImU32       Key;            // ImFontAtlasCacheCalcKey()
+    ImU32       PayloadSize;
+    ImU32       PayloadHash;    // ImHashData() of the payload
+};
+
+struct ImFontAtlasCacheWriter
+{
+    ImVector<unsigned char> Buf;
+    void        Write(const void* data, size_t size)    { int off = Buf.Size; Buf.resize(Buf.Size + (int)size); if (size > 0) memcpy(Buf.Data + off, data, size); }
+    void        WriteU32(ImU32 v)                       { Write(&v, sizeof(v)); }
+    void        WriteFloat(float v)                     { Write(&v, sizeof(v)); }
+};
+
+struct ImFontAtlasCacheReader
+{
+    const unsigned char* Data;
+    const unsigned char* DataEnd;
+    bool        Read(void* out_data, size_t size)   { if ((size_t)(DataEnd - Data) < size) return false; if (size > 0) memcpy(out_data, Data, size); Data += size; return true; }
+    bool        ReadU32(ImU32* out_v)               { return Read(out_v, sizeof(*out_v)); }
+    bool        ReadFloat(float* out_v)             { return Read(out_v, sizeof(*out_v)); }
+};
+
+static int ImFontAtlasCacheFindFontIndex(ImFontAtlas* atlas, const ImFont* font)
+{
+    for (int font_n = 0; font_n < atlas->Fonts.Size; font_n++)
+        if (atlas->Fonts[font_n] == font)
+            return font_n;
+    return -1;
+}
+
+ImGuiID ImFontAtlasCacheCalcKey(ImFontAtlas* atlas)
+{
+#ifdef IMGUI_ENABLE_FREETYPE
+    const ImU32 builder_id = 1;
+#else
+    const ImU32 builder_id = 0;
+#endif
+    ImU32 header[] = { (ImU32)IMGUI_VERSION_NUM, builder_id, (ImU32)sizeof(ImFontGlyph), (ImU32)sizeof(ImWchar), (ImU32)sizeof(ImFontAtlasCustomRect), 0x01020304, (ImU32)atlas->Flags, (ImU32)atlas->TexDesiredWidth, (ImU32)atlas->TexGlyphPadding, atlas->FontBuilderFlags, (ImU32)atlas->Fonts.Size, (ImU32)atlas->Sources.Size, (ImU32)atlas->CustomRects.Size };
+    ImGuiID key = ImHashData(header, sizeof(header));
+    for (const ImFontAtlasCustomRect& r : atlas->CustomRects)
+    {
+        float data[] = { (float)r.Width, (float)r.Height, (float)r.GlyphID, (float)r.GlyphColored, r.GlyphAdvanceX, r.GlyphOffset.x, r.GlyphOffset.y, (float)ImFontAtlasCacheFindFontIndex(atlas, r.Font) };
+        key = ImHashData(data, sizeof(data), key);
+    }
+    for (const ImFontConfig& src : atlas->Sources)
+    {
+        key = ImHashData(&src.FontDataSize, sizeof(src.FontDataSize), key);
+        float data[] = { (float)src.MergeMode, (float)src.PixelSnapH, (float)src.FontNo, (float)src.OversampleH, (float)src.OversampleV, src.SizePixels, src.GlyphOffset.x, src.GlyphOffset.y,
+            src.GlyphMinAdvanceX, src.GlyphMaxAdvanceX, src.GlyphExtraAdvanceX, (float)src.FontBuilderFlags, src.RasterizerMultiply, src.RasterizerDensity, (float)src.EllipsisChar, (float)ImFontAtlasCacheFindFontIndex(atlas, src.DstFont), (float)src.SDF, (float)src.SDFPadding, (float)src.Kerning };
+        key = ImHashData(data, sizeof(data), key);
+        const ImWchar* ranges = src.GlyphRanges ? src.GlyphRanges : atlas->GetGlyphRangesDefault();
+        const ImWchar* ranges_end = ranges;
+        while (ranges_end[0] && ranges_end[1])
+            ranges_end += 2;
+        key = ImHashData(ranges, (size_t)(ranges_end - ranges) * sizeof(ImWchar), key);
+        key = ImHashData(src.FontData, (size_t)src.FontDataSize, key);
+    }
+    return key;
+}
+
+bool ImFontAtlasCacheSave(ImFontAtlas* atlas, const char* filename)
+{
+    IM_ASSERT(atlas->TexReady);
+    const int bytes_per_pixel = atlas->TexPixelsAlpha8 ? 1 : 4;
+    const void* pixels = atlas->TexPixelsAlpha8 ? (const void*)atlas->TexPixelsAlpha8 : (const void*)atlas->TexPixelsRGBA32;
+    if (pixels == NULL)
+        return false;
+
+    ImFontAtlasCacheWriter w;
+    w.Buf.resize((int)sizeof(ImFontAtlasCacheHeader)); // Filled last
+    w.WriteU32((ImU32)atlas->TexWidth);
+    w.WriteU32((ImU32)atlas->TexHeight);
+    w.WriteU32((ImU32)bytes_per_pixel);
+    w.WriteU32(atlas->TexPixelsUseColors ? 1 : 0);
+    w.Write(&atlas->TexUvWhitePixel, sizeof(atlas->TexUvWhitePixel));
+    w.Write(atlas->TexUvLines, sizeof(atlas->TexUvLines));
+    for (const ImFontAtlasCustomRect& r : atlas->CustomRects)
+    {
+        w.Write(&r.X, sizeof(r.X));
+        w.Write(&r.Y, sizeof(r.Y));
+    }
+    for (ImFont* font : atlas->Fonts)
+    {
+        w.WriteFloat(font->FontSize);
+        w.WriteFloat(font->Ascent);
+        w.WriteFloat(font->Descent);
+        w.WriteFloat(font->FallbackAdvanceX);
+        w.WriteFloat(font->EllipsisWidth);
+        w.WriteFloat(font->EllipsisCharStep);
+        w.WriteU32((ImU32)font->MetricsTotalSurface);
+        w.WriteU32((ImU32)font->FallbackChar);
+        w.WriteU32((ImU32)font->EllipsisChar);
+        w.WriteU32((ImU32)font->EllipsisCharCount);
+        w.WriteU32(font->FallbackGlyph ? (ImU32)font->Glyphs.index_from_ptr(font->FallbackGlyph) : (ImU32)-1);
+        w.Write(font->Used8kPagesMap, sizeof(font->Used8kPagesMap));
+        w.WriteU32((ImU32)font->Glyphs.Size);
+        w.Write(font->Glyphs.Data, (size_t)font->Glyphs.size_in_bytes());
+        w.WriteU32((ImU32)font->IndexLookup.Size);
+        w.Write(font->IndexAdvanceX.Data, (size_t)font->IndexAdvanceX.size_in_bytes());
+        w.Write(font->IndexLookup.Data, (size_t)font->IndexLookup.size_in_bytes());
+        w.WriteU32((ImU32)font->KerningPairs.Size);
+        w.Write(font->KerningPairs.Data, (size_t)font->KerningPairs.size_in_bytes());
+    }
+    w.Write(pixels, (size_t)atlas->TexWidth * (size_t)atlas->TexHeight * (size_t)bytes_per_pixel);
+
+    ImFontAtlasCacheHeader header;
+    memcpy(header.Magic, "IMFC", 4);
+    header.Version = IM_FONT_ATLAS_CACHE_VERSION;
+    header.Key = ImFontAtlasCacheCalcKey(atlas);
+    header.PayloadSize = (ImU32)(w.Buf.Size - sizeof(header));
+    header.PayloadHash = ImHashData(w.Buf.Data + sizeof(header), header.PayloadSize);
+    memcpy(w.Buf.Data, &header, sizeof(header));
+    return ImFileWriteAtomically(filename, "wb", w.Buf.Data, (size_t)w.Buf.Size);
+}
+
+// Parse and apply cache file contents. On failure the atlas is left in a partially loaded state, which a regular build will overwrite.
+static bool ImFontAtlasCacheLoadFromMemory(ImFontAtlas* atlas, ImFontAtlasCacheReader* r)
+{
+    ImU32 tex_width = 0, tex_height = 0, bytes_per_pixel = 0, use_colors = 0;
+    if (!r->ReadU32(&tex_width) || !r->ReadU32(&tex_height) || !r->ReadU32(&bytes_per_pixel) || !r->ReadU32(&use_colors))
+        return false;
+    if (tex_width == 0 || tex_height == 0 || tex_width > 0xFFFF || tex_height > 0xFFFF || (bytes_per_pixel != 1 && bytes_per_pixel != 4))
+        return false;
+    atlas->TexID = atlas->TexIDSDF = (ImTextureID)NULL;
+    atlas->TexWidth = (int)tex_width;
+    atlas->TexHeight = (int)tex_height;
+    atlas->TexUvScale = ImVec2(1.0f / atlas->TexWidth, 1.0f / atlas->TexHeight);
+    atlas->TexPixelsUseColors = (use_colors != 0);
+    if (!r->Read(&atlas->TexUvWhitePixel, sizeof(atlas->TexUvWhitePixel)) || !r->Read(atlas->TexUvLines, sizeof(atlas->TexUvLines)))
+        return false;
+    for (ImFontAtlasCustomRect& rect : atlas->CustomRects)
+    {
+        if (!r->Read(&rect.X, sizeof(rect.X)) || !r->Read(&rect.Y, sizeof(rect.Y)))
+            return false;
+        if (rect.IsPacked() && ((ImU32)(rect.X + rect.Width) > tex_width || (ImU32)(rect.Y + rect.Height) > tex_height))
+            return false;
+    }
+
+    for (ImFont* font : atlas->Fonts)
+    {
+        font->ClearOutputData();
+        font->ContainerAtlas = atlas;
+        font->SDF = font->Sources->SDF;
+        ImU32 metrics_total_surface, fallback_char, ellipsis_char, ellipsis_char_count, fallback_glyph_index, glyphs_count, index_size, kerning_size;
+        if (!r->ReadFloat(&font->FontSize) || !r->ReadFloat(&font->Ascent) || !r->ReadFloat(&font->Descent) || !r->ReadFloat(&font->FallbackAdvanceX) || !r->ReadFloat(&font->EllipsisWidth) || !r->ReadFloat(&font->EllipsisCharStep))
+            return false;
+        if (!r->ReadU32(&metrics_total_surface) || !r->ReadU32(&fallback_char) || !r->ReadU32(&ellipsis_char) || !r->ReadU32(&ellipsis_char_count) || !r->ReadU32(&fallback_glyph_index))
+            return false;
+        if (!r->Read(font->Used8kPagesMap, sizeof(font->Used8kPagesMap)) || !r->ReadU32(&glyphs_count) || glyphs_count == 0 || glyphs_count >= 0xFFFF)
+            return false;
+        font->Glyphs.resize((int)glyphs_count);
+        if (!r->Read(font->Glyphs.Data, (size_t)font->Glyphs.size_in_bytes()) || !r->ReadU32(&index_size) || index_size > IM_UNICODE_CODEPOINT_MAX + 1)
+            return false;
+        font->IndexAdvanceX.resize((int)index_size);
+        font->IndexLookup.resize((int)index_size);
+        if (!r->Read(font->IndexAdvanceX.Data, (size_t)font->IndexAdvanceX.size_in_bytes()) || !r->Read(font->IndexLookup.Data, (size_t)font->IndexLookup.size_in_bytes()))
+            return false;
+        for (ImU16 glyph_index : font->IndexLookup)
+            if (glyph_index != (ImU16)-1 && glyph_index >= glyphs_count)
+                return false;
+        if (!r->ReadU32(&kerning_size) || (kerning_size & (kerning_size - 1)) != 0 || kerning_size > 0x1000000)
+            return false;
+        font->KerningPairs.resize((int)kerning_size);
+        if (!r->Read(font->KerningPairs.Data, (size_t)font->KerningPairs.size_in_bytes()))
+            return false;
+        int kerning_empty_slots = 0;
+        for (const ImFontKerningPair& pair : font->KerningPairs)
+            kerning_empty_slots += (pair.Left == 0) ? 1 : 0;
+        if (kerning_size > 0 && kerning_empty_slots == 0) // Lookups probe until they find a match or an empty slot
+            return false;
+        if (fallback_glyph_index >= glyphs_count || ellipsis_char_count > 3)
+            return false;
+        font->MetricsTotalSurface = (int)metrics_total_surface;
+        font->FallbackChar = (ImWchar)fallback_char;
+        font->EllipsisChar = (ImWchar)ellipsis_char;
+        font->EllipsisCharCount = (short)ellipsis_char_count;
+        font->FallbackGlyph = &font->Glyphs[(int)fallback_glyph_index];
+        font->DirtyLookupTables = false;
+    }
+
+    const size_t pixels_size = (size_t)tex_width * (size_t)tex_height * (size_t)bytes_per_pixel;
+    if ((size_t)(r->DataEnd - r->Data) != pixels_size)
+        return false;
+    atlas->ClearTexData();
+    void* pixels = IM_ALLOC(pixels_size);
+    r->Read(pixels, pixels_size);
+    if (bytes_per_pixel == 1)
+        atlas->TexPixelsAlpha8 = (unsigned char*)pixels;
+    else
+        atlas->TexPixelsRGBA32 = (unsigned int*)pixels;
+    atlas->TexPixelsUseColors = (use_colors != 0); // Cleared by ClearTexData()
+    return true;
+}
+
+bool ImFontAtlasCacheLoad(ImFontAtlas* atlas, const char* filename)
+{
+    const double time_start = ImTimeGetSeconds();
+    ImFontAtlasBuildInit(atlas);
+
+    ImFileMapping mapping;
+    if (!ImFileMapToMemory(filename, &mapping))
+        return false;
+    bool ret = false;
+    ImFontAtlasCacheHeader header;
+    if (mapping.Size >= sizeof(header))
+    {
+        memcpy(&header, mapping.Data, sizeof(header));
+        const unsigned char* payload = (const unsigned char*)mapping.Data + sizeof(header);
+        if (memcmp(header.Magic, "IMFC", 4) == 0 && header.Version == IM_FONT_ATLAS_CACHE_VERSION && (ImU64)header.PayloadSize == mapping.Size - sizeof(header) && header.Key == ImFontAtlasCacheCalcKey(atlas) && header.PayloadHash == ImHashData(payload, header.PayloadSize))
+        {
+            ImFontAtlasCacheReader reader;
+            reader.Data = payload;
+            reader.DataEnd = reader.Data + header.PayloadSize;
+            ret = ImFontAtlasCacheLoadFromMemory(atlas, &reader);
+        }
+    }
+    ImFileUnmap(&mapping);
+    if (!ret)
+        return false;
+
+    atlas->TexReady = true;
+    atlas->BuildCount++;
+    atlas->BuildStats = ImFontAtlasBuildStats();
+    atlas->BuildStats.LoadedFromCache = true;
+    for (ImFont* font : atlas->Fonts)
+    {
+        atlas->BuildStats.GlyphsCount += font->Glyphs.Size;
+        for (const ImFontKerningPair& pair : font->KerningPairs)
+            atlas->BuildStats.KerningPairsCount += (pair.Left != 0) ? 1 : 0;
+    }
+    atlas->BuildStats.TimeTotal = (float)((ImTimeGetSeconds() - time_start) * 1000.0);
+    return true;
 }
 
 //-------------------------------------------------------------------------
@@ -3718,9 +5182,14 @@ void    ImFont::ClearOutputData()
     FallbackGlyph = NULL;
     ContainerAtlas = NULL;
     DirtyLookupTables = true;
+    SDF = false;
     Ascent = Descent = 0.0f;
     MetricsTotalSurface = 0;
     memset(Used8kPagesMap, 0, sizeof(Used8kPagesMap));
+    KerningPairs.clear();
+    DynamicIndexSrc.clear();
+    DynamicGlyphsPage.clear();
+    DynamicFreeGlyphs.clear();
 }
 
 static ImWchar FindFirstExistingGlyph(ImFont* font, const ImWchar* candidate_chars, int candidate_chars_count)
@@ -3904,13 +5373,16 @@ void ImFont::AddRemapChar(ImWchar dst, ImWchar src, bool overwrite_dst)
 }
 
 // Find glyph, return fallback if missing
+// With ImFontAtlasFlags_DynamicGlyphs, a glyph not rasterized yet is queued and an invisible placeholder is returned.
 ImFontGlyph* ImFont::FindGlyph(ImWchar c)
 {
     if (c >= (size_t)IndexLookup.Size)
         return FallbackGlyph;
     const ImU16 i = IndexLookup.Data[c];
     if (i == (ImU16)-1)
-        return FallbackGlyph;
+        return (c < (size_t)DynamicIndexSrc.Size && DynamicIndexSrc.Data[c] != 0) ? ImFontAtlasDynamicQueueGlyph(this, c) : FallbackGlyph;
+    if (DynamicGlyphsPage.Size != 0)
+        ImFontAtlasDynamicTouchGlyph(this, i);
     return &Glyphs.Data[i];
 }
 
@@ -3934,8 +5406,44 @@ static inline const char* CalcWordWrapNextLineStartA(const char* text, const cha
     return text;
 }
 
+// Return end of the run of printable ASCII characters (0x20..0x7F) starting at 'text'.
+// Those need no UTF-8 decoding nor special handling, so text functions below process them in a tighter loop.
+static inline const char* ImTextFindPrintableAsciiEnd(const char* text, const char* text_end)
+{
+#if defined(IMGUI_ENABLE_SSE) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+    // 16 bytes at a time. Signed comparison: bytes >= 0x80 are negative.
+    const __m128i v_0x1f = _mm_set1_epi8(0x1F);
+    while (text_end - text >= 16 && _mm_movemask_epi8(_mm_cmpgt_epi8(_mm_loadu_si128((const __m128i*)(const void*)text), v_0x1f)) == 0xFFFF)
+        text += 16;
+#endif
+    while (text < text_end && (unsigned char)(*text - 0x20) < 0x60)
+        text++;
+    return text;
+}
+
 #define ImFontGetCharAdvanceX(_FONT, _CH)  ((int)(_CH) < (_FONT)->IndexAdvanceX.Size ? (_FONT)->IndexAdvanceX.Data[_CH] : (_FONT)->FallbackAdvanceX)
 
+// Caller checks that KerningPairs[] is not empty.
+// Empty slots have AdvanceX == 0.0f, so we can return the slot where probing stops. Hits and misses are
+// equally common, so the probing condition is written without short-circuits to be predictable.
+static inline float ImFontGetCharKerningX(const ImFont* font, unsigned int c_prev, unsigned int c)
+{
+    const ImU32 mask = (ImU32)font->KerningPairs.Size - 1;
+    ImU32 slot = ImFontKerningHash(c_prev, c) & mask;
+    const ImFontKerningPair* pair = &font->KerningPairs.Data[slot];
+    while ((pair->Left != 0) & ((pair->Left != c_prev) | (pair->Right != c)))
+    {
+        slot = (slot + 1) & mask;
+        pair = &font->KerningPairs.Data[slot];
+    }
+    return pair->AdvanceX;
+}
+
+float ImFont::GetCharKerning(ImWchar c_prev, ImWchar c) const
+{
+    return KerningPairs.Size > 0 ? ImFontGetCharKerningX(this, c_prev, c) : 0.0f;
+}
+
 // Simple word-wrapping for English, not full-featured. Please submit failing cases!
 // This will return the next location to wrap from. If no wrapping if necessary, this will fast-forward to e.g. text_end.
 // FIXME: Much possible improvements (don't cut things like "word !", "word!!!" but cut within "word,,,,", more sensible support for punctuations, support for Unicode punctuations, etc.)
@@ -3960,6 +5468,8 @@ const char* ImFont::CalcWordWrapPositionA(float scale, const char* text, const c
     const char* word_end = text;
     const char* prev_word_end = NULL;
     bool inside_word = true;
+    const bool use_kerning = KerningPairs.Size > 0;
+    unsigned int c_prev = 0;
 
     const char* s = text;
     IM_ASSERT(text_end != NULL);
@@ -3978,6 +5488,7 @@ const char* ImFont::CalcWordWrapPositionA(float scale, const char* text, const c
             {
                 line_width = word_width = blank_width = 0.0f;
                 inside_word = true;
+                c_prev = 0;
                 s = next_s;
                 continue;
             }
@@ -3988,7 +5499,13 @@ const char* ImFont::CalcWordWrapPositionA(float scale, const char* text, const c
             }
         }
 
-        const float char_width = ImFontGetCharAdvanceX(this, c);
+        float char_width = ImFontGetCharAdvanceX(this, c);
+        if (use_kerning)
+        {
+            // Kerning is accounted into the width of the second character
+            char_width += ImFontGetCharKerningX(this, c_prev, c);
+            c_prev = c;
+        }
         if (ImCharIsBlankW(c))
         {
             if (inside_word)
@@ -4050,6 +5567,9 @@ ImVec2 ImFont::CalcTextSizeA(float size, float max_width, float wrap_width, cons
 
     const bool word_wrap_enabled = (wrap_width > 0.0f);
     const char* word_wrap_eol = NULL;
+    const bool use_kerning = KerningPairs.Size > 0;
+    const bool use_ascii_fast_path = IndexAdvanceX.Size >= 0x80;
+    unsigned int c_prev = 0;
 
     const char* s = text_begin;
     while (s < text_end)
@@ -4066,12 +5586,35 @@ ImVec2 ImFont::CalcTextSizeA(float size, float max_width, float wrap_width, cons
                     text_size.x = line_width;
                 text_size.y += line_height;
                 line_width = 0.0f;
+                c_prev = 0;
                 word_wrap_eol = NULL;
                 s = CalcWordWrapNextLineStartA(s, text_end); // Wrapping skips upcoming blanks
                 continue;
             }
         }
 
+        // Fast path for a run of printable ASCII characters (up to the wrapping point)
+        if (use_ascii_fast_path)
+        {
+            const char* run_end = ImTextFindPrintableAsciiEnd(s, word_wrap_enabled ? word_wrap_eol : text_end);
+            for (; s < run_end; s++)
+            {
+                const unsigned int c = (unsigned char)*s;
+                float char_width = IndexAdvanceX.Data[c];
+                if (use_kerning)
+                    char_width += ImFontGetCharKerningX(this, c_prev, c);
+                char_width *= scale;
+                if (line_width + char_width >= max_width)
+                    break;
+                line_width += char_width;
+                c_prev = c;
+            }
+            if (s < run_end)
+                break; // Reached max_width
+            if (s >= text_end || (word_wrap_enabled && s >= word_wrap_eol))
+                continue;
+        }
+
         // Decode and advance source
         const char* prev_s = s;
         unsigned int c = (unsigned int)*s;
@@ -4087,13 +5630,17 @@ ImVec2 ImFont::CalcTextSizeA(float size, float max_width, float wrap_width, cons
                 text_size.x = ImMax(text_size.x, line_width);
                 text_size.y += line_height;
                 line_width = 0.0f;
+                c_prev = 0;
                 continue;
             }
             if (c == '\r')
                 continue;
         }
 
-        const float char_width = ImFontGetCharAdvanceX(this, c) * scale;
+        float char_width = ImFontGetCharAdvanceX(this, c);
+        if (use_kerning)
+            char_width += ImFontGetCharKerningX(this, c_prev, c);
+        char_width *= scale;
         if (line_width + char_width >= max_width)
         {
             s = prev_s;
@@ -4101,6 +5648,7 @@ ImVec2 ImFont::CalcTextSizeA(float size, float max_width, float wrap_width, cons
         }
 
         line_width += char_width;
+        c_prev = c;
     }
 
     if (text_size.x < line_width)
@@ -4126,8 +5674,13 @@ void ImFont::RenderChar(ImDrawList* draw_list, float size, const ImVec2& pos, Im
     float scale = (size >= 0.0f) ? (size / FontSize) : 1.0f;
     float x = IM_TRUNC(pos.x);
     float y = IM_TRUNC(pos.y);
+    const bool use_sdf_texture = SDF && ContainerAtlas->TexIDSDF != (ImTextureID)NULL;
+    if (use_sdf_texture)
+        draw_list->PushTextureID(ContainerAtlas->TexIDSDF);
     draw_list->PrimReserve(6, 4);
     draw_list->PrimRectUV(ImVec2(x + glyph->X0 * scale, y + glyph->Y0 * scale), ImVec2(x + glyph->X1 * scale, y + glyph->Y1 * scale), ImVec2(glyph->U0, glyph->V0), ImVec2(glyph->U1, glyph->V1), col);
+    if (use_sdf_texture)
+        draw_list->PopTextureID();
 }
 
 // Note: as with every ImDrawList drawing function, this expects that the font atlas texture is bound.
@@ -4185,6 +5738,11 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, const ImVec2& pos, Im
     if (s == text_end)
         return;
 
+    // SDF fonts are drawn with a distinct texture identifier, which tells the renderer backend to use a distance field shader.
+    const bool use_sdf_texture = SDF && ContainerAtlas->TexIDSDF != (ImTextureID)NULL;
+    if (use_sdf_texture)
+        draw_list->PushTextureID(ContainerAtlas->TexIDSDF);
+
     // Reserve vertices for remaining worse case (over-reserving is useful and easily amortized)
     const int vtx_count_max = (int)(text_end - s) * 4;
     const int idx_count_max = (int)(text_end - s) * 6;
@@ -4196,6 +5754,10 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, const ImVec2& pos, Im
 
     const ImU32 col_untinted = col | ~IM_COL32_A_MASK;
     const char* word_wrap_eol = NULL;
+    const bool use_kerning = KerningPairs.Size > 0;
+    const bool use_ascii_fast_path = IndexLookup.Size >= 0x80;
+    const char* ascii_end = s; // Printable ASCII characters before this don't need to be decoded or checked
+    unsigned int c_prev = 0;
 
     while (s < text_end)
     {
@@ -4211,6 +5773,7 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, const ImVec2& pos, Im
                 y += line_height;
                 if (y > clip_rect.w)
                     break; // break out of main loop
+                c_prev = 0;
                 word_wrap_eol = NULL;
                 s = CalcWordWrapNextLineStartA(s, text_end); // Wrapping skips upcoming blanks
                 continue;
@@ -4218,29 +5781,48 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, const ImVec2& pos, Im
         }
 
         // Decode and advance source
-        unsigned int c = (unsigned int)*s;
-        if (c < 0x80)
-            s += 1;
+        // Fast path for printable ASCII characters: they are always baked with ImFontAtlasFlags_DynamicGlyphs, so a direct lookup is equivalent to FindGlyph().
+        if (s >= ascii_end && use_ascii_fast_path)
+            ascii_end = ImTextFindPrintableAsciiEnd(s, text_end);
+        unsigned int c;
+        const ImFontGlyph* glyph;
+        if (s < ascii_end)
+        {
+            c = (unsigned char)*s++;
+            const ImU16 glyph_idx = IndexLookup.Data[c];
+            glyph = (glyph_idx != (ImU16)-1) ? &Glyphs.Data[glyph_idx] : FallbackGlyph;
+        }
         else
-            s += ImTextCharFromUtf8(&c, s, text_end);
-
-        if (c < 32)
         {
-            if (c == '\n')
+            c = (unsigned int)*s;
+            if (c < 0x80)
+                s += 1;
+            else
+                s += ImTextCharFromUtf8(&c, s, text_end);
+
+            if (c < 32)
             {
-                x = origin_x;
-                y += line_height;
-                if (y > clip_rect.w)
-                    break; // break out of main loop
-                continue;
+                if (c == '\n')
+                {
+                    x = origin_x;
+                    y += line_height;
+                    if (y > clip_rect.w)
+                        break; // break out of main loop
+                    c_prev = 0;
+                    continue;
+                }
+                if (c == '\r')
+                    continue;
             }
-            if (c == '\r')
-                continue;
+            glyph = FindGlyph((ImWchar)c);
         }
-
-        const ImFontGlyph* glyph = FindGlyph((ImWchar)c);
         if (glyph == NULL)
             continue;
+        if (use_kerning)
+        {
+            x += ImFontGetCharKerningX(this, c_prev, c) * scale;
+            c_prev = c;
+        }
 
         float char_width = glyph->AdvanceX * scale;
         if (glyph->Visible)
@@ -4293,10 +5875,10 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, const ImVec2& pos, Im
 
                 // We are NOT calling PrimRectUV() here because non-inlined causes too much overhead in a debug builds. Inlined here:
                 {
-                    vtx_write[0].pos.x = x1; vtx_write[0].pos.y = y1; vtx_write[0].col = glyph_col; vtx_write[0].uv.x = u1; vtx_write[0].uv.y = v1;
-                    vtx_write[1].pos.x = x2; vtx_write[1].pos.y = y1; vtx_write[1].col = glyph_col; vtx_write[1].uv.x = u2; vtx_write[1].uv.y = v1;
-                    vtx_write[2].pos.x = x2; vtx_write[2].pos.y = y2; vtx_write[2].col = glyph_col; vtx_write[2].uv.x = u2; vtx_write[2].uv.y = v2;
-                    vtx_write[3].pos.x = x1; vtx_write[3].pos.y = y2; vtx_write[3].col = glyph_col; vtx_write[3].uv.x = u1; vtx_write[3].uv.y = v2;
+                    vtx_write[0].pos = ImVec2(x1, y1); vtx_write[0].col = glyph_col; vtx_write[0].uv = ImVec2(u1, v1);
+                    vtx_write[1].pos = ImVec2(x2, y1); vtx_write[1].col = glyph_col; vtx_write[1].uv = ImVec2(u2, v1);
+                    vtx_write[2].pos = ImVec2(x2, y2); vtx_write[2].col = glyph_col; vtx_write[2].uv = ImVec2(u2, v2);
+                    vtx_write[3].pos = ImVec2(x1, y2); vtx_write[3].col = glyph_col; vtx_write[3].uv = ImVec2(u1, v2);
                     idx_write[0] = (ImDrawIdx)(vtx_index); idx_write[1] = (ImDrawIdx)(vtx_index + 1); idx_write[2] = (ImDrawIdx)(vtx_index + 2);
                     idx_write[3] = (ImDrawIdx)(vtx_index); idx_write[4] = (ImDrawIdx)(vtx_index + 2); idx_write[5] = (ImDrawIdx)(vtx_index + 3);
                     vtx_write += 4;
@@ -4315,6 +5897,8 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, const ImVec2& pos, Im
     draw_list->_VtxWritePtr = vtx_write;
     draw_list->_IdxWritePtr = idx_write;
     draw_list->_VtxCurrentIdx = vtx_index;
+    if (use_sdf_texture)
+        draw_list->PopTextureID();
 }
 
 //-----------------------------------------------------------------------------
@@ -7,6 +7,9 @@
 //  [X] Renderer: User texture binding. Use 'GLuint' OpenGL texture identifier as void*/ImTextureID. Read the FAQ about ImTextureID!
 //  [x] Renderer: Large meshes support (64k+ vertices) even with 16-bit indices (ImGuiBackendFlags_RendererHasVtxOffset) [Desktop OpenGL only!]
 //  [X] Renderer: Multi-viewport support (multiple windows). Enable with 'io.ConfigFlags |= ImGuiConfigFlags_ViewportsEnable'.
+//  [X] Renderer: Partial font texture updates (ImGuiBackendFlags_RendererHasTexUpdates), for glyphs rasterized on demand with 'io.Fonts->Flags |= ImFontAtlasFlags_DynamicGlyphs'.
+//  [X] Renderer: Signed distance field fonts (ImFontConfig::SDF), drawn with a dedicated shader. Requires ImTextureID to be 64-bit (default ImU64, including in 32-bit builds).
+//  [X] Renderer: Compact 12 bytes vertices (IMGUI_USE_COMPACT_DRAWVERT in imconfig.h).
 
 // About WebGL/ES:
 // - You need to '#define IMGUI_IMPL_OPENGL_ES2' or '#define IMGUI_IMPL_OPENGL_ES3' to use WebGL or OpenGL ES.
@@ -23,6 +26,9 @@
 
 // CHANGELOG
 // (minor and older changes stripped away, please see git history for details)
+//  2026-10-18: OpenGL: Support for compact ImDrawVert layout (IMGUI_USE_COMPACT_DRAWVERT): 16-bit fixed point positions and 16-bit normalized UV.
+//  2026-10-18: OpenGL: Added distance field shader for SDF fonts (ImFontConfig::SDF), selected per draw command through io.Fonts->TexIDSDF.
+//  2026-10-18: OpenGL: Upload modified regions of the font atlas before rendering, enabling ImFontAtlasFlags_DynamicGlyphs. (ImGuiBackendFlags_RendererHasTexUpdates)
 //  2025-XX-XX: Platform: Added support for multiple windows via the ImGuiPlatformIO interface.
 //  2025-02-18: OpenGL: Lazily reinitialize embedded GL loader for when calling backend from e.g. other DLL boundaries. (#8406)
 //  2024-10-07: OpenGL: Changed default texture sampler to Clamp instead of Repeat/Wrap.
@@ -239,6 +245,10 @@ struct ImGui_ImplOpenGL3_Data
     GLuint          AttribLocationVtxPos;    // Vertex attributes location
     GLuint          AttribLocationVtxUV;
     GLuint          AttribLocationVtxColor;
+    GLuint          ShaderHandleSDF;         // Same as ShaderHandle with a distance field fragment shader, for SDF fonts. 0 if unsupported.
+    GLint           AttribLocationTexSDF;
+    GLint           AttribLocationProjMtxSDF;
+    ImTextureID     FontTexIDSDF;            // = io.Fonts->TexIDSDF
     unsigned int    VboHandle, ElementsHandle;
     GLsizeiptr      VertexBufferSize;
     GLsizeiptr      IndexBufferSize;
@@ -259,6 +269,7 @@ static ImGui_ImplOpenGL3_Data* ImGui_ImplOpenGL3_GetBackendData()
 // Forward Declarations
 static void ImGui_ImplOpenGL3_InitMultiViewportSupport();
 static void ImGui_ImplOpenGL3_ShutdownMultiViewportSupport();
+static void ImGui_ImplOpenGL3_UpdateFontsTexture();
 
 // OpenGL vertex attribute state (for ES 1.0 and ES 2.0 only)
 #ifndef IMGUI_IMPL_OPENGL_USE_VERTEX_ARRAY
@@ -364,6 +375,7 @@ bool    ImGui_ImplOpenGL3_Init(const char* glsl_version)
         io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset;  // We can honor the ImDrawCmd::VtxOffset field, allowing for large meshes.
 #endif
     io.BackendFlags |= ImGuiBackendFlags_RendererHasViewports;  // We can create multi-viewports on the Renderer side (optional)
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasTexUpdates; // We can upload modified regions of the font atlas (glyphs rasterized on demand).
 
     // Store GLSL version string so we can refer to it later in case we recreate shaders.
     // Note: GLSL version is NOT the same as GL version. Leave this to nullptr if unsure.
@@ -419,7 +431,7 @@ void    ImGui_ImplOpenGL3_Shutdown()
     ImGui_ImplOpenGL3_DestroyDeviceObjects();
     io.BackendRendererName = nullptr;
     io.BackendRendererUserData = nullptr;
-    io.BackendFlags &= ~(ImGuiBackendFlags_RendererHasVtxOffset | ImGuiBackendFlags_RendererHasViewports);
+    io.BackendFlags &= ~(ImGuiBackendFlags_RendererHasVtxOffset | ImGuiBackendFlags_RendererHasViewports | ImGuiBackendFlags_RendererHasTexUpdates);
     IM_DELETE(bd);
 }
 
@@ -477,14 +489,25 @@ static void ImGui_ImplOpenGL3_SetupRenderState(ImDrawData* draw_data, int fb_wid
     float B = draw_data->DisplayPos.y + draw_data->DisplaySize.y;
 #if defined(GL_CLIP_ORIGIN)
     if (!clip_origin_lower_left) { float tmp = T; T = B; B = tmp; } // Swap top and bottom if origin is upper left
+#endif
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    const float pos_scale = 1.0f / (float)(1 << IMGUI_COMPACT_DRAWVERT_POS_FRAC_BITS); // Positions are fixed point: fold the conversion into the projection matrix.
+#else
+    const float pos_scale = 1.0f;
 #endif
     const float ortho_projection[4][4] =
     {
-        { 2.0f/(R-L),   0.0f,         0.0f,   0.0f },
-        { 0.0f,         2.0f/(T-B),   0.0f,   0.0f },
-        { 0.0f,         0.0f,        -1.0f,   0.0f },
-        { (R+L)/(L-R),  (T+B)/(B-T),  0.0f,   1.0f },
+        { 2.0f/(R-L)*pos_scale, 0.0f,                   0.0f,   0.0f },
+        { 0.0f,                 2.0f/(T-B)*pos_scale,   0.0f,   0.0f },
+        { 0.0f,                 0.0f,                  -1.0f,   0.0f },
+        { (R+L)/(L-R),          (T+B)/(B-T),            0.0f,   1.0f },
     };
+    if (bd->ShaderHandleSDF)
+    {
+        glUseProgram(bd->ShaderHandleSDF);
+        glUniform1i(bd->AttribLocationTexSDF, 0);
+        glUniformMatrix4fv(bd->AttribLocationProjMtxSDF, 1, GL_FALSE, &ortho_projection[0][0]);
+    }
     glUseProgram(bd->ShaderHandle);
     glUniform1i(bd->AttribLocationTex, 0);
     glUniformMatrix4fv(bd->AttribLocationProjMtx, 1, GL_FALSE, &ortho_projection[0][0]);
@@ -505,8 +528,13 @@ static void ImGui_ImplOpenGL3_SetupRenderState(ImDrawData* draw_data, int fb_wid
     GL_CALL(glEnableVertexAttribArray(bd->AttribLocationVtxPos));
     GL_CALL(glEnableVertexAttribArray(bd->AttribLocationVtxUV));
     GL_CALL(glEnableVertexAttribArray(bd->AttribLocationVtxColor));
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    GL_CALL(glVertexAttribPointer(bd->AttribLocationVtxPos,   2, GL_SHORT,         GL_FALSE, sizeof(ImDrawVert), (GLvoid*)offsetof(ImDrawVert, pos)));
+    GL_CALL(glVertexAttribPointer(bd->AttribLocationVtxUV,    2, GL_UNSIGNED_SHORT, GL_TRUE, sizeof(ImDrawVert), (GLvoid*)offsetof(ImDrawVert, uv)));
+#else
     GL_CALL(glVertexAttribPointer(bd->AttribLocationVtxPos,   2, GL_FLOAT,         GL_FALSE, sizeof(ImDrawVert), (GLvoid*)offsetof(ImDrawVert, pos)));
     GL_CALL(glVertexAttribPointer(bd->AttribLocationVtxUV,    2, GL_FLOAT,         GL_FALSE, sizeof(ImDrawVert), (GLvoid*)offsetof(ImDrawVert, uv)));
+#endif
     GL_CALL(glVertexAttribPointer(bd->AttribLocationVtxColor, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(ImDrawVert), (GLvoid*)offsetof(ImDrawVert, col)));
 }
 
@@ -564,6 +592,9 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
     GLboolean last_enable_primitive_restart = (bd->GlVersion >= 310) ? glIsEnabled(GL_PRIMITIVE_RESTART) : GL_FALSE;
 #endif
 
+    // Upload glyphs rasterized since last frame (ImFontAtlasFlags_DynamicGlyphs)
+    ImGui_ImplOpenGL3_UpdateFontsTexture();
+
     // Setup desired GL state
     // Recreate the VAO every time (this is to easily allow multiple GL contexts to be rendered to. VAO are not shared among GL contexts)
     // The renderer would actually work without any VAO bound, but then our VertexAttrib calls would overwrite the default one currently bound.
@@ -572,6 +603,7 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
     GL_CALL(glGenVertexArrays(1, &vertex_array_object));
 #endif
     ImGui_ImplOpenGL3_SetupRenderState(draw_data, fb_width, fb_height, vertex_array_object);
+    GLuint current_program = bd->ShaderHandle;
 
     // Will project scissor/clipping rectangles into framebuffer space
     ImVec2 clip_off = draw_data->DisplayPos;         // (0,0) unless using multi-viewports
@@ -621,7 +653,10 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
                 // User callback, registered via ImDrawList::AddCallback()
                 // (ImDrawCallback_ResetRenderState is a special callback value used by the user to request the renderer to reset render state.)
                 if (pcmd->UserCallback == ImDrawCallback_ResetRenderState)
+                {
                     ImGui_ImplOpenGL3_SetupRenderState(draw_data, fb_width, fb_height, vertex_array_object);
+                    current_program = bd->ShaderHandle;
+                }
                 else
                     pcmd->UserCallback(draw_list, pcmd);
             }
@@ -636,8 +671,17 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
                 // Apply scissor/clipping rectangle (Y is inverted in OpenGL)
                 GL_CALL(glScissor((int)clip_min.x, (int)((float)fb_height - clip_max.y), (int)(clip_max.x - clip_min.x), (int)(clip_max.y - clip_min.y)));
 
+                // Select shader: text using SDF fonts refers to the font texture with io.Fonts->TexIDSDF
+                const ImTextureID tex_id = pcmd->GetTexID();
+                const GLuint program = (tex_id == bd->FontTexIDSDF && bd->FontTexIDSDF != 0) ? bd->ShaderHandleSDF : bd->ShaderHandle;
+                if (program != current_program)
+                {
+                    GL_CALL(glUseProgram(program));
+                    current_program = program;
+                }
+
                 // Bind texture, Draw
-                GL_CALL(glBindTexture(GL_TEXTURE_2D, (GLuint)(intptr_t)pcmd->GetTexID()));
+                GL_CALL(glBindTexture(GL_TEXTURE_2D, (GLuint)(intptr_t)tex_id));
 #ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_VTX_OFFSET
                 if (bd->GlVersion >= 320)
                     GL_CALL(glDrawElementsBaseVertex(GL_TRIANGLES, (GLsizei)pcmd->ElemCount, sizeof(ImDrawIdx) == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT, (void*)(intptr_t)(pcmd->IdxOffset * sizeof(ImDrawIdx)), (GLint)pcmd->VtxOffset));
@@ -718,8 +762,15 @@ bool ImGui_ImplOpenGL3_CreateFontsTexture()
 #endif
     GL_CALL(glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels));
 
-    // Store identifier
+    // Store identifiers
+    // The SDF identifier refers to the same texture with an extra high bit, which the (GLuint) cast in ImGui_ImplOpenGL3_RenderDrawData() drops.
+    // Build it directly as a 64-bit value: going through intptr_t would drop that bit in 32-bit builds, making it equal to the regular identifier.
     io.Fonts->SetTexID((ImTextureID)(intptr_t)bd->FontTexture);
+    if (bd->ShaderHandleSDF != 0 && sizeof(ImTextureID) >= 8)
+        bd->FontTexIDSDF = (ImTextureID)(((ImU64)1 << 32) | (ImU64)bd->FontTexture);
+    IM_ASSERT(bd->FontTexIDSDF != io.Fonts->TexID || bd->FontTexIDSDF == 0);
+    io.Fonts->TexIDSDF = bd->FontTexIDSDF;
+    io.Fonts->ClearTexUpdateRect();
 
     // Restore state
     GL_CALL(glBindTexture(GL_TEXTURE_2D, last_texture));
@@ -727,6 +778,32 @@ bool ImGui_ImplOpenGL3_CreateFontsTexture()
     return true;
 }
 
+// Upload the region of the font atlas modified by ImGui::NewFrame(), if any.
+// Called from ImGui_ImplOpenGL3_RenderDrawData(): the caller is in charge of restoring the texture binding.
+static void ImGui_ImplOpenGL3_UpdateFontsTexture()
+{
+    ImGuiIO& io = ImGui::GetIO();
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    int x, y, w, h;
+    if (bd->FontTexture == 0 || !io.Fonts->GetTexUpdateRect(&x, &y, &w, &h))
+        return;
+
+    unsigned char* pixels;
+    int width, height;
+    io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);
+    GL_CALL(glBindTexture(GL_TEXTURE_2D, bd->FontTexture));
+#ifdef GL_UNPACK_ROW_LENGTH // Not on WebGL/ES
+    GL_CALL(glPixelStorei(GL_UNPACK_ROW_LENGTH, width));
+#else
+    x = 0; w = width; // Upload full rows
+#endif
+    GL_CALL(glTexSubImage2D(GL_TEXTURE_2D, 0, x, y, w, h, GL_RGBA, GL_UNSIGNED_BYTE, pixels + (y * width + x) * 4));
+#ifdef GL_UNPACK_ROW_LENGTH
+    GL_CALL(glPixelStorei(GL_UNPACK_ROW_LENGTH, 0));
+#endif
+    io.Fonts->ClearTexUpdateRect();
+}
+
 void ImGui_ImplOpenGL3_DestroyFontsTexture()
 {
     ImGuiIO& io = ImGui::GetIO();
@@ -735,7 +812,9 @@ void ImGui_ImplOpenGL3_DestroyFontsTexture()
     {
         glDeleteTextures(1, &bd->FontTexture);
         io.Fonts->SetTexID(0);
+        io.Fonts->TexIDSDF = 0;
         bd->FontTexture = 0;
+        bd->FontTexIDSDF = 0;
     }
 }
 
@@ -898,28 +977,91 @@ bool    ImGui_ImplOpenGL3_CreateDeviceObjects()
         "    Out_Color = Frag_Color * texture(Texture, Frag_UV.st);\n"
         "}\n";
 
+    // Distance field fragment shaders for SDF fonts: the edge is at alpha 0.5, anti-aliased over about one screen pixel.
+    // (GLSL ES 1.00 needs GL_OES_standard_derivatives for fwidth(), otherwise we use a fixed smoothing width)
+    const GLchar* fragment_shader_sdf_glsl_120 =
+        "#ifdef GL_ES\n"
+        "#extension GL_OES_standard_derivatives : enable\n"
+        "    precision mediump float;\n"
+        "#endif\n"
+        "uniform sampler2D Texture;\n"
+        "varying vec2 Frag_UV;\n"
+        "varying vec4 Frag_Color;\n"
+        "void main()\n"
+        "{\n"
+        "    float d = texture2D(Texture, Frag_UV.st).a;\n"
+        "#if defined(GL_ES) && !defined(GL_OES_standard_derivatives)\n"
+        "    float w = 0.1;\n"
+        "#else\n"
+        "    float w = max(fwidth(d) * 0.7, 0.0001);\n"
+        "#endif\n"
+        "    gl_FragColor = vec4(Frag_Color.rgb, Frag_Color.a * smoothstep(0.5 - w, 0.5 + w, d));\n"
+        "}\n";
+
+    const GLchar* fragment_shader_sdf_glsl_130 =
+        "uniform sampler2D Texture;\n"
+        "in vec2 Frag_UV;\n"
+        "in vec4 Frag_Color;\n"
+        "out vec4 Out_Color;\n"
+        "void main()\n"
+        "{\n"
+        "    float d = texture(Texture, Frag_UV.st).a;\n"
+        "    float w = max(fwidth(d) * 0.7, 0.0001);\n"
+        "    Out_Color = vec4(Frag_Color.rgb, Frag_Color.a * smoothstep(0.5 - w, 0.5 + w, d));\n"
+        "}\n";
+
+    const GLchar* fragment_shader_sdf_glsl_300_es =
+        "precision mediump float;\n"
+        "uniform sampler2D Texture;\n"
+        "in vec2 Frag_UV;\n"
+        "in vec4 Frag_Color;\n"
+        "layout (location = 0) out vec4 Out_Color;\n"
+        "void main()\n"
+        "{\n"
+        "    float d = texture(Texture, Frag_UV.st).a;\n"
+        "    float w = max(fwidth(d) * 0.7, 0.0001);\n"
+        "    Out_Color = vec4(Frag_Color.rgb, Frag_Color.a * smoothstep(0.5 - w, 0.5 + w, d));\n"
+        "}\n";
+
+    const GLchar* fragment_shader_sdf_glsl_410_core =
+        "in vec2 Frag_UV;\n"
+        "in vec4 Frag_Color;\n"
+        "uniform sampler2D Texture;\n"
+        "layout (location = 0) out vec4 Out_Color;\n"
+        "void main()\n"
+        "{\n"
+        "    float d = texture(Texture, Frag_UV.st).a;\n"
+        "    float w = max(fwidth(d) * 0.7, 0.0001);\n"
+        "    Out_Color = vec4(Frag_Color.rgb, Frag_Color.a * smoothstep(0.5 - w, 0.5 + w, d));\n"
+        "}\n";
+
     // Select shaders matching our GLSL versions
     const GLchar* vertex_shader = nullptr;
     const GLchar* fragment_shader = nullptr;
+    const GLchar* fragment_shader_sdf = nullptr;
     if (glsl_version < 130)
     {
         vertex_shader = vertex_shader_glsl_120;
         fragment_shader = fragment_shader_glsl_120;
+        fragment_shader_sdf = fragment_shader_sdf_glsl_120;
     }
     else if (glsl_version >= 410)
     {
         vertex_shader = vertex_shader_glsl_410_core;
         fragment_shader = fragment_shader_glsl_410_core;
+        fragment_shader_sdf = fragment_shader_sdf_glsl_410_core;
     }
     else if (glsl_version == 300)
     {
         vertex_shader = vertex_shader_glsl_300_es;
         fragment_shader = fragment_shader_glsl_300_es;
+        fragment_shader_sdf = fragment_shader_sdf_glsl_300_es;
     }
     else
     {
         vertex_shader = vertex_shader_glsl_130;
         fragment_shader = fragment_shader_glsl_130;
+        fragment_shader_sdf = fragment_shader_sdf_glsl_130;
     }
 
     // Create shaders
@@ -946,7 +1088,6 @@ bool    ImGui_ImplOpenGL3_CreateDeviceObjects()
 
     glDetachShader(bd->ShaderHandle, vert_handle);
     glDetachShader(bd->ShaderHandle, frag_handle);
-    glDeleteShader(vert_handle);
     glDeleteShader(frag_handle);
 
     bd->AttribLocationTex = glGetUniformLocation(bd->ShaderHandle, "Texture");
@@ -955,6 +1096,38 @@ bool    ImGui_ImplOpenGL3_CreateDeviceObjects()
     bd->AttribLocationVtxUV = (GLuint)glGetAttribLocation(bd->ShaderHandle, "UV");
     bd->AttribLocationVtxColor = (GLuint)glGetAttribLocation(bd->ShaderHandle, "Color");
 
+    // Link SDF program, sharing the vertex shader and vertex attributes locations (so both programs can use the same vertex setup)
+    const GLchar* fragment_shader_sdf_with_version[2] = { bd->GlslVersionString, fragment_shader_sdf };
+    GLuint frag_sdf_handle;
+    GL_CALL(frag_sdf_handle = glCreateShader(GL_FRAGMENT_SHADER));
+    glShaderSource(frag_sdf_handle, 2, fragment_shader_sdf_with_version, nullptr);
+    glCompileShader(frag_sdf_handle);
+    if (CheckShader(frag_sdf_handle, "SDF fragment shader"))
+    {
+        bd->ShaderHandleSDF = glCreateProgram();
+        glAttachShader(bd->ShaderHandleSDF, vert_handle);
+        glAttachShader(bd->ShaderHandleSDF, frag_sdf_handle);
+        glBindAttribLocation(bd->ShaderHandleSDF, bd->AttribLocationVtxPos, "Position");
+        glBindAttribLocation(bd->ShaderHandleSDF, bd->AttribLocationVtxUV, "UV");
+        glBindAttribLocation(bd->ShaderHandleSDF, bd->AttribLocationVtxColor, "Color");
+        glLinkProgram(bd->ShaderHandleSDF);
+        const bool sdf_program_ok = CheckProgram(bd->ShaderHandleSDF, "SDF shader program");
+        glDetachShader(bd->ShaderHandleSDF, vert_handle);
+        glDetachShader(bd->ShaderHandleSDF, frag_sdf_handle);
+        if (sdf_program_ok)
+        {
+            bd->AttribLocationTexSDF = glGetUniformLocation(bd->ShaderHandleSDF, "Texture");
+            bd->AttribLocationProjMtxSDF = glGetUniformLocation(bd->ShaderHandleSDF, "ProjMtx");
+        }
+        else
+        {
+            glDeleteProgram(bd->ShaderHandleSDF);
+            bd->ShaderHandleSDF = 0;
+        }
+    }
+    glDeleteShader(frag_sdf_handle);
+    glDeleteShader(vert_handle);
+
     // Create buffers
     glGenBuffers(1, &bd->VboHandle);
     glGenBuffers(1, &bd->ElementsHandle);
@@ -980,6 +1153,7 @@ void    ImGui_ImplOpenGL3_DestroyDeviceObjects()
     if (bd->VboHandle)      { glDeleteBuffers(1, &bd->VboHandle); bd->VboHandle = 0; }
     if (bd->ElementsHandle) { glDeleteBuffers(1, &bd->ElementsHandle); bd->ElementsHandle = 0; }
     if (bd->ShaderHandle)   { glDeleteProgram(bd->ShaderHandle); bd->ShaderHandle = 0; }
+    if (bd->ShaderHandleSDF){ glDeleteProgram(bd->ShaderHandleSDF); bd->ShaderHandleSDF = 0; }
     ImGui_ImplOpenGL3_DestroyFontsTexture();
 }
 
@@ -168,7 +168,9 @@ struct ImGuiNextItemData;           // Storage for SetNextItem** functions
 struct ImGuiOldColumnData;          // Storage data for a single column for legacy Columns() api
 struct ImGuiOldColumns;             // Storage data for a columns set for legacy Columns() api
 struct ImGuiPopupData;              // Storage for current popup stack
+struct ImGuiSettingsBinaryReader;  // Helper to read binary .ini data (io.ConfigIniSettingsBinary)
 struct ImGuiSettingsHandler;        // Storage for one type registered in the .ini file
+struct ImGuiSettingsSaveWorker;     // Background thread writing .ini settings to disk (with IMGUI_ENABLE_THREADS)
 struct ImGuiStyleMod;               // Stacked style modifier, backup of modified data so we can restore it
 struct ImGuiStyleVarInfo;           // Style variable information (e.g. to access style variables from an enum)
 struct ImGuiTabBar;                 // Storage for a tab bar
@@ -180,6 +182,7 @@ struct ImGuiTableInstanceData;      // Storage for one instance of a same table
 struct ImGuiTableTempData;          // Temporary storage for one table (one per table in the stack), shared between tables.
 struct ImGuiTableSettings;          // Storage for a table .ini settings
 struct ImGuiTableColumnsSettings;   // Storage for a column .ini settings
+struct ImGuiTextSizeCache;          // Cache for CalcTextSize() results (io.ConfigTextSizeCacheSize)
 struct ImGuiTreeNodeStackData;      // Temporary storage for TreeNode().
 struct ImGuiTypingSelectState;      // Storage for GetTypingSelectRequest()
 struct ImGuiTypingSelectRequest;    // Storage for GetTypingSelectRequest() (aimed to be public)
@@ -350,6 +353,8 @@ extern IMGUI_API ImGuiContext* GImGui;  // Current implicit context pointer
 // - Helpers: String
 // - Helpers: Formatting
 // - Helpers: UTF-8 <> wchar conversions
+// - Helpers: File System
+// - Helpers: Threading, Time
 // - Helpers: ImVec2/ImVec4 operators
 // - Helpers: Maths
 // - Helpers: Geometry
@@ -449,6 +454,32 @@ IMGUI_API ImU64             ImFileWrite(const void* data, ImU64 size, ImU64 coun
 #define IMGUI_DISABLE_TTY_FUNCTIONS // Can't use stdout, fflush if we are not using default file functions
 #endif
 IMGUI_API void*             ImFileLoadToMemory(const char* filename, const char* mode, size_t* out_file_size = NULL, int padding_bytes = 0);
+IMGUI_API bool              ImFileWriteAtomically(const char* filename, const char* mode, const void* data, size_t data_size); // Write to a temporary file then rename it over 'filename'. Doesn't allocate memory.
+
+// Helpers: File System (read-only memory mapping)
+// - Uses mmap()/MapViewOfFile() where available, otherwise falls back to loading the whole file with ImFileLoadToMemory().
+// - An empty file maps successfully with Data == NULL and Size == 0.
+struct ImFileMapping
+{
+    const void*     Data;
+    ImU64           Size;
+    void*           PlatformHandles[2]; // [Internal] File and mapping handles
+    bool            DataOwned;          // [Internal] Data was loaded with ImFileLoadToMemory()
+
+    ImFileMapping() { memset(this, 0, sizeof(*this)); }
+};
+IMGUI_API bool              ImFileMapToMemory(const char* filename, ImFileMapping* out_mapping);
+IMGUI_API void              ImFileUnmap(ImFileMapping* mapping);
+
+// Helpers: Threading, Time
+// - ImParallelFor() calls func(user_data, job_index) for every job in [0..jobs_count), from up to ImThreadGetWorkersCount() threads.
+//   Without IMGUI_ENABLE_THREADS (see imconfig.h) jobs are all executed in order on the calling thread.
+// - Jobs may run concurrently: they must not call ImGui:: functions nor IM_ALLOC()/IM_FREE() (which feed the non thread-safe debug allocation hooks).
+#define IM_THREAD_WORKERS_MAX       64
+typedef void (*ImParallelForFunc)(void* user_data, int job_index);
+IMGUI_API int               ImThreadGetWorkersCount();
+IMGUI_API void              ImParallelFor(int jobs_count, ImParallelForFunc func, void* user_data);
+IMGUI_API double            ImTimeGetSeconds();             // Monotonic high-resolution clock, for measuring durations.
 
 // Helpers: Maths
 IM_MSVC_RUNTIME_CHECKS_OFF
@@ -1155,6 +1186,7 @@ struct IMGUI_API ImGuiInputTextState
     int                     TextLen;                // UTF-8 length of the string in TextA (in bytes)
     const char*             TextSrc;                // == TextA.Data unless read-only, in which case == buf passed to InputText(). Field only set and valid _inside_ the call InputText() call.
     ImVector<char>          TextA;                  // main UTF8 buffer. TextA.Size is a buffer size! Should always be >= buf_size passed by user (and of course >= CurLenA + 1).
+    ImVector<int>           LineOffsets;            // offset of the beginning of each line in TextSrc. Rebuilt on demand when empty, otherwise patched by each edit (so multi-line doesn't rescan its text every frame).
     ImVector<char>          TextToRevertTo;         // value to revert to when pressing Escape = backup of end-user buffer at the time of focus (in UTF-8, unaltered)
     ImVector<char>          CallbackTextBackup;     // temporary storage for callback to support automatic reconcile of undo-stack
     int                     BufCapacity;            // end-user buffer capacity (include zero terminator)
@@ -1169,8 +1201,8 @@ struct IMGUI_API ImGuiInputTextState
 
     ImGuiInputTextState();
     ~ImGuiInputTextState();
-    void        ClearText()                 { TextLen = 0; TextA[0] = 0; CursorClamp(); }
-    void        ClearFreeMemory()           { TextA.clear(); TextToRevertTo.clear(); }
+    void        ClearText()                 { TextLen = 0; TextA[0] = 0; LineOffsets.resize(0); CursorClamp(); }
+    void        ClearFreeMemory()           { TextA.clear(); TextToRevertTo.clear(); LineOffsets.clear(); }
     void        OnKeyPressed(int key);      // Cannot be inline because we call in code in stb_textedit.h implementation
     void        OnCharPressed(unsigned int c);
 
@@ -1366,6 +1398,31 @@ struct ImGuiDeactivatedItemData
     bool        IsAlive;
 };
 
+// 24 bytes, a set of 4 entries spans 2 cache lines at most
+struct ImGuiTextSizeCacheEntry
+{
+    ImU64       Key;            // 64-bit hash of text, font, font size and wrap width (bits 32+ also select the set). 0 when unused.
+    int         TextLen;        // Checked along with Key, so a hit also requires the same text length
+    int         LastUsedFrame;
+    ImVec2      Size;
+};
+
+// Cache for CalcTextSize() results, enabled with io.ConfigTextSizeCacheSize.
+// 4-way set associative: on a miss, the least recently used entry of the set is replaced, unless it was used during this frame.
+// Keys include ImFontAtlas::BuildCount, so entries measured with a previous build of a font are never returned.
+struct ImGuiTextSizeCache
+{
+    ImVector<ImGuiTextSizeCacheEntry> Entries;  // Power of two
+    int         Hits;                           // Stats for current frame
+    int         Misses;
+    int         Evictions;
+    int         LastFrameHits;                  // Stats for previous frame
+    int         LastFrameMisses;
+    int         LastFrameEvictions;
+
+    ImGuiTextSizeCache()        { Hits = Misses = Evictions = LastFrameHits = LastFrameMisses = LastFrameEvictions = 0; }
+};
+
 //-----------------------------------------------------------------------------
 // [SECTION] Popup support
 //-----------------------------------------------------------------------------
@@ -1583,10 +1640,12 @@ struct ImGuiListClipperData
     float                           LossynessOffset;
     int                             StepNo;
     int                             ItemsFrozen;
+    int                             MeasureItemIdx;     // With a ImGuiListClipperHeightIndex: item displayed by last step, to measure on next step
+    float                           MeasurePosY;
     ImVector<ImGuiListClipperRange> Ranges;
 
     ImGuiListClipperData()          { memset(this, 0, sizeof(*this)); }
-    void                            Reset(ImGuiListClipper* clipper) { ListClipper = clipper; StepNo = ItemsFrozen = 0; Ranges.resize(0); }
+    void                            Reset(ImGuiListClipper* clipper) { ListClipper = clipper; StepNo = ItemsFrozen = 0; MeasureItemIdx = -1; MeasurePosY = 0.0f; Ranges.resize(0); }
 };
 
 //-----------------------------------------------------------------------------
@@ -2063,6 +2122,18 @@ struct ImGuiViewportP : public ImGuiViewport
 // [SECTION] Settings support
 //-----------------------------------------------------------------------------
 
+// Location of an entry's text in the output of the previous SaveIniSettingsToMemory() call (g.SettingsIniDataPrev).
+// Handlers copy the text of unchanged entries from there instead of formatting them again. See SettingsWriteCacheCopy().
+struct ImGuiSettingsWriteCache
+{
+    int         Offset;         // Offset of entry text in g.SettingsIniDataPrev
+    int         Size;
+    int         SaveCount;      // Value of g.SettingsSaveCount when written. Only valid if written by the previous save.
+    ImGuiID     DataHash;       // Optional hash of entry data when written, for handlers which can't call Invalidate() on every change.
+
+    void        Invalidate()    { SaveCount = 0; }
+};
+
 // Windows data saved in imgui.ini file
 // Because we never destroy or rename ImGuiWindowSettings, we can store the names in a separate buffer easily.
 // (this is designed to be stored in a ImChunkStream buffer, with the variable-length Name following our structure)
@@ -2080,6 +2151,7 @@ struct ImGuiWindowSettings
     bool        IsChild;
     bool        WantApply;      // Set when loaded from .ini data (to enable merging/loading .ini data into an already running context)
     bool        WantDelete;     // Set to invalidate/delete the settings entry
+    ImGuiSettingsWriteCache WriteCache;
 
     ImGuiWindowSettings()       { memset(this, 0, sizeof(*this)); DockOrder = -1; }
     char* GetName()             { return (char*)(this + 1); }
@@ -2095,11 +2167,38 @@ struct ImGuiSettingsHandler
     void        (*ReadLineFn)(ImGuiContext* ctx, ImGuiSettingsHandler* handler, void* entry, const char* line); // Read: Called for every line of text within an ini entry
     void        (*ApplyAllFn)(ImGuiContext* ctx, ImGuiSettingsHandler* handler);                                // Read: Called after reading (in registration order)
     void        (*WriteAllFn)(ImGuiContext* ctx, ImGuiSettingsHandler* handler, ImGuiTextBuffer* out_buf);      // Write: Output every entries into 'out_buf'
+    void        (*WriteAllBinaryFn)(ImGuiContext* ctx, ImGuiSettingsHandler* handler, ImGuiTextBuffer* out_buf);            // Write: Output every entries into 'out_buf' in binary form (io.ConfigIniSettingsBinary). Optional: WriteAllFn() output is stored instead.
+    void        (*ReadAllBinaryFn)(ImGuiContext* ctx, ImGuiSettingsHandler* handler, ImGuiSettingsBinaryReader* reader);   // Read: Called with data written by WriteAllBinaryFn(), between ReadInitFn() and ApplyAllFn()
     void*       UserData;
 
     ImGuiSettingsHandler() { memset(this, 0, sizeof(*this)); }
 };
 
+// Helpers to write/read the compact binary .ini format (io.ConfigIniSettingsBinary)
+// Values are stored in native byte order. A file written on a machine with different endianness fails the version check and is ignored.
+struct ImGuiSettingsBinaryWriter
+{
+    ImGuiTextBuffer*    Buf;
+
+    ImGuiSettingsBinaryWriter(ImGuiTextBuffer* buf)     { Buf = buf; }
+    void                Write(const void* src, size_t size) { Buf->append((const char*)src, (const char*)src + size); }
+    template<typename T> void Write(T v)                { Write(&v, sizeof(v)); }
+    void                WriteString(const char* s)      { ImU32 len = (ImU32)ImStrlen(s); Write(len); Write(s, (size_t)len + 1); } // Length + zero-terminated string
+};
+
+struct ImGuiSettingsBinaryReader
+{
+    const char*         Data;
+    const char*         DataEnd;
+    bool                Overflow;                       // Set when reading past the end or reading invalid data. All subsequent reads return zeroes.
+
+    ImGuiSettingsBinaryReader(const void* data, size_t size) { Data = (const char*)data; DataEnd = Data + size; Overflow = false; }
+    bool                IsEnd() const                   { return Overflow || Data >= DataEnd; }
+    void                Read(void* dst, size_t size)    { if (Overflow || (size_t)(DataEnd - Data) < size) { Overflow = true; memset(dst, 0, size); return; } memcpy(dst, Data, size); Data += size; }
+    template<typename T> T Read()                       { T v; Read(&v, sizeof(v)); return v; }
+    const char*         ReadString()                    { ImU32 len = Read<ImU32>(); if (Overflow || (size_t)(DataEnd - Data) <= len || Data[len] != 0) { Overflow = true; return NULL; } const char* s = Data; Data += len + 1; return s; }
+};
+
 //-----------------------------------------------------------------------------
 // [SECTION] Localization support
 //-----------------------------------------------------------------------------
@@ -2554,6 +2653,7 @@ struct ImGuiContext
     ImVector<char>          ClipboardHandlerData;               // If no custom clipboard handler is defined
     ImVector<ImGuiID>       MenusIdSubmittedThisFrame;          // A list of menu IDs that were rendered at least once
     ImGuiTypingSelectState  TypingSelectState;                  // State for GetTypingSelectRequest()
+    ImGuiTextSizeCache      TextSizeCache;                      // CalcTextSize() results (io.ConfigTextSizeCacheSize)
 
     // Platform support
     ImGuiPlatformImeData    PlatformImeData;                    // Data updated by current frame
@@ -2569,6 +2669,10 @@ struct ImGuiContext
     bool                    SettingsLoaded;
     float                   SettingsDirtyTimer;                 // Save .ini Settings to memory when time reaches zero
     ImGuiTextBuffer         SettingsIniData;                    // In memory .ini settings
+    ImGuiTextBuffer         SettingsIniDataPrev;                // Output of previous SaveIniSettingsToMemory() call, unchanged entries are copied from there (see ImGuiSettingsWriteCache)
+    int                     SettingsSaveCount;                  // Incremented on every SaveIniSettingsToMemory() call, and when SettingsIniData is overwritten (to invalidate write caches)
+    ImGuiID                 SettingsIniDataSavedHash;           // Hash of .ini filename + data last written to disk, to skip saving unchanged settings
+    ImGuiSettingsSaveWorker* SettingsSaveWorker;                // Background thread writing .ini settings to disk (created on first save, with IMGUI_ENABLE_THREADS)
     ImVector<ImGuiSettingsHandler>      SettingsHandlers;       // List of .ini settings handlers
     ImChunkStream<ImGuiWindowSettings>  SettingsWindows;        // ImGuiWindow .ini settings entries
     ImChunkStream<ImGuiTableSettings>   SettingsTables;         // ImGuiTable .ini settings entries
@@ -3220,6 +3324,7 @@ struct ImGuiTableSettings
     ImGuiTableColumnIdx         ColumnsCount;
     ImGuiTableColumnIdx         ColumnsCountMax;        // Maximum number of columns this settings instance can store, we can recycle a settings instance with lower number of columns but not higher
     bool                        WantApply;              // Set when loaded from .ini data (to enable merging/loading .ini data into an already running context)
+    ImGuiSettingsWriteCache     WriteCache;
 
     ImGuiTableSettings()        { memset(this, 0, sizeof(*this)); }
     ImGuiTableColumnSettings*   GetColumnSettings()     { return (ImGuiTableColumnSettings*)(this + 1); }
@@ -3312,9 +3417,12 @@ namespace ImGui
     IMGUI_API void                  MarkIniSettingsDirty();
     IMGUI_API void                  MarkIniSettingsDirty(ImGuiWindow* window);
     IMGUI_API void                  ClearIniSettings();
+    IMGUI_API void                  SaveIniSettingsToDiskAsync(const char* ini_filename);   // Serialize now, write to disk from a worker thread. Skipped if unchanged since last save.
     IMGUI_API void                  AddSettingsHandler(const ImGuiSettingsHandler* handler);
     IMGUI_API void                  RemoveSettingsHandler(const char* type_name);
     IMGUI_API ImGuiSettingsHandler* FindSettingsHandler(const char* type_name);
+    IMGUI_API bool                  SettingsWriteCacheCopy(ImGuiSettingsWriteCache* cache, ImGuiTextBuffer* out_buf, ImGuiID data_hash = 0);                    // Append entry text from previous save if still valid. Return false if entry needs to be formatted.
+    IMGUI_API void                  SettingsWriteCacheStore(ImGuiSettingsWriteCache* cache, ImGuiTextBuffer* out_buf, int entry_offset, ImGuiID data_hash = 0); // Record entry text just formatted from 'entry_offset', for next save.
 
     // Settings - Windows
     IMGUI_API ImGuiWindowSettings*  CreateNewWindowSettings(const char* name);
@@ -3805,6 +3913,7 @@ namespace ImGui
 
     // Plot
     IMGUI_API int           PlotEx(ImGuiPlotType plot_type, const char* label, float (*values_getter)(void* data, int idx), void* data, int values_count, int values_offset, const char* overlay_text, float scale_min, float scale_max, const ImVec2& size_arg);
+    IMGUI_API int           PlotEx(ImGuiPlotType plot_type, const char* label, const ImGuiPlotBuffer* buffer, const char* overlay_text, float scale_min, float scale_max, const ImVec2& size_arg);
 
     // Shade functions (write over already created vertices)
     IMGUI_API void          ShadeVertsLinearColorGradientKeepAlpha(ImDrawList* draw_list, int vert_start_idx, int vert_end_idx, ImVec2 gradient_p0, ImVec2 gradient_p1, ImU32 col0, ImU32 col1);
@@ -3904,6 +4013,15 @@ IMGUI_API void      ImFontAtlasBuildRender32bppRectFromString(ImFontAtlas* atlas
 IMGUI_API void      ImFontAtlasBuildMultiplyCalcLookupTable(unsigned char out_table[256], float in_multiply_factor);
 IMGUI_API void      ImFontAtlasBuildMultiplyRectAlpha8(const unsigned char table[256], unsigned char* pixels, int x, int y, int w, int h, int stride);
 IMGUI_API void      ImFontAtlasBuildGetOversampleFactors(const ImFontConfig* src, int* out_oversample_h, int* out_oversample_v);
+IMGUI_API ImGuiID   ImFontAtlasCacheCalcKey(ImFontAtlas* atlas);
+IMGUI_API bool      ImFontAtlasCacheSave(ImFontAtlas* atlas, const char* filename);
+IMGUI_API bool      ImFontAtlasCacheLoad(ImFontAtlas* atlas, const char* filename);
+
+// Glyphs rasterized on demand (ImFontAtlasFlags_DynamicGlyphs, stb_truetype builder only)
+IMGUI_API void      ImFontAtlasUpdateDynamicGlyphs(ImFontAtlas* atlas);                 // Rasterize glyphs queued by ImFont::FindGlyph(). Called by ImGui::NewFrame().
+IMGUI_API void      ImFontAtlasDynamicShutdown(ImFontAtlas* atlas);                     // Free dynamic data, fonts stop requesting glyphs.
+IMGUI_API ImFontGlyph* ImFontAtlasDynamicQueueGlyph(ImFont* font, ImWchar c);           // Request rasterization of an available code-point, return a placeholder glyph.
+IMGUI_API void      ImFontAtlasDynamicTouchGlyph(ImFont* font, int glyph_index);        // Mark glyph as used this frame (for eviction).
 
 IMGUI_API bool      ImFontAtlasGetMouseCursorTexData(ImFontAtlas* atlas, ImGuiMouseCursor cursor_type, ImVec2* out_offset, ImVec2* out_size, ImVec2 out_uv_border[2], ImVec2 out_uv_fill[2]);
 
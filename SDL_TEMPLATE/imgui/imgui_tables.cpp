@@ -18,6 +18,7 @@ Index of this file:
 // [SECTION] Tables: Context Menu
 // [SECTION] Tables: Settings (.ini data)
 // [SECTION] Tables: Garbage Collection
+// [SECTION] Tables: Virtual Grid
 // [SECTION] Tables: Debugging
 // [SECTION] Columns, BeginColumns, EndColumns, etc.
 
@@ -2831,6 +2832,7 @@ void ImGui::TableDrawBorders(ImGuiTable* table)
 // - TableSetColumnSortDirection() [Internal]
 // - TableSortSpecsSanitize() [Internal]
 // - TableSortSpecsBuild() [Internal]
+// - ImGuiTableSorter
 //-------------------------------------------------------------------------
 
 // Return NULL if no sort specs (most often when ImGuiTableFlags_Sortable is not set)
@@ -3019,6 +3021,374 @@ void ImGui::TableSortSpecsBuild(ImGuiTable* table)
     table->SortSpecs.SpecsCount = table->SortSpecsCount;
 }
 
+//-------------------------------------------------------------------------
+// ImGuiTableSorter
+//-------------------------------------------------------------------------
+// - Keys of each column are extracted once and converted to unsigned integers sorting in the same order.
+//   Strings are converted to their rank: sorted by a radix sort on their first 8 bytes, then by strcmp() within groups of equal prefixes.
+// - Each sort spec is applied with a stable radix sort, from the last spec to the first: the first spec ends up as the primary criteria.
+//   There are 8 passes of 8 bits at most, and we skip passes where all keys share the same digit (e.g. upper bytes of small integers).
+// - Rows are split in chunks processed by ImParallelFor() jobs. Jobs only access buffers allocated beforehand.
+//-------------------------------------------------------------------------
+
+#define IMGUI_TABLE_SORTER_CHUNK_MIN        16384   // Minimum number of rows per job
+
+struct ImGuiTableSorterJobs
+{
+    const ImU64*    ColumnKeys;         // Keys of column being sorted, indexed by row
+    ImU64           KeyXor;             // ~0 to sort in descending order
+    int             ItemsCount;
+    int             ChunkSize;
+    const int*      SrcIndices;
+    int*            DstIndices;
+    ImU64*          SrcKeys;
+    ImU64*          DstKeys;
+    int*            Counts;             // [ChunksCount][256] offsets, or [ChunksCount][8][256] histograms while gathering
+    int             Shift;              // Current pass digit
+};
+
+// Convert a numeric key to an unsigned integer sorting in the same order (IEEE floats: flip sign bit of positive values, all bits of negative ones)
+// Values are kept in the smallest possible type, so the radix sort can skip upper bytes.
+// -0.0 is converted as +0.0, so they are ties like with operator<. All NaN values are converted to the same key, sorting after +INF.
+static ImU64 TableSorterConvertKey(ImGuiDataType data_type, const void* p)
+{
+    switch (data_type)
+    {
+    case ImGuiDataType_S8:      return (ImU8)(*(const ImS8*)p) ^ 0x80;
+    case ImGuiDataType_U8:      return *(const ImU8*)p;
+    case ImGuiDataType_S16:     return (ImU16)(*(const ImS16*)p) ^ 0x8000;
+    case ImGuiDataType_U16:     return *(const ImU16*)p;
+    case ImGuiDataType_S32:     return (ImU32)(*(const ImS32*)p) ^ 0x80000000u;
+    case ImGuiDataType_U32:     return *(const ImU32*)p;
+    case ImGuiDataType_S64:     return (ImU64)(*(const ImS64*)p) ^ ((ImU64)1 << 63);
+    case ImGuiDataType_U64:     return *(const ImU64*)p;
+    case ImGuiDataType_Bool:    return *(const bool*)p ? 1 : 0;
+    case ImGuiDataType_Float:
+    {
+        const float f = *(const float*)p;
+        ImU32 bits;
+        memcpy(&bits, p, sizeof(bits));
+        if (f == 0.0f)
+            bits = 0;           // -0.0 -> +0.0
+        else if (f != f)
+            bits = 0x7FC00000u; // Any NaN -> positive quiet NaN, above +INF
+        return (bits & 0x80000000u) ? (ImU32)~bits : (bits | 0x80000000u);
+    }
+    case ImGuiDataType_Double:
+    {
+        const double d = *(const double*)p;
+        ImU64 bits;
+        memcpy(&bits, p, sizeof(bits));
+        if (d == 0.0)
+            bits = 0;
+        else if (d != d)
+            bits = (ImU64)0x7FF8 << 48;
+        return (bits & ((ImU64)1 << 63)) ? ~bits : (bits | ((ImU64)1 << 63));
+    }
+    default: IM_ASSERT(0); return 0;
+    }
+}
+
+// Gather keys in current order of rows, and compute histograms of all 8 digits
+static void TableSorterGatherJob(void* user_data, int chunk_n)
+{
+    ImGuiTableSorterJobs* jobs = (ImGuiTableSorterJobs*)user_data;
+    const int i_begin = chunk_n * jobs->ChunkSize;
+    const int i_end = ImMin(i_begin + jobs->ChunkSize, jobs->ItemsCount);
+    int* counts = jobs->Counts + chunk_n * 8 * 256;
+    memset(counts, 0, 8 * 256 * sizeof(int));
+    for (int i = i_begin; i < i_end; i++)
+    {
+        const ImU64 key = jobs->ColumnKeys[jobs->SrcIndices[i]] ^ jobs->KeyXor;
+        jobs->SrcKeys[i] = key;
+        for (int digit_n = 0; digit_n < 8; digit_n++)
+            counts[digit_n * 256 + (int)((key >> (digit_n * 8)) & 0xFF)]++;
+    }
+}
+
+static void TableSorterCountJob(void* user_data, int chunk_n)
+{
+    ImGuiTableSorterJobs* jobs = (ImGuiTableSorterJobs*)user_data;
+    const int i_begin = chunk_n * jobs->ChunkSize;
+    const int i_end = ImMin(i_begin + jobs->ChunkSize, jobs->ItemsCount);
+    int* counts = jobs->Counts + chunk_n * 256;
+    memset(counts, 0, 256 * sizeof(int));
+    for (int i = i_begin; i < i_end; i++)
+        counts[(int)((jobs->SrcKeys[i] >> jobs->Shift) & 0xFF)]++;
+}
+
+static void TableSorterScatterJob(void* user_data, int chunk_n)
+{
+    ImGuiTableSorterJobs* jobs = (ImGuiTableSorterJobs*)user_data;
+    const int i_begin = chunk_n * jobs->ChunkSize;
+    const int i_end = ImMin(i_begin + jobs->ChunkSize, jobs->ItemsCount);
+    int offsets[256];
+    memcpy(offsets, jobs->Counts + chunk_n * 256, sizeof(offsets));
+    for (int i = i_begin; i < i_end; i++)
+    {
+        const ImU64 key = jobs->SrcKeys[i];
+        const int dst = offsets[(int)((key >> jobs->Shift) & 0xFF)]++;
+        jobs->DstKeys[dst] = key;
+        jobs->DstIndices[dst] = jobs->SrcIndices[i];
+    }
+}
+
+// Stable radix sort of Indices[] by a column's keys
+static void TableSorterSortByKeys(ImGuiTableSorter* sorter, const ImU64* column_keys, bool descending)
+{
+    const int items_count = sorter->Indices.Size;
+    const int chunks_count = ImClamp(items_count / IMGUI_TABLE_SORTER_CHUNK_MIN, 1, ImThreadGetWorkersCount());
+    sorter->TempIndices.resize(items_count);
+    sorter->TempKeys[0].resize(items_count);
+    sorter->TempKeys[1].resize(items_count);
+    sorter->TempCounts.resize(chunks_count * 8 * 256);
+    int* indices[2] = { sorter->Indices.Data, sorter->TempIndices.Data };
+    ImU64* keys[2] = { sorter->TempKeys[0].Data, sorter->TempKeys[1].Data };
+
+    ImGuiTableSorterJobs jobs;
+    jobs.ColumnKeys = column_keys;
+    jobs.KeyXor = descending ? ~(ImU64)0 : 0;
+    jobs.ItemsCount = items_count;
+    jobs.ChunkSize = (items_count + chunks_count - 1) / chunks_count;
+    jobs.SrcIndices = indices[0];
+    jobs.SrcKeys = keys[0];
+    jobs.Counts = sorter->TempCounts.Data;
+    ImParallelFor(chunks_count, TableSorterGatherJob, &jobs);
+
+    // Find digits which are not the same for all keys
+    int digits[8];
+    int digits_count = 0;
+    for (int digit_n = 0; digit_n < 8; digit_n++)
+    {
+        bool all_same = false;
+        for (int bucket_n = 0; bucket_n < 256 && !all_same; bucket_n++)
+        {
+            int count = 0;
+            for (int chunk_n = 0; chunk_n < chunks_count; chunk_n++)
+                count += jobs.Counts[(chunk_n * 8 + digit_n) * 256 + bucket_n];
+            all_same = (count == items_count);
+        }
+        if (!all_same)
+            digits[digits_count++] = digit_n;
+    }
+
+    int src_n = 0;
+    for (int pass_n = 0; pass_n < digits_count; pass_n++, src_n ^= 1)
+    {
+        jobs.Shift = digits[pass_n] * 8;
+        jobs.SrcIndices = indices[src_n];
+        jobs.DstIndices = indices[src_n ^ 1];
+        jobs.SrcKeys = keys[src_n];
+        jobs.DstKeys = keys[src_n ^ 1];
+        if (pass_n == 0)
+        {
+            // Reuse histograms computed while gathering
+            for (int chunk_n = 0; chunk_n < chunks_count; chunk_n++)
+                memmove(jobs.Counts + chunk_n * 256, jobs.Counts + (chunk_n * 8 + digits[0]) * 256, 256 * sizeof(int));
+        }
+        else
+        {
+            ImParallelFor(chunks_count, TableSorterCountJob, &jobs);
+        }
+
+        // Convert counts to output offsets: buckets in order, then chunks in order within a bucket (keeps the sort stable)
+        int offset = 0;
+        for (int bucket_n = 0; bucket_n < 256; bucket_n++)
+            for (int chunk_n = 0; chunk_n < chunks_count; chunk_n++)
+            {
+                int* count = &jobs.Counts[chunk_n * 256 + bucket_n];
+                const int bucket_count = *count;
+                *count = offset;
+                offset += bucket_count;
+            }
+        ImParallelFor(chunks_count, TableSorterScatterJob, &jobs);
+    }
+    if (src_n == 1)
+        sorter->Indices.swap(sorter->TempIndices);
+}
+
+// Stable merge sort of a range of row indices by strings, skipping their first 'skip_len' bytes (known to be equal)
+static void TableSorterSortStrings(int* indices, int* temp, int count, const char* const* strings, int skip_len)
+{
+    const int block_size = 16;
+    for (int block_begin = 0; block_begin < count; block_begin += block_size)
+    {
+        const int block_end = ImMin(block_begin + block_size, count);
+        for (int i = block_begin + 1; i < block_end; i++)
+        {
+            const int idx = indices[i];
+            int j = i;
+            for (; j > block_begin && strcmp(strings[indices[j - 1]] + skip_len, strings[idx] + skip_len) > 0; j--)
+                indices[j] = indices[j - 1];
+            indices[j] = idx;
+        }
+    }
+    int* src = indices;
+    int* dst = temp;
+    for (int width = block_size; width < count; width *= 2)
+    {
+        for (int i_begin = 0; i_begin < count; i_begin += width * 2)
+        {
+            const int i_mid = ImMin(i_begin + width, count);
+            const int i_end = ImMin(i_begin + width * 2, count);
+            int a = i_begin, b = i_mid, out = i_begin;
+            while (a < i_mid && b < i_end)
+                dst[out++] = (strcmp(strings[src[b]] + skip_len, strings[src[a]] + skip_len) < 0) ? src[b++] : src[a++]; // Ties are taken from the left run
+            while (a < i_mid)
+                dst[out++] = src[a++];
+            while (b < i_end)
+                dst[out++] = src[b++];
+        }
+        ImSwap(src, dst);
+    }
+    if (src != indices)
+        memcpy(indices, src, (size_t)count * sizeof(int));
+}
+
+// Convert strings to their rank (equal strings have the same rank). Uses Indices[] as scratch.
+static void TableSorterConvertStringsToRanks(ImGuiTableSorter* sorter, ImU64* keys, const char* const* strings, int items_count)
+{
+    // Sort by 8 bytes prefix (big-endian, so integer order == strcmp() order)
+    for (int n = 0; n < items_count; n++)
+    {
+        ImU64 prefix = 0;
+        const char* s = strings[n];
+        for (int byte_n = 0; byte_n < 8 && *s; byte_n++)
+            prefix |= (ImU64)(unsigned char)*s++ << (56 - byte_n * 8);
+        keys[n] = prefix;
+    }
+    sorter->Indices.resize(items_count);
+    for (int n = 0; n < items_count; n++)
+        sorter->Indices[n] = n;
+    TableSorterSortByKeys(sorter, keys, false);
+
+    // Sort groups of strings sharing the same 8 bytes prefix, then assign ranks
+    int* indices = sorter->Indices.Data;
+    ImU64* ranks = sorter->TempKeys[0].Data;
+    ImU64 rank = 0;
+    for (int group_begin = 0, group_end = 0; group_begin < items_count; group_begin = group_end)
+    {
+        const ImU64 prefix = keys[indices[group_begin]];
+        for (group_end = group_begin + 1; group_end < items_count && keys[indices[group_end]] == prefix; group_end++) {}
+        const bool is_long = (prefix & 0xFF) != 0; // Otherwise all strings of the group are equal
+        if (is_long && group_end - group_begin > 1)
+            TableSorterSortStrings(indices + group_begin, sorter->TempIndices.Data, group_end - group_begin, strings, 8);
+        for (int i = group_begin; i < group_end; i++)
+        {
+            if (i > group_begin && is_long && strcmp(strings[indices[i - 1]] + 8, strings[indices[i]] + 8) != 0)
+                rank++;
+            ranks[indices[i]] = rank;
+        }
+        rank++;
+    }
+    memcpy(keys, ranks, (size_t)items_count * sizeof(ImU64));
+}
+
+void ImGuiTableSorter::SetupColumn(int column_index, ImGuiDataType data_type, ImGuiTableSorterKeyGetter getter)
+{
+    IM_ASSERT(column_index >= 0 && column_index < IMGUI_TABLE_MAX_COLUMNS);
+    IM_ASSERT(data_type >= 0 && data_type < ImGuiDataType_COUNT);
+    if (column_index >= Columns.Size)
+    {
+        ImGuiTableSorterColumn empty_column = { ImGuiDataType_S32, NULL, -1 };
+        Columns.resize(column_index + 1, empty_column);
+    }
+    ImGuiTableSorterColumn& column = Columns[column_index];
+    column.DataType = data_type;
+    column.Getter = getter;
+    column.KeysOffset = -1;
+}
+
+bool ImGuiTableSorter::Sort(ImGuiTableSortSpecs* sort_specs, int items_count, void* user_data)
+{
+    const bool data_dirty = (items_count != ItemsCount) || (Indices.Size != items_count);
+    if (!data_dirty && !sort_specs->SpecsDirty)
+        return false;
+    sort_specs->SpecsDirty = false;
+
+    const int specs_count = sort_specs->SpecsCount;
+    if (!data_dirty && specs_count == SortedSpecs.Size)
+    {
+        int same_column_count = 0, same_direction_count = 0;
+        for (int spec_n = 0; spec_n < specs_count; spec_n++)
+            if (sort_specs->Specs[spec_n].ColumnIndex == SortedSpecs[spec_n].ColumnIndex)
+            {
+                same_column_count++;
+                same_direction_count += (sort_specs->Specs[spec_n].SortDirection == SortedSpecs[spec_n].SortDirection) ? 1 : 0;
+            }
+        if (same_direction_count == specs_count)
+            return false;
+
+        // Only the direction of a single sort spec changed: reverse
+        if (specs_count == 1 && same_column_count == 1)
+        {
+            for (int i = 0, j = items_count - 1; i < j; i++, j--)
+                ImSwap(Indices[i], Indices[j]);
+            SortedSpecs[0] = sort_specs->Specs[0];
+            return true;
+        }
+    }
+    SortWithSpecs(sort_specs->Specs, specs_count, items_count, user_data);
+    return true;
+}
+
+void ImGuiTableSorter::SortWithSpecs(const ImGuiTableColumnSortSpecs* specs, int specs_count, int items_count, void* user_data)
+{
+    if (items_count != ItemsCount)
+    {
+        SetDataDirty();
+        ItemsCount = items_count;
+    }
+    SortedSpecs.resize(specs_count);
+    if (specs_count > 0)
+        memcpy(SortedSpecs.Data, specs, (size_t)specs_count * sizeof(ImGuiTableColumnSortSpecs));
+
+    // Extract keys (once, until SetDataDirty() is called)
+    for (int spec_n = 0; spec_n < specs_count; spec_n++)
+    {
+        const int column_n = specs[spec_n].ColumnIndex;
+        if (column_n < 0 || column_n >= Columns.Size || Columns[column_n].Getter == NULL || Columns[column_n].KeysOffset != -1)
+            continue;
+        ImGuiTableSorterColumn* column = &Columns[column_n];
+        column->KeysOffset = Keys.Size;
+        Keys.resize(Keys.Size + items_count);
+        ImU64* keys = Keys.Data + column->KeysOffset;
+        if (column->DataType == ImGuiDataType_String)
+        {
+            TempStrings.resize(items_count);
+            for (int n = 0; n < items_count; n++)
+            {
+                const char* str = NULL;
+                column->Getter(user_data, n, (void*)&str);
+                TempStrings[n] = str ? str : "";
+            }
+            TableSorterConvertStringsToRanks(this, keys, TempStrings.Data, items_count);
+        }
+        else
+        {
+            for (int n = 0; n < items_count; n++)
+            {
+                union { ImU64 u64; double d; } value;
+                value.u64 = 0;
+                column->Getter(user_data, n, &value);
+                keys[n] = TableSorterConvertKey(column->DataType, &value);
+            }
+        }
+    }
+
+    // Sort
+    Indices.resize(items_count);
+    for (int n = 0; n < items_count; n++)
+        Indices[n] = n;
+    if (items_count > 1)
+        for (int spec_n = specs_count - 1; spec_n >= 0; spec_n--)
+        {
+            const int column_n = specs[spec_n].ColumnIndex;
+            if (column_n >= 0 && column_n < Columns.Size && Columns[column_n].Getter != NULL)
+                TableSorterSortByKeys(this, Keys.Data + Columns[column_n].KeysOffset, specs[spec_n].SortDirection == ImGuiSortDirection_Descending);
+        }
+}
+
 //-------------------------------------------------------------------------
 // [SECTION] Tables: Headers
 //-------------------------------------------------------------------------
@@ -3583,6 +3953,8 @@ void ImGui::TableDrawDefaultContextMenu(ImGuiTable* table, ImGuiTableFlags flags
 // - TableSettingsHandler_ReadOpen() [Internal]
 // - TableSettingsHandler_ReadLine() [Internal]
 // - TableSettingsHandler_WriteAll() [Internal]
+// - TableSettingsHandler_WriteAllBinary() [Internal]
+// - TableSettingsHandler_ReadAllBinary() [Internal]
 // - TableSettingsInstallHandler() [Internal]
 //-------------------------------------------------------------------------
 // [Init] 1: TableSettingsHandler_ReadXXXX()   Load and parse .ini file into TableSettings.
@@ -3703,6 +4075,7 @@ void ImGui::TableSaveSettings(ImGuiTable* table)
     }
     settings->SaveFlags &= table->Flags;
     settings->RefScale = save_ref_scale ? table->RefScale : 0.0f;
+    settings->WriteCache.Invalidate();
 
     MarkIniSettingsDirty();
 }
@@ -3799,13 +4172,8 @@ static void TableSettingsHandler_ApplyAll(ImGuiContext* ctx, ImGuiSettingsHandle
         }
 }
 
-static void* TableSettingsHandler_ReadOpen(ImGuiContext*, ImGuiSettingsHandler*, const char* name)
+static ImGuiTableSettings* TableSettingsHandler_ReadOpenByID(ImGuiID id, int columns_count)
 {
-    ImGuiID id = 0;
-    int columns_count = 0;
-    if (sscanf(name, "0x%08X,%d", &id, &columns_count) < 2)
-        return NULL;
-
     if (ImGuiTableSettings* settings = ImGui::TableSettingsFindByID(id))
     {
         if (settings->ColumnsCountMax >= columns_count)
@@ -3818,6 +4186,15 @@ static void* TableSettingsHandler_ReadOpen(ImGuiContext*, ImGuiSettingsHandler*,
     return ImGui::TableSettingsCreate(id, columns_count);
 }
 
+static void* TableSettingsHandler_ReadOpen(ImGuiContext*, ImGuiSettingsHandler*, const char* name)
+{
+    ImGuiID id = 0;
+    int columns_count = 0;
+    if (sscanf(name, "0x%08X,%d", &id, &columns_count) < 2)
+        return NULL;
+    return TableSettingsHandler_ReadOpenByID(id, columns_count);
+}
+
 static void TableSettingsHandler_ReadLine(ImGuiContext*, ImGuiSettingsHandler*, void* entry, const char* line)
 {
     // "Column 0  UserID=0x42AD2D21 Width=100 Visible=1 Order=0 Sort=0v"
@@ -3851,6 +4228,9 @@ static void TableSettingsHandler_WriteAll(ImGuiContext* ctx, ImGuiSettingsHandle
     {
         if (settings->ID == 0) // Skip ditched settings
             continue;
+        if (ImGui::SettingsWriteCacheCopy(&settings->WriteCache, buf)) // Unchanged since previous save
+            continue;
+        const int entry_offset = buf->size();
 
         // TableSaveSettings() may clear some of those flags when we establish that the data can be stripped
         // (e.g. Order was unchanged)
@@ -3881,6 +4261,65 @@ static void TableSettingsHandler_WriteAll(ImGuiContext* ctx, ImGuiSettingsHandle
             buf->append("\n");
         }
         buf->append("\n");
+        ImGui::SettingsWriteCacheStore(&settings->WriteCache, buf, entry_offset);
+    }
+}
+
+static void TableSettingsHandler_WriteAllBinary(ImGuiContext* ctx, ImGuiSettingsHandler*, ImGuiTextBuffer* buf)
+{
+    ImGuiContext& g = *ctx;
+    ImGuiSettingsBinaryWriter writer(buf);
+    for (ImGuiTableSettings* settings = g.SettingsTables.begin(); settings != NULL; settings = g.SettingsTables.next_chunk(settings))
+    {
+        if (settings->ID == 0) // Skip ditched settings
+            continue;
+        writer.Write(settings->ID);
+        writer.Write((ImS32)settings->ColumnsCount);
+        writer.Write((ImS32)settings->SaveFlags);
+        writer.Write(settings->RefScale);
+        ImGuiTableColumnSettings* column = settings->GetColumnSettings();
+        for (int column_n = 0; column_n < settings->ColumnsCount; column_n++, column++)
+        {
+            writer.Write(column->WidthOrWeight);
+            writer.Write(column->UserID);
+            writer.Write((ImS16)column->Index);
+            writer.Write((ImS16)column->DisplayOrder);
+            writer.Write((ImS16)column->SortOrder);
+            writer.Write((ImU8)column->SortDirection);
+            writer.Write((ImS8)column->IsEnabled);
+            writer.Write((ImU8)column->IsStretch);
+        }
+    }
+}
+
+static void TableSettingsHandler_ReadAllBinary(ImGuiContext* ctx, ImGuiSettingsHandler*, ImGuiSettingsBinaryReader* reader)
+{
+    // When loading into empty storage (common case) entries are known to be unique: skip the linear search done by TableSettingsFindByID().
+    ImGuiContext& g = *ctx;
+    const bool merge_existing = !g.SettingsTables.empty();
+    while (!reader->IsEnd())
+    {
+        const ImGuiID id = reader->Read<ImGuiID>();
+        const int columns_count = reader->Read<ImS32>();
+        const ImGuiTableFlags save_flags = reader->Read<ImS32>();
+        const float ref_scale = reader->Read<float>();
+        if (reader->Overflow || columns_count < 0 || columns_count > IMGUI_TABLE_MAX_COLUMNS)
+            break;
+        ImGuiTableSettings* settings = merge_existing ? TableSettingsHandler_ReadOpenByID(id, columns_count) : ImGui::TableSettingsCreate(id, columns_count);
+        settings->SaveFlags = save_flags;
+        settings->RefScale = ref_scale;
+        ImGuiTableColumnSettings* column = settings->GetColumnSettings();
+        for (int column_n = 0; column_n < columns_count; column_n++, column++)
+        {
+            column->WidthOrWeight = reader->Read<float>();
+            column->UserID = reader->Read<ImGuiID>();
+            column->Index = (ImGuiTableColumnIdx)reader->Read<ImS16>();
+            column->DisplayOrder = (ImGuiTableColumnIdx)reader->Read<ImS16>();
+            column->SortOrder = (ImGuiTableColumnIdx)reader->Read<ImS16>();
+            column->SortDirection = reader->Read<ImU8>();
+            column->IsEnabled = reader->Read<ImS8>();
+            column->IsStretch = reader->Read<ImU8>();
+        }
     }
 }
 
@@ -3894,6 +4333,8 @@ void ImGui::TableSettingsAddSettingsHandler()
     ini_handler.ReadLineFn = TableSettingsHandler_ReadLine;
     ini_handler.ApplyAllFn = TableSettingsHandler_ApplyAll;
     ini_handler.WriteAllFn = TableSettingsHandler_WriteAll;
+    ini_handler.WriteAllBinaryFn = TableSettingsHandler_WriteAllBinary;
+    ini_handler.ReadAllBinaryFn = TableSettingsHandler_ReadAllBinary;
     AddSettingsHandler(&ini_handler);
 }
 
@@ -3958,6 +4399,247 @@ void ImGui::TableGcCompactSettings()
 }
 
 
+//-------------------------------------------------------------------------
+// [SECTION] Tables: Virtual Grid
+//-------------------------------------------------------------------------
+// - VirtualGridSubmitColumn() [Internal]
+// - VirtualGrid()
+//-------------------------------------------------------------------------
+// VirtualGrid() is a lightweight alternative to BeginTable() for very large grids (e.g. over IMGUI_TABLE_MAX_COLUMNS columns):
+// - Layout is fully determined by RowHeight and column widths: visible rows and columns are computed from the scrolling
+//   offset, and the content size is given to the child window ahead of time. Nothing is done for rows and columns out of sight.
+// - There is no per-column state (other than widths), no draw channels and no settings. Cells are submitted column by column,
+//   each column with its own clipping rectangle, so the number of draw commands is bounded by the number of visible columns.
+//-------------------------------------------------------------------------
+
+// Submit visible cells of a column, setting up cursor and work rectangle for each cell like TableBeginCell() does.
+static void VirtualGridSubmitColumn(ImGuiVirtualGrid* grid, int column_n, float x1, float x2, const ImRect& clip_rect, int row_begin, int row_end, float row_y1, float row_height)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindow* window = g.CurrentWindow;
+    const ImRect column_clip_rect(ImMax(x1, clip_rect.Min.x), clip_rect.Min.y, ImMin(x2, clip_rect.Max.x), clip_rect.Max.y);
+    if (column_clip_rect.Min.x >= column_clip_rect.Max.x || row_begin >= row_end)
+        return;
+
+    const float start_x = x1 + g.Style.CellPadding.x;
+    ImGui::PushClipRect(column_clip_rect.Min, column_clip_rect.Max, false);
+    ImGui::PushID(column_n);
+    window->WorkRect.Min.x = start_x;
+    window->WorkRect.Max.x = x2 - g.Style.CellPadding.x;
+    window->DC.ColumnsOffset.x = start_x - window->Pos.x - window->DC.Indent.x;
+    for (int row_n = row_begin; row_n < row_end; row_n++, row_y1 += row_height)
+    {
+        window->DC.CursorPos = window->DC.CursorPosPrevLine = ImVec2(start_x, row_y1 + g.Style.CellPadding.y);
+        window->DC.CurrLineSize.y = window->DC.PrevLineSize.y = 0.0f;
+        window->DC.CurrLineTextBaseOffset = window->DC.PrevLineTextBaseOffset = 0.0f;
+        window->DC.IsSameLine = false;
+        window->WorkRect.Min.y = window->DC.CursorPos.y;
+        ImGui::PushID(row_n);
+        grid->CellFn(grid->UserData, row_n, column_n);
+        ImGui::PopID();
+    }
+    ImGui::PopID();
+    ImGui::PopClipRect();
+}
+
+void ImGui::VirtualGrid(const char* str_id, ImGuiVirtualGrid* grid, const ImVec2& size_arg)
+{
+    ImGuiContext& g = *GImGui;
+    IM_ASSERT(grid->RowsCount >= 0 && grid->ColumnsCount >= 0 && grid->CellFn != NULL);
+    ImGuiListClipperHeightIndex& widths = grid->ColumnWidths;
+    if (widths.DefaultHeight <= 0.0f)
+        widths.DefaultHeight = g.FontSize * 8.0f;
+    if (widths.Heights.Size != grid->ColumnsCount)
+        widths.Resize(grid->ColumnsCount);
+
+    const ImGuiTableFlags flags = grid->Flags;
+    const int columns_count = grid->ColumnsCount;
+    const int frozen_columns_count = ImClamp(grid->FrozenColumns, 0, columns_count);
+    const float row_height = (grid->RowHeight > 0.0f) ? grid->RowHeight : GetFrameHeight();
+    const float header_height = grid->HeaderFn ? g.FontSize + g.Style.CellPadding.y * 2.0f : 0.0f;
+    const float frozen_width = (float)widths.GetOffset(frozen_columns_count);
+    grid->DisplayRowStart = grid->DisplayRowEnd = grid->DisplayColumnStart = grid->DisplayColumnEnd = 0;
+    grid->HoveredRow = grid->HoveredColumn = -1;
+
+    // Create scrolling region (without border and zero window padding, like scrolling tables)
+    SetNextWindowContentSize(ImVec2((float)widths.GetTotalHeight(), (float)(header_height + (double)grid->RowsCount * row_height)));
+    PushStyleVar(ImGuiStyleVar_WindowPadding, ImVec2(0.0f, 0.0f));
+    const bool is_visible = BeginChild(str_id, size_arg, ImGuiChildFlags_None, ImGuiWindowFlags_HorizontalScrollbar);
+    PopStyleVar();
+    if (!is_visible)
+    {
+        EndChild();
+        return;
+    }
+    ImGuiWindow* window = g.CurrentWindow;
+    ImDrawList* draw_list = window->DrawList;
+    const ImRect inner_rect = window->InnerRect;
+    const ImVec2 scroll = window->Scroll;
+    const float frozen_x2 = ImMin(inner_rect.Min.x + frozen_width, inner_rect.Max.x);
+    const float rows_y1 = ImMin(inner_rect.Min.y + header_height, inner_rect.Max.y);
+    const ImRect backup_work_rect = window->WorkRect;
+    const float backup_columns_offset_x = window->DC.ColumnsOffset.x;
+
+    // Find visible rows and columns
+    int row_begin = 0, row_end = 0;
+    if (grid->RowsCount > 0)
+    {
+        row_begin = ImClamp((int)((double)scroll.y / row_height), 0, grid->RowsCount);
+        row_end = ImClamp((int)ImCeil((float)(((double)scroll.y + (inner_rect.Max.y - rows_y1)) / row_height)), row_begin, grid->RowsCount);
+    }
+    int column_begin = frozen_columns_count, column_end = frozen_columns_count;
+    if (columns_count > frozen_columns_count && frozen_x2 < inner_rect.Max.x)
+    {
+        column_begin = ImMax(widths.FindItem((double)scroll.x + frozen_width), frozen_columns_count);
+        column_end = ImMax(widths.FindItem((double)scroll.x + inner_rect.GetWidth()) + 1, column_begin);
+    }
+    grid->DisplayRowStart = row_begin;
+    grid->DisplayRowEnd = row_end;
+    grid->DisplayColumnStart = column_begin;
+    grid->DisplayColumnEnd = column_end;
+
+    // Positions are computed relative to scrolling in double precision, so they stay exact with large offsets
+    const float row_begin_y1 = inner_rect.Min.y + header_height + (float)((double)row_begin * row_height - scroll.y);
+    const float rows_y2 = ImMin(row_begin_y1 + (row_end - row_begin) * row_height, inner_rect.Max.y);
+    const float unfrozen_x1 = inner_rect.Min.x + (float)(widths.GetOffset(column_begin) - scroll.x);
+
+    // Rows background
+    if ((flags & ImGuiTableFlags_RowBg) && row_begin < row_end)
+    {
+        PushClipRect(ImVec2(inner_rect.Min.x, rows_y1), inner_rect.Max, false);
+        const ImU32 row_bg_col[2] = { GetColorU32(ImGuiCol_TableRowBg), GetColorU32(ImGuiCol_TableRowBgAlt) };
+        float y1 = row_begin_y1;
+        for (int row_n = row_begin; row_n < row_end; row_n++, y1 += row_height)
+            if ((row_bg_col[row_n & 1] & IM_COL32_A_MASK) != 0)
+                draw_list->AddRectFilled(ImVec2(inner_rect.Min.x, y1), ImVec2(inner_rect.Max.x, y1 + row_height), row_bg_col[row_n & 1]);
+        PopClipRect();
+    }
+
+    // Cells
+    {
+        const ImRect unfrozen_clip_rect(frozen_x2, rows_y1, inner_rect.Max.x, inner_rect.Max.y);
+        float x1 = unfrozen_x1;
+        for (int column_n = column_begin; column_n < column_end; column_n++)
+        {
+            const float x2 = x1 + widths.Heights[column_n];
+            VirtualGridSubmitColumn(grid, column_n, x1, x2, unfrozen_clip_rect, row_begin, row_end, row_begin_y1, row_height);
+            x1 = x2;
+        }
+        const ImRect frozen_clip_rect(inner_rect.Min.x, rows_y1, frozen_x2, inner_rect.Max.y);
+        x1 = inner_rect.Min.x;
+        for (int column_n = 0; column_n < frozen_columns_count; column_n++)
+        {
+            const float x2 = x1 + widths.Heights[column_n];
+            VirtualGridSubmitColumn(grid, column_n, x1, x2, frozen_clip_rect, row_begin, row_end, row_begin_y1, row_height);
+            x1 = x2;
+        }
+    }
+    window->WorkRect = backup_work_rect;
+    window->DC.ColumnsOffset.x = backup_columns_offset_x;
+    window->DC.CursorPos = window->DC.CursorPosPrevLine = window->DC.CursorStartPos;
+    window->DC.CurrLineSize.y = window->DC.PrevLineSize.y = 0.0f;
+
+    // Headers, borders and resizing are processed for frozen columns, then for visible columns (which may be partially covered by frozen ones)
+    PushClipRect(inner_rect.Min, inner_rect.Max, false);
+    if (header_height > 0.0f)
+        draw_list->AddRectFilled(inner_rect.Min, ImVec2(inner_rect.Max.x, rows_y1), GetColorU32(ImGuiCol_TableHeaderBg));
+    const ImU32 border_col_strong = GetColorU32(ImGuiCol_TableBorderStrong);
+    const ImU32 border_col_light = GetColorU32(ImGuiCol_TableBorderLight);
+    const float border_size = TABLE_BORDER_SIZE;
+    if ((flags & ImGuiTableFlags_BordersInnerH) && row_begin < row_end)
+    {
+        float y = row_begin_y1 + row_height;
+        for (int row_n = row_begin; row_n < row_end; row_n++, y += row_height)
+            if (y > rows_y1)
+                draw_list->AddLine(ImVec2(inner_rect.Min.x, y - border_size), ImVec2(inner_rect.Max.x, y - border_size), border_col_light, border_size);
+    }
+
+    const bool is_hovered = IsWindowHovered();
+    const float hit_half_width = ImTrunc(TABLE_RESIZE_SEPARATOR_HALF_THICKNESS * g.CurrentDpiScale);
+    const float min_column_width = ImMax(1.0f, g.Style.FramePadding.x * 1.0f);
+    PushID("#Resize");
+    for (int pass_n = 0; pass_n < 2; pass_n++)
+    {
+        const bool is_frozen_pass = (pass_n == 0);
+        const float clip_x1 = is_frozen_pass ? inner_rect.Min.x : frozen_x2;
+        const float clip_x2 = is_frozen_pass ? frozen_x2 : inner_rect.Max.x;
+        if (clip_x1 >= clip_x2)
+            continue;
+        const float pass_x1 = is_frozen_pass ? inner_rect.Min.x : unfrozen_x1;
+        const int pass_column_begin = is_frozen_pass ? 0 : column_begin;
+        const int pass_column_end = is_frozen_pass ? frozen_columns_count : column_end;
+
+        // Header labels
+        float x1 = pass_x1;
+        if (header_height > 0.0f)
+        {
+            PushClipRect(ImVec2(clip_x1, inner_rect.Min.y), ImVec2(clip_x2, rows_y1), true);
+            for (int column_n = pass_column_begin; column_n < pass_column_end; column_n++)
+            {
+                const float x2 = x1 + widths.Heights[column_n];
+                const char* label = grid->HeaderFn(grid->UserData, column_n);
+                const ImVec2 label_pos(x1 + g.Style.CellPadding.x, inner_rect.Min.y + g.Style.CellPadding.y);
+                const float ellipsis_max = ImMax(x2 - g.Style.CellPadding.x, label_pos.x);
+                RenderTextEllipsis(draw_list, label_pos, ImVec2(ellipsis_max, rows_y1), ellipsis_max, ellipsis_max, label, NULL, NULL);
+                x1 = x2;
+            }
+            PopClipRect();
+        }
+
+        x1 = pass_x1;
+        for (int column_n = pass_column_begin; column_n < pass_column_end; column_n++)
+        {
+            const float column_width = widths.Heights[column_n];
+            const float x2 = x1 + column_width;
+
+            // Hovered cell
+            if (is_hovered && g.IO.MousePos.x >= ImMax(x1, clip_x1) && g.IO.MousePos.x < ImMin(x2, clip_x2) && g.IO.MousePos.y >= inner_rect.Min.y && g.IO.MousePos.y < rows_y2)
+            {
+                grid->HoveredColumn = column_n;
+                if (g.IO.MousePos.y >= rows_y1)
+                    grid->HoveredRow = ImMin(row_begin + (int)((g.IO.MousePos.y - row_begin_y1) / row_height), row_end - 1);
+            }
+
+            // Right border, and resizing by dragging it
+            if (x2 >= clip_x1 && x2 <= clip_x2)
+            {
+                ImU32 border_col = (flags & ImGuiTableFlags_BordersInnerV) ? ((column_n + 1 == frozen_columns_count) ? border_col_strong : border_col_light) : 0;
+                if (flags & ImGuiTableFlags_Resizable)
+                {
+                    const ImGuiID resize_id = window->GetID(column_n);
+                    const ImRect hit_rect(x2 - hit_half_width, inner_rect.Min.y, x2 + hit_half_width, rows_y2);
+                    ItemAdd(hit_rect, resize_id, NULL, ImGuiItemFlags_NoNav);
+                    bool hovered = false, held = false;
+                    ButtonBehavior(hit_rect, resize_id, &hovered, &held, ImGuiButtonFlags_FlattenChildren | ImGuiButtonFlags_PressedOnClick);
+                    if (held)
+                        widths.SetHeight(column_n, ImMax(g.IO.MousePos.x - g.ActiveIdClickOffset.x + hit_half_width - x1, min_column_width));
+                    if ((hovered && g.HoveredIdTimer > TABLE_RESIZE_SEPARATOR_FEEDBACK_TIMER) || held)
+                    {
+                        SetMouseCursor(ImGuiMouseCursor_ResizeEW);
+                        border_col = GetColorU32(held ? ImGuiCol_SeparatorActive : ImGuiCol_SeparatorHovered);
+                    }
+                }
+                if (border_col != 0)
+                    draw_list->AddLine(ImVec2(x2 - border_size, inner_rect.Min.y), ImVec2(x2 - border_size, rows_y2), border_col, border_size);
+            }
+            x1 = x2;
+        }
+    }
+    PopID();
+    if (header_height > 0.0f)
+        draw_list->AddLine(ImVec2(inner_rect.Min.x, rows_y1 - border_size), ImVec2(inner_rect.Max.x, rows_y1 - border_size), border_col_strong, border_size);
+    PopClipRect();
+
+    // Outer border
+    if (flags & ImGuiTableFlags_BordersOuter)
+    {
+        PushClipRect(window->Rect().Min, window->Rect().Max, false);
+        draw_list->AddRect(window->Rect().Min, window->Rect().Max, border_col_strong, 0.0f, 0, border_size);
+        PopClipRect();
+    }
+    EndChild();
+}
+
 //-------------------------------------------------------------------------
 // [SECTION] Tables: Debugging
 //-------------------------------------------------------------------------
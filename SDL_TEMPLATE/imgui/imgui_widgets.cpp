@@ -155,6 +155,7 @@ static ImVec2   InputTextCalcTextSize(ImGuiContext* ctx, const char* text_begin,
 // - LabelTextV()
 // - BulletText()
 // - BulletTextV()
+// - TextFileView()
 //-------------------------------------------------------------------------
 
 void ImGui::TextEx(const char* text, const char* text_end, ImGuiTextFlags flags)
@@ -411,6 +412,193 @@ void ImGui::BulletTextV(const char* fmt, va_list args)
     RenderText(bb.Min + ImVec2(g.FontSize + style.FramePadding.x * 2, 0.0f), text_begin, text_end, false);
 }
 
+// Lines longer than this are measured up to this many bytes, and their width is extrapolated.
+#define IMGUI_TEXT_FILE_VIEW_MEASURE_MAX    4096
+
+// Start of the UTF-8 character ending at 'p'
+static const char* TextFileViewPrevChar(const char* line_start, const char* p)
+{
+    const char* c = p - 1;
+    while (c > line_start && (*c & 0xC0) == 0x80 && p - c < 4) // Skip UTF-8 continuation bytes
+        c--;
+    return c;
+}
+
+// Scaled kerning between the characters before and at 'p': CalcTextSizeA() on a range starting at 'p' doesn't include it.
+static float TextFileViewCalcKerningAt(ImFont* font, float font_size, const char* line_start, const char* line_stop, const char* p)
+{
+    if (font->KerningPairs.Size == 0 || p <= line_start || p >= line_stop)
+        return 0.0f;
+    unsigned int c_prev, c;
+    ImTextCharFromUtf8(&c_prev, TextFileViewPrevChar(line_start, p), p);
+    ImTextCharFromUtf8(&c, p, line_stop);
+    if (c_prev > IM_UNICODE_CODEPOINT_MAX || c > IM_UNICODE_CODEPOINT_MAX)
+        return 0.0f;
+    return font->GetCharKerning((ImWchar)c_prev, (ImWchar)c) * (font_size / font->FontSize);
+}
+
+// - Vertical scrolling is done in lines with our own scrollbar: pixel positions in a file of millions of lines can't be represented as float.
+// - Horizontal scrolling uses the window scrollbar. Lines are measured when they become visible, and the content width only grows.
+// - For each visible line, we cache the position of the first visible character, so scrolling far into long lines only measures
+//   the characters between the previous and new scrolling positions.
+void ImGui::TextFileView(const char* str_id, ImGuiTextFileView* view, const ImVec2& size_arg)
+{
+    ImGuiContext& g = *GImGui;
+    view->Update();
+    view->HoveredLine = -1;
+    ImFont* font = g.Font;
+    const float font_size = g.FontSize;
+    const ImVec2 padding = g.Style.FramePadding;
+    const float scrollbar_size = g.Style.ScrollbarSize;
+    if (view->MaxLineWidthFontSize != font_size)
+    {
+        view->MaxLineWidth = 0.0f;
+        view->MaxLineWidthFontSize = font_size;
+        view->VisibleLines.resize(0);
+    }
+
+    SetNextWindowContentSize(ImVec2(view->MaxLineWidth + padding.x * 2.0f + scrollbar_size, 0.0f));
+    PushStyleVar(ImGuiStyleVar_WindowPadding, ImVec2(0.0f, 0.0f));
+    const bool is_visible = BeginChild(str_id, size_arg, ImGuiChildFlags_Borders, ImGuiWindowFlags_HorizontalScrollbar);
+    PopStyleVar();
+    if (!is_visible)
+    {
+        EndChild();
+        return;
+    }
+    ImGuiWindow* window = g.CurrentWindow;
+    const ImRect inner_rect = window->InnerRect;
+    const ImRect text_rect(inner_rect.Min, ImVec2(ImMax(inner_rect.Min.x, inner_rect.Max.x - scrollbar_size), inner_rect.Max.y));
+    const int visible_lines_count = ImMax((int)((text_rect.GetHeight() - padding.y * 2.0f) / font_size), 1);
+    const ImS64 lines_count = view->LinesCount;
+
+    // Vertical scrolling with mouse wheel and keyboard
+    const ImGuiID scroll_id = window->GetID("#SCROLLY");
+    const ImS64 scroll_max = ImMax(lines_count - visible_lines_count, (ImS64)0);
+    if (IsWindowHovered() && !g.IO.KeyShift && scroll_max > 0)
+    {
+        if (TestKeyOwner(ImGuiKey_MouseWheelY, scroll_id) && g.IO.MouseWheel != 0.0f)
+        {
+            view->ScrollLineRemainder -= g.IO.MouseWheel * 3.0f;
+            const float lines = ImTrunc(view->ScrollLineRemainder);
+            view->ScrollLine += (ImS64)lines;
+            view->ScrollLineRemainder -= lines;
+        }
+        SetKeyOwner(ImGuiKey_MouseWheelY, scroll_id);
+    }
+    if (IsWindowFocused())
+    {
+        if (IsKeyPressed(ImGuiKey_UpArrow))
+            view->ScrollLine--;
+        if (IsKeyPressed(ImGuiKey_DownArrow))
+            view->ScrollLine++;
+        if (IsKeyPressed(ImGuiKey_PageUp))
+            view->ScrollLine -= visible_lines_count;
+        if (IsKeyPressed(ImGuiKey_PageDown))
+            view->ScrollLine += visible_lines_count;
+        if (IsKeyPressed(ImGuiKey_Home))
+            view->ScrollLine = 0;
+        if (IsKeyPressed(ImGuiKey_End))
+            view->ScrollLine = scroll_max;
+    }
+    view->ScrollLine = ImClamp(view->ScrollLine, (ImS64)0, scroll_max);
+    ScrollbarEx(ImRect(text_rect.Max.x, inner_rect.Min.y, inner_rect.Max.x, inner_rect.Max.y), scroll_id, ImGuiAxis_Y, &view->ScrollLine, visible_lines_count, lines_count, ImDrawFlags_RoundCornersNone);
+
+    // Visible lines
+    const ImS64 line_begin = view->ScrollLine;
+    const ImS64 line_end = ImMin(line_begin + visible_lines_count + 1, lines_count);
+    const float scroll_x = window->Scroll.x;
+    const float text_x = text_rect.Min.x + padding.x - scroll_x;
+    const float text_y = text_rect.Min.y + padding.y;
+    const ImVector<ImGuiTextFileViewLine>& prev_lines = view->VisibleLines;
+    const ImS64 prev_line_begin = prev_lines.Size > 0 ? prev_lines[0].LineN : 0;
+    ImVector<ImGuiTextFileViewLine>& lines = view->TempLines;
+    lines.resize(0);
+    ImDrawList* draw_list = window->DrawList;
+    const ImU32 text_col = GetColorU32(ImGuiCol_Text);
+    PushClipRect(text_rect.Min, text_rect.Max, true);
+    float y = text_y;
+    for (ImS64 line_n = line_begin; line_n < line_end; line_n++, y += font_size)
+    {
+        const char* line_start = view->GetLineBegin(line_n);
+        const char* line_stop = view->GetLineEnd(line_n);
+        if (line_stop > line_start && line_stop[-1] == '\r')
+            line_stop--;
+
+        // Reuse state of lines visible last frame, measure new lines
+        ImGuiTextFileViewLine line;
+        if (line_n >= prev_line_begin && line_n < prev_line_begin + prev_lines.Size)
+        {
+            line = prev_lines[(int)(line_n - prev_line_begin)];
+        }
+        else
+        {
+            const ImS64 line_size = (ImS64)(line_stop - line_start);
+            const ImS64 measure_size = ImMin(line_size, (ImS64)IMGUI_TEXT_FILE_VIEW_MEASURE_MAX);
+            line.LineN = line_n;
+            line.VisibleOffset = 0;
+            line.VisibleX = 0.0f;
+            line.Width = font->CalcTextSizeA(font_size, FLT_MAX, 0.0f, line_start, line_start + measure_size).x;
+            if (measure_size < line_size)
+                line.Width = (float)((double)line.Width * line_size / measure_size);
+        }
+        view->MaxLineWidth = ImMax(view->MaxLineWidth, line.Width);
+
+        // Skip characters left of visible area, from the cached position. When scrolling left, step back from it
+        // one character at a time (so the cost is proportional to the scrolled distance), or restart from the line start if closer.
+        // VisibleX is where the character at VisibleOffset is drawn, so it includes the kerning with the previous character
+        // (which may push it past scroll_x after stepping forward: stepping back afterward fixes that within the same frame).
+        if (line.VisibleX > scroll_x && line.VisibleX - scroll_x >= scroll_x)
+        {
+            line.VisibleOffset = 0;
+            line.VisibleX = 0.0f;
+        }
+        if (line.VisibleX < scroll_x && line_start + line.VisibleOffset < line_stop)
+        {
+            const char* s_prev = line_start + line.VisibleOffset;
+            const char* s_visible = s_prev;
+            const float w = font->CalcTextSizeA(font_size, scroll_x - line.VisibleX, 0.0f, s_prev, line_stop, &s_visible).x;
+            if (s_visible > s_prev)
+            {
+                line.VisibleX += w + TextFileViewCalcKerningAt(font, font_size, line_start, line_stop, s_visible);
+                line.VisibleOffset = (ImU64)(s_visible - line_start);
+            }
+        }
+        while (line.VisibleX > scroll_x && line.VisibleOffset > 0)
+        {
+            const char* c_end = line_start + line.VisibleOffset;
+            const char* c = TextFileViewPrevChar(line_start, c_end);
+            line.VisibleX -= font->CalcTextSizeA(font_size, FLT_MAX, 0.0f, c, c_end).x + TextFileViewCalcKerningAt(font, font_size, line_start, line_stop, c_end);
+            line.VisibleOffset = (ImU64)(c - line_start);
+        }
+        if (line.VisibleOffset == 0)
+            line.VisibleX = 0.0f;
+        const char* s = line_start + line.VisibleOffset;
+        lines.push_back(line);
+
+        // Render visible characters, including the last partially visible one
+        if (s < line_stop)
+        {
+            const float x = text_x + line.VisibleX;
+            const char* s_end = line_stop;
+            font->CalcTextSizeA(font_size, text_rect.Max.x - x, 0.0f, s, line_stop, &s_end);
+            if (s_end < line_stop)
+                s_end += ImTextCountUtf8BytesFromChar(s_end, line_stop);
+            draw_list->AddText(font, font_size, ImVec2(x, y), text_col, s, s_end);
+        }
+    }
+    PopClipRect();
+    view->VisibleLines.swap(view->TempLines);
+
+    if (IsWindowHovered() && text_rect.Contains(g.IO.MousePos) && g.IO.MousePos.y >= text_y)
+    {
+        const ImS64 hovered_line = line_begin + (ImS64)((g.IO.MousePos.y - text_y) / font_size);
+        if (hovered_line < line_end)
+            view->HoveredLine = hovered_line;
+    }
+    EndChild();
+}
+
 //-------------------------------------------------------------------------
 // [SECTION] Widgets: Main
 //-------------------------------------------------------------------------
@@ -3927,6 +4115,8 @@ static ImVec2 InputTextCalcTextSize(ImGuiContext* ctx, const char* text_begin, c
 
     ImVec2 text_size = ImVec2(0, 0);
     float line_width = 0.0f;
+    const bool use_kerning = font->KerningPairs.Size > 0;
+    unsigned int c_prev = 0;
 
     const char* s = text_begin;
     while (s < text_end)
@@ -3942,6 +4132,7 @@ static ImVec2 InputTextCalcTextSize(ImGuiContext* ctx, const char* text_begin, c
             text_size.x = ImMax(text_size.x, line_width);
             text_size.y += line_height;
             line_width = 0.0f;
+            c_prev = 0;
             if (stop_on_new_line)
                 break;
             continue;
@@ -3949,8 +4140,13 @@ static ImVec2 InputTextCalcTextSize(ImGuiContext* ctx, const char* text_begin, c
         if (c == '\r')
             continue;
 
-        const float char_width = ((int)c < font->IndexAdvanceX.Size ? font->IndexAdvanceX.Data[c] : font->FallbackAdvanceX) * scale;
-        line_width += char_width;
+        float char_width = ((int)c < font->IndexAdvanceX.Size ? font->IndexAdvanceX.Data[c] : font->FallbackAdvanceX);
+        if (use_kerning)
+        {
+            char_width += font->GetCharKerning((ImWchar)c_prev, (ImWchar)c);
+            c_prev = c;
+        }
+        line_width += char_width * scale;
     }
 
     if (text_size.x < line_width)
@@ -3968,6 +4164,76 @@ static ImVec2 InputTextCalcTextSize(ImGuiContext* ctx, const char* text_begin, c
     return text_size;
 }
 
+// Line index of the active text: state->LineOffsets[n] is the offset of the beginning of line n.
+// It is rebuilt on demand after being invalidated (empty vector) and otherwise patched by every insertion/deletion,
+// so a multi-line InputText() doesn't need to scan its whole buffer every frame to locate the cursor or the visible lines.
+static void InputTextLineIndexUpdate(ImGuiInputTextState* state)
+{
+    ImVector<int>& offsets = state->LineOffsets;
+    if (offsets.Size > 0)
+        return;
+    const char* text = state->TextSrc;
+    const char* text_end = text + state->TextLen;
+    offsets.push_back(0);
+    for (const char* s = text; (s = (const char*)ImMemchr(s, '\n', (size_t)(text_end - s))) != NULL; s++)
+        offsets.push_back((int)(s + 1 - text));
+}
+
+// Return index of the line containing 'offset' (a '\n' belongs to the line it terminates)
+static int InputTextLineIndexFindLine(const ImGuiInputTextState* state, int offset)
+{
+    const ImVector<int>& offsets = state->LineOffsets;
+    IM_ASSERT(offsets.Size > 0);
+    int lo = 0, hi = offsets.Size - 1;
+    while (lo < hi)
+    {
+        const int mid = (lo + hi + 1) >> 1;
+        if (offsets.Data[mid] <= offset)
+            lo = mid;
+        else
+            hi = mid - 1;
+    }
+    return lo;
+}
+
+static void InputTextLineIndexOnDeleteChars(ImGuiInputTextState* state, int pos, int n)
+{
+    ImVector<int>& offsets = state->LineOffsets;
+    if (offsets.Size == 0 || n <= 0)
+        return;
+    const int line_first = InputTextLineIndexFindLine(state, pos) + 1;
+    int line_last = line_first;
+    while (line_last < offsets.Size && offsets.Data[line_last] <= pos + n) // Lines whose preceding '\n' is deleted
+        line_last++;
+    if (line_last > line_first)
+        offsets.erase(offsets.Data + line_first, offsets.Data + line_last);
+    for (int line_n = line_first; line_n < offsets.Size; line_n++)
+        offsets.Data[line_n] -= n;
+}
+
+static void InputTextLineIndexOnInsertChars(ImGuiInputTextState* state, int pos, const char* new_text, int new_text_len)
+{
+    ImVector<int>& offsets = state->LineOffsets;
+    if (offsets.Size == 0 || new_text_len <= 0)
+        return;
+    const int line_first = InputTextLineIndexFindLine(state, pos) + 1;
+    for (int line_n = line_first; line_n < offsets.Size; line_n++)
+        offsets.Data[line_n] += new_text_len;
+
+    const char* new_text_end = new_text + new_text_len;
+    int new_lines_count = 0;
+    for (const char* s = new_text; (s = (const char*)ImMemchr(s, '\n', (size_t)(new_text_end - s))) != NULL; s++)
+        new_lines_count++;
+    if (new_lines_count == 0)
+        return;
+    const int old_size = offsets.Size;
+    offsets.resize(old_size + new_lines_count);
+    memmove(offsets.Data + line_first + new_lines_count, offsets.Data + line_first, (size_t)(old_size - line_first) * sizeof(int));
+    int* p_out = offsets.Data + line_first;
+    for (const char* s = new_text; (s = (const char*)ImMemchr(s, '\n', (size_t)(new_text_end - s))) != NULL; s++)
+        *p_out++ = pos + (int)(s + 1 - new_text);
+}
+
 // Wrapper for stb_textedit.h to edit text (our wrapper is for: statically sized buffer, single-line, wchar characters. InputText converts between UTF-8 and wchar)
 // With our UTF-8 use of stb_textedit:
 // - STB_TEXTEDIT_GETCHAR is nothing more than a a "GETBYTE". It's only used to compare to ascii or to copy blocks of text so we are fine.
@@ -3977,7 +4243,24 @@ namespace ImStb
 {
 static int     STB_TEXTEDIT_STRINGLEN(const ImGuiInputTextState* obj)                             { return obj->TextLen; }
 static char    STB_TEXTEDIT_GETCHAR(const ImGuiInputTextState* obj, int idx)                      { IM_ASSERT(idx <= obj->TextLen); return obj->TextSrc[idx]; }
-static float   STB_TEXTEDIT_GETWIDTH(ImGuiInputTextState* obj, int line_start_idx, int char_idx)  { unsigned int c; ImTextCharFromUtf8(&c, obj->TextSrc + line_start_idx + char_idx, obj->TextSrc + obj->TextLen); if ((ImWchar)c == '\n') return IMSTB_TEXTEDIT_GETWIDTH_NEWLINE; ImGuiContext& g = *obj->Ctx; return g.Font->GetCharAdvance((ImWchar)c) * g.FontScale; }
+static float   STB_TEXTEDIT_GETWIDTH(ImGuiInputTextState* obj, int line_start_idx, int char_idx)
+{
+    const char* text_line = obj->TextSrc + line_start_idx;
+    const char* text_char = text_line + char_idx;
+    unsigned int c;
+    ImTextCharFromUtf8(&c, text_char, obj->TextSrc + obj->TextLen);
+    if ((ImWchar)c == '\n')
+        return IMSTB_TEXTEDIT_GETWIDTH_NEWLINE;
+    ImGuiContext& g = *obj->Ctx;
+    float char_width = g.Font->GetCharAdvance((ImWchar)c);
+    if (g.Font->KerningPairs.Size > 0 && char_idx > 0) // Match InputTextCalcTextSize(), which accounts kerning into the width of the second character
+    {
+        unsigned int c_prev;
+        ImTextCharFromUtf8(&c_prev, ImTextFindPreviousUtf8Codepoint(text_line, text_char), text_char);
+        char_width += g.Font->GetCharKerning((ImWchar)c_prev, (ImWchar)c);
+    }
+    return char_width * g.FontScale;
+}
 static char    STB_TEXTEDIT_NEWLINE = '\n';
 static void    STB_TEXTEDIT_LAYOUTROW(StbTexteditRow* r, ImGuiInputTextState* obj, int line_start_idx)
 {
@@ -3992,6 +4275,28 @@ static void    STB_TEXTEDIT_LAYOUTROW(StbTexteditRow* r, ImGuiInputTextState* ob
     r->num_chars = (int)(text_remaining - (text + line_start_idx));
 }
 
+// Our rows are lines of identical height, so use the line index to skip laying out every row above the one we are looking for.
+// - SEEKROW_CHAR returns the row preceding the one containing 'n', letting stb_textedit_find_charpos() handle the last row as usual.
+// - SEEKROW_Y returns the row straddling 'y'.
+static void IMSTB_TEXTEDIT_SEEKROW_CHAR_IMPL(ImGuiInputTextState* obj, int n, int* out_row_start, int* out_prev_row_start, float* out_row_y)
+{
+    InputTextLineIndexUpdate(obj);
+    const int line_n = ImMax(InputTextLineIndexFindLine(obj, n) - 1, 0);
+    *out_row_start = obj->LineOffsets[line_n];
+    *out_prev_row_start = obj->LineOffsets[ImMax(line_n - 1, 0)];
+    *out_row_y = line_n * obj->Ctx->FontSize;
+}
+static void IMSTB_TEXTEDIT_SEEKROW_Y_IMPL(ImGuiInputTextState* obj, float y, int* out_row_start, float* out_row_y)
+{
+    InputTextLineIndexUpdate(obj);
+    const float line_height = obj->Ctx->FontSize;
+    const int line_n = (y > 0.0f) ? ImMin((int)ImMin(y / line_height, (float)obj->LineOffsets.Size), obj->LineOffsets.Size - 1) : 0;
+    *out_row_start = obj->LineOffsets[line_n];
+    *out_row_y = line_n * line_height;
+}
+#define IMSTB_TEXTEDIT_SEEKROW_CHAR     IMSTB_TEXTEDIT_SEEKROW_CHAR_IMPL
+#define IMSTB_TEXTEDIT_SEEKROW_Y        IMSTB_TEXTEDIT_SEEKROW_Y_IMPL
+
 #define IMSTB_TEXTEDIT_GETNEXTCHARINDEX  IMSTB_TEXTEDIT_GETNEXTCHARINDEX_IMPL
 #define IMSTB_TEXTEDIT_GETPREVCHARINDEX  IMSTB_TEXTEDIT_GETPREVCHARINDEX_IMPL
 
@@ -4094,6 +4399,7 @@ static void STB_TEXTEDIT_DELETECHARS(ImGuiInputTextState* obj, int pos, int n)
     memmove(dst, src, obj->TextLen - n - pos + 1);
     obj->Edited = true;
     obj->TextLen -= n;
+    InputTextLineIndexOnDeleteChars(obj, pos, n);
 }
 
 static bool STB_TEXTEDIT_INSERTCHARS(ImGuiInputTextState* obj, int pos, const char* new_text, int new_text_len)
@@ -4123,6 +4429,7 @@ static bool STB_TEXTEDIT_INSERTCHARS(ImGuiInputTextState* obj, int pos, const ch
     obj->Edited = true;
     obj->TextLen += new_text_len;
     obj->TextA[obj->TextLen] = '\0';
+    InputTextLineIndexOnInsertChars(obj, pos, new_text, new_text_len);
 
     return true;
 }
@@ -4582,6 +4889,7 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         state->TextA.resize(buf_size + 1); // we use +1 to make sure that .Data is always pointing to at least an empty string.
         state->TextLen = new_len;
         memcpy(state->TextA.Data, buf, state->TextLen + 1);
+        state->LineOffsets.resize(0);
         state->Stb->select_start = state->ReloadSelectionStart;
         state->Stb->cursor = state->Stb->select_end = state->ReloadSelectionEnd;
         state->CursorClamp();
@@ -4611,6 +4919,7 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         // Start edition
         state->ID = id;
         state->TextLen = buf_len;
+        state->LineOffsets.resize(0);
         if (!is_readonly)
         {
             state->TextA.resize(buf_size + 1); // we use +1 to make sure that .Data is always pointing to at least an empty string.
@@ -4680,9 +4989,12 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         if (is_multiline && state != NULL)
             state->Scroll.y = draw_window->Scroll.y;
 
-        // Read-only mode always ever read from source buffer. Refresh TextLen when active.
+        // Read-only mode always ever read from source buffer. Refresh TextLen and invalidate line index when active.
         if (is_readonly && state != NULL)
+        {
             state->TextLen = (int)ImStrlen(buf);
+            state->LineOffsets.resize(0);
+        }
         //if (is_readonly && state != NULL)
         //    state->TextA.clear(); // Uncomment to facilitate debugging, but we otherwise prefer to keep/amortize th allocation.
     }
@@ -5106,6 +5418,7 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
                         IM_ASSERT(callback_data.BufTextLen == (int)ImStrlen(callback_data.Buf)); // You need to maintain BufTextLen if you change the text!
                         InputTextReconcileUndoState(state, state->CallbackTextBackup.Data, state->CallbackTextBackup.Size - 1, callback_data.Buf, callback_data.BufTextLen);
                         state->TextLen = callback_data.BufTextLen;  // Assume correct length and valid UTF-8 from user, saves us an extra strlen()
+                        state->LineOffsets.resize(0);
                         state->CursorAnimReset();
                     }
                 }
@@ -5218,10 +5531,9 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         // - Display the text (this alone can be more easily clipped)
         // - Handle scrolling, highlight selection, display cursor (those all requires some form of 1d->2d cursor position calculation)
         // - Measure text height (for scrollbar)
-        // We are attempting to do most of that in **one main pass** to minimize the computation cost (non-negligible for large amount of text) + 2nd pass for selection rendering (we could merge them by an extra refactoring effort)
+        // Lines are located with the line index maintained by edits (state->LineOffsets), so the cost doesn't depend on the amount of text outside the visible area.
         // FIXME: This should occur on buf_display but we'd need to maintain cursor/select_start/select_end for UTF-8.
         const char* text_begin = buf_display;
-        const char* text_end = text_begin + state->TextLen;
         ImVec2 cursor_offset, select_start_offset;
 
         {
@@ -5231,16 +5543,14 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
             const char* cursor_ptr = render_cursor ? text_begin + state->Stb->cursor : NULL;
             const char* selmin_ptr = render_selection ? text_begin + ImMin(state->Stb->select_start, state->Stb->select_end) : NULL;
 
-            // Count lines and find line number for cursor and selection ends
+            // Count lines and find line number for cursor and selection ends (using line index maintained across frames)
             int line_count = 1;
             if (is_multiline)
             {
-                for (const char* s = text_begin; (s = (const char*)ImMemchr(s, '\n', (size_t)(text_end - s))) != NULL; s++)
-                {
-                    if (cursor_line_no == -1 && s >= cursor_ptr) { cursor_line_no = line_count; }
-                    if (selmin_line_no == -1 && s >= selmin_ptr) { selmin_line_no = line_count; }
-                    line_count++;
-                }
+                InputTextLineIndexUpdate(state);
+                line_count = state->LineOffsets.Size;
+                if (cursor_line_no == -1) { cursor_line_no = InputTextLineIndexFindLine(state, (int)(cursor_ptr - text_begin)) + 1; }
+                if (selmin_line_no == -1) { selmin_line_no = InputTextLineIndexFindLine(state, (int)(selmin_ptr - text_begin)) + 1; }
             }
             if (cursor_line_no == -1)
                 cursor_line_no = line_count;
@@ -5296,6 +5606,18 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
             state->CursorFollow = false;
         }
 
+        // Find range of lines overlapping the visible area, so rendering doesn't need to step through all lines above it
+        int line_visible_min = 0;
+        int line_visible_max = 1;
+        if (is_multiline)
+        {
+            const float lines_y = IM_TRUNC(draw_pos.y); // Same as ImFont::RenderText()
+            const float visible_y1 = ImMin(clip_rect.y, draw_window->ClipRect.Min.y);
+            const float visible_y2 = draw_window->ClipRect.Max.y;
+            line_visible_min = ImClamp((int)ImMax((visible_y1 - lines_y) / g.FontSize - 1.0f, 0.0f), 0, state->LineOffsets.Size - 1);
+            line_visible_max = ImClamp((int)ImCeil(ImMax((visible_y2 - lines_y) / g.FontSize, 0.0f)), line_visible_min + 1, state->LineOffsets.Size);
+        }
+
         // Draw selection
         const ImVec2 draw_scroll = ImVec2(state->Scroll.x, 0.0f);
         if (render_selection)
@@ -5307,7 +5629,13 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
             float bg_offy_up = is_multiline ? 0.0f : -1.0f;    // FIXME: those offsets should be part of the style? they don't play so well with multi-line selection.
             float bg_offy_dn = is_multiline ? 0.0f : 2.0f;
             ImVec2 rect_pos = draw_pos + select_start_offset - draw_scroll;
-            for (const char* p = text_selected_begin; p < text_selected_end; )
+            const char* p = text_selected_begin;
+            if (is_multiline && text_begin + state->LineOffsets[line_visible_min] > text_selected_begin)
+            {
+                p = text_begin + state->LineOffsets[line_visible_min];
+                rect_pos = ImVec2(draw_pos.x - draw_scroll.x, draw_pos.y + (line_visible_min + 1) * g.FontSize);
+            }
+            while (p < text_selected_end)
             {
                 if (rect_pos.y > clip_rect.w + g.FontSize)
                     break;
@@ -5315,6 +5643,7 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
                 {
                     p = (const char*)ImMemchr((void*)p, '\n', text_selected_end - p);
                     p = p ? p + 1 : text_selected_end;
+                    rect_pos.x = draw_pos.x - draw_scroll.x;
                 }
                 else
                 {
@@ -5331,11 +5660,21 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         }
 
         // We test for 'buf_display_max_length' as a way to avoid some pathological cases (e.g. single-line 1 MB string) which would make ImDrawList crash.
-        // FIXME-OPT: Multiline could submit a smaller amount of contents to AddText() since we already iterated through it.
+        // Multiline only submits visible lines to AddText().
         if (is_multiline || (buf_display_end - buf_display) < buf_display_max_length)
         {
             ImU32 col = GetColorU32(is_displaying_hint ? ImGuiCol_TextDisabled : ImGuiCol_Text);
-            draw_window->DrawList->AddText(g.Font, g.FontSize, draw_pos - draw_scroll, col, buf_display, buf_display_end, 0.0f, is_multiline ? NULL : &clip_rect);
+            const char* buf_display_visible_begin = buf_display;
+            const char* buf_display_visible_end = buf_display_end;
+            ImVec2 draw_text_pos = draw_pos - draw_scroll;
+            if (is_multiline && !is_displaying_hint)
+            {
+                buf_display_visible_begin = buf_display + state->LineOffsets[line_visible_min];
+                if (line_visible_max < state->LineOffsets.Size)
+                    buf_display_visible_end = buf_display + state->LineOffsets[line_visible_max];
+                draw_text_pos.y = IM_TRUNC(draw_text_pos.y) + line_visible_min * g.FontSize;
+            }
+            draw_window->DrawList->AddText(g.Font, g.FontSize, draw_text_pos, col, buf_display_visible_begin, buf_display_visible_end, 0.0f, is_multiline ? NULL : &clip_rect);
         }
 
         // Draw blinking cursor
@@ -8412,6 +8751,7 @@ bool ImGui::ListBox(const char* label, int* current_item, const char* (*getter)(
 // - PlotEx() [Internal]
 // - PlotLines()
 // - PlotHistogram()
+// - ImGuiPlotBuffer
 //-------------------------------------------------------------------------
 // Plot/Graph widgets are not very good.
 // Consider writing your own, or using a third-party one, see:
@@ -8419,27 +8759,65 @@ bool ImGui::ListBox(const char* label, int* current_item, const char* (*getter)(
 // - others https://github.com/ocornut/imgui/wiki/Useful-Extensions
 //-------------------------------------------------------------------------
 
-int ImGui::PlotEx(ImGuiPlotType plot_type, const char* label, float (*values_getter)(void* data, int idx), void* data, int values_count, int values_offset, const char* overlay_text, float scale_min, float scale_max, const ImVec2& size_arg)
+// Item layout shared by both PlotEx() overloads
+struct ImGuiPlotItem
+{
+    ImVec2  LabelSize;
+    ImVec2  FrameSize;
+    ImRect  FrameBb;
+    ImRect  InnerBb;
+    bool    Hovered;
+};
+
+// Submit the item and render its frame. Return false if the item is clipped.
+static bool Plot_BeginItem(const char* label, const ImVec2& size_arg, ImGuiPlotItem* item)
 {
     ImGuiContext& g = *GImGui;
-    ImGuiWindow* window = GetCurrentWindow();
+    ImGuiWindow* window = ImGui::GetCurrentWindow();
     if (window->SkipItems)
-        return -1;
+        return false;
 
     const ImGuiStyle& style = g.Style;
     const ImGuiID id = window->GetID(label);
 
-    const ImVec2 label_size = CalcTextSize(label, NULL, true);
-    const ImVec2 frame_size = CalcItemSize(size_arg, CalcItemWidth(), label_size.y + style.FramePadding.y * 2.0f);
+    item->LabelSize = ImGui::CalcTextSize(label, NULL, true);
+    item->FrameSize = ImGui::CalcItemSize(size_arg, ImGui::CalcItemWidth(), item->LabelSize.y + style.FramePadding.y * 2.0f);
 
-    const ImRect frame_bb(window->DC.CursorPos, window->DC.CursorPos + frame_size);
-    const ImRect inner_bb(frame_bb.Min + style.FramePadding, frame_bb.Max - style.FramePadding);
-    const ImRect total_bb(frame_bb.Min, frame_bb.Max + ImVec2(label_size.x > 0.0f ? style.ItemInnerSpacing.x + label_size.x : 0.0f, 0));
-    ItemSize(total_bb, style.FramePadding.y);
-    if (!ItemAdd(total_bb, id, &frame_bb, ImGuiItemFlags_NoNav))
+    const ImRect frame_bb(window->DC.CursorPos, window->DC.CursorPos + item->FrameSize);
+    const ImRect total_bb(frame_bb.Min, frame_bb.Max + ImVec2(item->LabelSize.x > 0.0f ? style.ItemInnerSpacing.x + item->LabelSize.x : 0.0f, 0));
+    item->FrameBb = frame_bb;
+    item->InnerBb = ImRect(frame_bb.Min + style.FramePadding, frame_bb.Max - style.FramePadding);
+    ImGui::ItemSize(total_bb, style.FramePadding.y);
+    if (!ImGui::ItemAdd(total_bb, id, &frame_bb, ImGuiItemFlags_NoNav))
+        return false;
+    ImGui::ButtonBehavior(frame_bb, id, &item->Hovered, NULL);
+
+    ImGui::RenderFrame(frame_bb.Min, frame_bb.Max, ImGui::GetColorU32(ImGuiCol_FrameBg), true, style.FrameRounding);
+    return true;
+}
+
+// Render text overlay and label
+static void Plot_EndItem(const char* label, const char* overlay_text, const ImGuiPlotItem& item)
+{
+    ImGuiContext& g = *GImGui;
+    const ImGuiStyle& style = g.Style;
+    if (overlay_text)
+        ImGui::RenderTextClipped(ImVec2(item.FrameBb.Min.x, item.FrameBb.Min.y + style.FramePadding.y), item.FrameBb.Max, overlay_text, NULL, NULL, ImVec2(0.5f, 0.0f));
+
+    if (item.LabelSize.x > 0.0f)
+        ImGui::RenderText(ImVec2(item.FrameBb.Max.x + style.ItemInnerSpacing.x, item.InnerBb.Min.y), label);
+}
+
+int ImGui::PlotEx(ImGuiPlotType plot_type, const char* label, float (*values_getter)(void* data, int idx), void* data, int values_count, int values_offset, const char* overlay_text, float scale_min, float scale_max, const ImVec2& size_arg)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindow* window = GetCurrentWindow();
+    ImGuiPlotItem item;
+    if (!Plot_BeginItem(label, size_arg, &item))
         return -1;
-    bool hovered;
-    ButtonBehavior(frame_bb, id, &hovered, NULL);
+    const ImRect& inner_bb = item.InnerBb;
+    const ImVec2& frame_size = item.FrameSize;
+    const bool hovered = item.Hovered;
 
     // Determine scale from values if not specified
     if (scale_min == FLT_MAX || scale_max == FLT_MAX)
@@ -8460,8 +8838,6 @@ int ImGui::PlotEx(ImGuiPlotType plot_type, const char* label, float (*values_get
             scale_max = v_max;
     }
 
-    RenderFrame(frame_bb.Min, frame_bb.Max, GetColorU32(ImGuiCol_FrameBg), true, style.FrameRounding);
-
     const int values_count_min = (plot_type == ImGuiPlotType_Lines) ? 2 : 1;
     int idx_hovered = -1;
     if (values_count >= values_count_min)
@@ -8523,12 +8899,7 @@ int ImGui::PlotEx(ImGuiPlotType plot_type, const char* label, float (*values_get
         }
     }
 
-    // Text overlay
-    if (overlay_text)
-        RenderTextClipped(ImVec2(frame_bb.Min.x, frame_bb.Min.y + style.FramePadding.y), frame_bb.Max, overlay_text, NULL, NULL, ImVec2(0.5f, 0.0f));
-
-    if (label_size.x > 0.0f)
-        RenderText(ImVec2(frame_bb.Max.x + style.ItemInnerSpacing.x, inner_bb.Min.y), label);
+    Plot_EndItem(label, overlay_text, item);
 
     // Return hovered index or -1 if none are hovered.
     // This is currently not exposed in the public API because we need a larger redesign of the whole thing, but in the short-term we are making it available in PlotEx().
@@ -8572,6 +8943,282 @@ void ImGui::PlotHistogram(const char* label, float (*values_getter)(void* data,
     PlotEx(ImGuiPlotType_Histogram, label, values_getter, data, values_count, values_offset, overlay_text, scale_min, scale_max, graph_size);
 }
 
+void ImGui::PlotLines(const char* label, const ImGuiPlotBuffer* buffer, const char* overlay_text, float scale_min, float scale_max, ImVec2 graph_size)
+{
+    PlotEx(ImGuiPlotType_Lines, label, buffer, overlay_text, scale_min, scale_max, graph_size);
+}
+
+void ImGui::PlotHistogram(const char* label, const ImGuiPlotBuffer* buffer, const char* overlay_text, float scale_min, float scale_max, ImVec2 graph_size)
+{
+    PlotEx(ImGuiPlotType_Histogram, label, buffer, overlay_text, scale_min, scale_max, graph_size);
+}
+
+// Same as above, but each pixel column displays the min..max range of all its samples (read from the pyramid) instead of a single sample.
+int ImGui::PlotEx(ImGuiPlotType plot_type, const char* label, const ImGuiPlotBuffer* buffer, const char* overlay_text, float scale_min, float scale_max, const ImVec2& size_arg)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindow* window = GetCurrentWindow();
+    ImGuiPlotItem item;
+    if (!Plot_BeginItem(label, size_arg, &item))
+        return -1;
+    const ImRect& inner_bb = item.InnerBb;
+    const ImVec2& frame_size = item.FrameSize;
+    const bool hovered = item.Hovered;
+
+    // Determine scale from values if not specified (top of the pyramid)
+    const int values_count = buffer->Count;
+    if (scale_min == FLT_MAX || scale_max == FLT_MAX)
+    {
+        float v_min, v_max;
+        buffer->GetMinMax(0, values_count, &v_min, &v_max);
+        if (scale_min == FLT_MAX)
+            scale_min = v_min;
+        if (scale_max == FLT_MAX)
+            scale_max = v_max;
+    }
+
+    const int values_count_min = (plot_type == ImGuiPlotType_Lines) ? 2 : 1;
+    int idx_hovered = -1;
+    if (values_count >= values_count_min)
+    {
+        // Column n covers samples [n * values_count / res_w, (n + 1) * values_count / res_w)
+        // Lines: columns are points spread from the left edge to the right edge. Histogram: columns are bars.
+        const int res_w = ImMax(ImMin((int)frame_size.x, values_count), values_count_min);
+        const float t_step = 1.0f / (float)((plot_type == ImGuiPlotType_Lines) ? res_w - 1 : res_w);
+        #define PLOT_COLUMN_IDX(N)  (int)(((ImS64)(N) * values_count) / res_w)
+
+        // Tooltip on hover
+        int column_hovered = -1;
+        if (hovered && inner_bb.Contains(g.IO.MousePos))
+        {
+            const float t = ImClamp((g.IO.MousePos.x - inner_bb.Min.x) / (inner_bb.Max.x - inner_bb.Min.x), 0.0f, 0.9999f);
+            column_hovered = (plot_type == ImGuiPlotType_Lines) ? (int)(t * (res_w - 1) + 0.5f) : (int)(t * res_w);
+            const int idx_begin = PLOT_COLUMN_IDX(column_hovered);
+            const int idx_end = PLOT_COLUMN_IDX(column_hovered + 1);
+            if (idx_end - idx_begin == 1)
+            {
+                SetTooltip("%d: %8.4g", idx_begin, buffer->GetValue(idx_begin));
+            }
+            else
+            {
+                float v_min, v_max;
+                buffer->GetMinMax(idx_begin, idx_end, &v_min, &v_max);
+                SetTooltip("%d..%d\nmin: %8.4g\nmax: %8.4g", idx_begin, idx_end - 1, v_min, v_max);
+            }
+            idx_hovered = idx_begin;
+        }
+
+        const float inv_scale = (scale_min == scale_max) ? 0.0f : (1.0f / (scale_max - scale_min));
+        float histogram_zero_line_t = (scale_min * scale_max < 0.0f) ? (1 + scale_min * inv_scale) : (scale_min < 0.0f ? 0.0f : 1.0f);   // Where does the zero line stands
+
+        const ImU32 col_base = GetColorU32((plot_type == ImGuiPlotType_Lines) ? ImGuiCol_PlotLines : ImGuiCol_PlotHistogram);
+        const ImU32 col_hovered = GetColorU32((plot_type == ImGuiPlotType_Lines) ? ImGuiCol_PlotLinesHovered : ImGuiCol_PlotHistogramHovered);
+
+        // Lines: build a single path going through the min and max of each column, in the order nearest to the previous point.
+        // Hovered column is redrawn on top, from the previous point to the next point.
+        ImDrawList* draw_list = window->DrawList;
+        ImVec2 hovered_points[4];
+        int hovered_points_count = 0;
+        int idx_begin = 0;
+        for (int n = 0; n < res_w; n++)
+        {
+            const int idx_end = PLOT_COLUMN_IDX(n + 1);
+            float v_min, v_max;
+            buffer->GetMinMax(idx_begin, idx_end, &v_min, &v_max);
+            idx_begin = idx_end;
+            if (v_min > v_max) // Only NaN values
+            {
+                if (plot_type == ImGuiPlotType_Lines)
+                    draw_list->PathStroke(col_base, ImDrawFlags_None, 1.0f);
+                continue;
+            }
+            const float t_top = 1.0f - ImSaturate((v_max - scale_min) * inv_scale);
+            const float t_bottom = 1.0f - ImSaturate((v_min - scale_min) * inv_scale);
+
+            // NB: Draw calls are merged together by the DrawList system. Still, we should render our batch are lower level to save a bit of CPU.
+            if (plot_type == ImGuiPlotType_Lines)
+            {
+                const float x = ImLerp(inner_bb.Min.x, inner_bb.Max.x, n * t_step) + 0.5f;
+                ImVec2 p0(x, ImLerp(inner_bb.Min.y, inner_bb.Max.y, t_top) + 0.5f);
+                ImVec2 p1(x, ImLerp(inner_bb.Min.y, inner_bb.Max.y, t_bottom) + 0.5f);
+                if (draw_list->_Path.Size > 0 && ImFabs(draw_list->_Path.back().y - p1.y) < ImFabs(draw_list->_Path.back().y - p0.y))
+                    ImSwap(p0, p1);
+                if (n == column_hovered + 1 && hovered_points_count > 0)
+                    hovered_points[hovered_points_count++] = p0;
+                if (n == column_hovered && draw_list->_Path.Size > 0)
+                    hovered_points[hovered_points_count++] = draw_list->_Path.back();
+                draw_list->PathLineTo(p0);
+                if (n == column_hovered)
+                    hovered_points[hovered_points_count++] = p0;
+                if (p1.y != p0.y)
+                {
+                    draw_list->PathLineTo(p1);
+                    if (n == column_hovered)
+                        hovered_points[hovered_points_count++] = p1;
+                }
+            }
+            else if (plot_type == ImGuiPlotType_Histogram)
+            {
+                ImVec2 pos0(ImLerp(inner_bb.Min.x, inner_bb.Max.x, n * t_step), ImLerp(inner_bb.Min.y, inner_bb.Max.y, ImMin(t_top, histogram_zero_line_t)));
+                ImVec2 pos1(ImLerp(inner_bb.Min.x, inner_bb.Max.x, (n + 1) * t_step), ImLerp(inner_bb.Min.y, inner_bb.Max.y, ImMax(t_bottom, histogram_zero_line_t)));
+                if (pos1.x >= pos0.x + 2.0f)
+                    pos1.x -= 1.0f;
+                draw_list->AddRectFilled(pos0, pos1, n == column_hovered ? col_hovered : col_base);
+            }
+        }
+        #undef PLOT_COLUMN_IDX
+        if (plot_type == ImGuiPlotType_Lines)
+        {
+            draw_list->PathStroke(col_base, ImDrawFlags_None, 1.0f);
+            if (hovered_points_count >= 2)
+                draw_list->AddPolyline(hovered_points, hovered_points_count, col_hovered, ImDrawFlags_None, 1.0f);
+        }
+    }
+
+    Plot_EndItem(label, overlay_text, item);
+
+    return idx_hovered;
+}
+
+// Pyramid: level 0 is Values[]. Each entry of level N is the min/max of a block of 8 entries of level N-1.
+// Blocks are aligned on indices of Values[] (not on the logical order of samples), so appending only updates the blocks
+// containing the written slots. Slots after Head are not valid until the buffer is full, and are excluded from blocks.
+void ImGuiPlotBuffer::Reserve(int capacity)
+{
+    IM_ASSERT(capacity >= 0);
+    Values.resize(capacity);
+    Capacity = capacity;
+    LevelsCount = 1;
+    int levels_size = 0;
+    for (int level_size = capacity; level_size > 1; )
+    {
+        level_size = (level_size >> 3) + ((level_size & 7) ? 1 : 0);
+        IM_ASSERT(LevelsCount < IM_ARRAYSIZE(LevelsOffset));
+        LevelsOffset[LevelsCount++] = levels_size;
+        levels_size += level_size;
+    }
+    Levels.resize(levels_size);
+    Clear();
+}
+
+void ImGuiPlotBuffer::Clear()
+{
+    Count = Head = 0;
+    for (ImVec2& block : Levels)
+        block = ImVec2(FLT_MAX, -FLT_MAX);
+}
+
+// Update blocks containing [begin, end) in Values[]
+static void PlotBuffer_UpdateLevels(ImGuiPlotBuffer* buf, int begin, int end)
+{
+    int valid_end = (buf->Count == buf->Capacity) ? buf->Capacity : buf->Head;
+    for (int level = 1; level < buf->LevelsCount && begin < end; level++)
+    {
+        ImVec2* blocks = buf->Levels.Data + buf->LevelsOffset[level];
+        const int block_begin = begin >> 3;
+        const int block_end = ((end - 1) >> 3) + 1;
+        for (int block_n = block_begin; block_n < block_end; block_n++)
+        {
+            const int child_begin = block_n << 3;
+            const int child_end = ImMin(child_begin + 8, valid_end);
+            float v_min = FLT_MAX;
+            float v_max = -FLT_MAX;
+            if (level == 1)
+            {
+                for (const float* p = buf->Values.Data + child_begin, *p_end = buf->Values.Data + child_end; p < p_end; p++)
+                    if (*p == *p) // Ignore NaN values
+                    {
+                        v_min = ImMin(v_min, *p);
+                        v_max = ImMax(v_max, *p);
+                    }
+            }
+            else
+            {
+                const ImVec2* children = buf->Levels.Data + buf->LevelsOffset[level - 1];
+                for (const ImVec2* p = children + child_begin, *p_end = children + child_end; p < p_end; p++)
+                {
+                    v_min = ImMin(v_min, p->x);
+                    v_max = ImMax(v_max, p->y);
+                }
+            }
+            blocks[block_n] = ImVec2(v_min, v_max);
+        }
+        begin = block_begin;
+        end = block_end;
+        valid_end = (valid_end >> 3) + ((valid_end & 7) ? 1 : 0);
+    }
+}
+
+void ImGuiPlotBuffer::AddValues(const float* values, int count)
+{
+    IM_ASSERT(Capacity > 0 && "Call Reserve() first!");
+    if (count > Capacity)
+    {
+        values += count - Capacity; // Older values would be overwritten anyway
+        count = Capacity;
+    }
+    while (count > 0)
+    {
+        const int write_begin = Head;
+        const int write_count = ImMin(count, Capacity - Head);
+        memcpy(Values.Data + write_begin, values, (size_t)write_count * sizeof(float));
+        Count = ImMin(Count + write_count, Capacity);
+        Head = (Head + write_count == Capacity) ? 0 : Head + write_count;
+        PlotBuffer_UpdateLevels(this, write_begin, write_begin + write_count);
+        values += write_count;
+        count -= write_count;
+    }
+}
+
+// Accumulate min/max of [begin, end) in Values[]: unaligned entries are read at each level until both ends are aligned on the level above.
+static void PlotBuffer_AccumulateMinMax(const ImGuiPlotBuffer* buf, int begin, int end, float* v_min, float* v_max)
+{
+    for (int level = 0; ; level++)
+    {
+        IM_ASSERT(level < buf->LevelsCount);
+        if (level == 0)
+        {
+            const float* values = buf->Values.Data;
+            for (; begin < end && (begin & 7) != 0; begin++)
+                if (values[begin] == values[begin]) { *v_min = ImMin(*v_min, values[begin]); *v_max = ImMax(*v_max, values[begin]); }
+            for (; begin < end && (end & 7) != 0; end--)
+                if (values[end - 1] == values[end - 1]) { *v_min = ImMin(*v_min, values[end - 1]); *v_max = ImMax(*v_max, values[end - 1]); }
+        }
+        else
+        {
+            const ImVec2* blocks = buf->Levels.Data + buf->LevelsOffset[level];
+            for (; begin < end && (begin & 7) != 0; begin++)
+                { *v_min = ImMin(*v_min, blocks[begin].x); *v_max = ImMax(*v_max, blocks[begin].y); }
+            for (; begin < end && (end & 7) != 0; end--)
+                { *v_min = ImMin(*v_min, blocks[end - 1].x); *v_max = ImMax(*v_max, blocks[end - 1].y); }
+        }
+        if (begin >= end)
+            break;
+        begin >>= 3;
+        end >>= 3;
+    }
+}
+
+void ImGuiPlotBuffer::GetMinMax(int idx_begin, int idx_end, float* out_min, float* out_max) const
+{
+    IM_ASSERT(idx_begin >= 0 && idx_begin <= idx_end && idx_end <= Count);
+    float v_min = FLT_MAX;
+    float v_max = -FLT_MAX;
+
+    // Range in Values[] may wrap around
+    int begin = Head - Count + idx_begin;
+    if (begin < 0)
+        begin += Capacity;
+    for (int len = idx_end - idx_begin; len > 0; begin = 0)
+    {
+        const int end = ImMin(begin + len, Capacity);
+        PlotBuffer_AccumulateMinMax(this, begin, end, &v_min, &v_max);
+        len -= end - begin;
+    }
+    *out_min = v_min;
+    *out_max = v_max;
+}
+
 //-------------------------------------------------------------------------
 // [SECTION] Widgets: Value helpers
 // Those is not very useful, legacy API.
@@ -1,6 +1,7 @@
 // [DEAR IMGUI]
 // This is a slightly modified version of stb_rect_pack.h 1.01.
 // Grep for [DEAR IMGUI] to find the changes.
+// Adds a MaxRects packer (stbrp_init_target_maxrects) which also supports removing rectangles (stbrp_remove_rects).
 // 
 // stb_rect_pack.h - v1.01 - public domain - rectangle packing
 // Sean Barrett 2014
@@ -167,9 +168,28 @@ enum
 {
    STBRP_HEURISTIC_Skyline_default=0,
    STBRP_HEURISTIC_Skyline_BL_sortHeight = STBRP_HEURISTIC_Skyline_default,
-   STBRP_HEURISTIC_Skyline_BF_sortHeight
+   STBRP_HEURISTIC_Skyline_BF_sortHeight,
+   STBRP_HEURISTIC_MaxRects_BSSF        // [DEAR IMGUI] best short side fit, the only heuristic of stbrp_init_target_maxrects()
 };
 
+// [DEAR IMGUI]
+STBRP_DEF void stbrp_init_target_maxrects (stbrp_context *context, int width, int height, stbrp_node *nodes, int num_nodes);
+// Initialize a rectangle packer like stbrp_init_target(), but using the MaxRects algorithm:
+// it tracks every maximal free rectangle of the target, and places each rectangle in the free
+// rectangle which leaves the shortest side. This wastes less space than the skyline packer
+// with mixed rectangle sizes and after many stbrp_pack_rects() calls, at a higher CPU cost.
+//
+// Each free rectangle uses 2 nodes. When 'num_nodes' is too small, the smallest free rectangles
+// are forgotten: their space is wasted, but packing doesn't fail otherwise. A few times the number
+// of rectangles to pack is plenty.
+
+STBRP_DEF void stbrp_remove_rects (stbrp_context *context, const stbrp_rect *rects, int num_rects);
+// MaxRects targets only: make the space of previously packed rectangles available to following
+// stbrp_pack_rects() calls. Rectangles with 'was_packed' == 0 are ignored. Freed space is merged
+// with free rectangles sharing a full edge.
+
+#define STBRP_HAS_MAXRECTS // [DEAR IMGUI] Lets code using this header detect the two additions above (stock stb_rect_pack.h doesn't define it)
+
 
 //////////////////////////////////////////////////////////////////////////////
 //
@@ -193,6 +213,8 @@ struct stbrp_context
    stbrp_node *active_head;
    stbrp_node *free_head;
    stbrp_node extra[2]; // we allocate two extra nodes so optimal user-node-count is 'width' not 'width+2'
+   stbrp_node *free_rects; // [DEAR IMGUI] MaxRects: free rectangles, as pairs of nodes holding (x0,y0) and (x1,y1)
+   int num_free_rects;     // [DEAR IMGUI]
 };
 
 #ifdef __cplusplus
@@ -227,7 +249,8 @@ struct stbrp_context
 
 enum
 {
-   STBRP__INIT_skyline = 1
+   STBRP__INIT_skyline = 1,
+   STBRP__INIT_maxrects = 2 // [DEAR IMGUI]
 };
 
 STBRP_DEF void stbrp_setup_heuristic(stbrp_context *context, int heuristic)
@@ -237,6 +260,10 @@ STBRP_DEF void stbrp_setup_heuristic(stbrp_context *context, int heuristic)
          STBRP_ASSERT(heuristic == STBRP_HEURISTIC_Skyline_BL_sortHeight || heuristic == STBRP_HEURISTIC_Skyline_BF_sortHeight);
          context->heuristic = heuristic;
          break;
+      case STBRP__INIT_maxrects: // [DEAR IMGUI]
+         STBRP_ASSERT(heuristic == STBRP_HEURISTIC_MaxRects_BSSF);
+         context->heuristic = heuristic;
+         break;
       default:
          STBRP_ASSERT(0);
    }
@@ -285,6 +312,8 @@ STBRP_DEF void stbrp_init_target(stbrp_context *context, int width, int height,
    context->extra[1].x = (stbrp_coord) width;
    context->extra[1].y = (1<<30);
    context->extra[1].next = NULL;
+   context->free_rects = NULL;
+   context->num_free_rects = 0;
 }
 
 // find minimum y position if it starts at x1
@@ -525,6 +554,174 @@ static stbrp__findresult stbrp__skyline_pack_rectangle(stbrp_context *context, i
    return res;
 }
 
+// [DEAR IMGUI] MaxRects
+// Free rectangle 'i' is stored as free_rects[i*2] = (x0,y0), free_rects[i*2+1] = (x1,y1), exclusive.
+// Invariants: free rectangles don't overlap any packed rectangle, and none is contained in another.
+#define STBRP__FR0(c,i)   ((c)->free_rects[(i)*2])
+#define STBRP__FR1(c,i)   ((c)->free_rects[(i)*2+1])
+
+STBRP_DEF void stbrp_init_target_maxrects(stbrp_context *context, int width, int height, stbrp_node *nodes, int num_nodes)
+{
+   STBRP_ASSERT(num_nodes >= 2);
+   stbrp_init_target(context, width, height, nodes, num_nodes);
+   context->init_mode = STBRP__INIT_maxrects;
+   context->heuristic = STBRP_HEURISTIC_MaxRects_BSSF;
+   context->free_rects = nodes;
+   context->num_free_rects = 1;
+   STBRP__FR0(context, 0).x = 0;
+   STBRP__FR0(context, 0).y = 0;
+   STBRP__FR1(context, 0).x = (stbrp_coord) width;
+   STBRP__FR1(context, 0).y = (stbrp_coord) height;
+}
+
+static void stbrp__maxrects_copy(stbrp_context *c, int dst, int src)
+{
+   STBRP__FR0(c, dst) = STBRP__FR0(c, src);
+   STBRP__FR1(c, dst) = STBRP__FR1(c, src);
+}
+
+static int stbrp__maxrects_contains(stbrp_context *c, int outer, int inner)
+{
+   return STBRP__FR0(c, outer).x <= STBRP__FR0(c, inner).x && STBRP__FR0(c, outer).y <= STBRP__FR0(c, inner).y
+       && STBRP__FR1(c, outer).x >= STBRP__FR1(c, inner).x && STBRP__FR1(c, outer).y >= STBRP__FR1(c, inner).y;
+}
+
+// Append a free rectangle. When out of nodes, forget the smallest one instead.
+static void stbrp__maxrects_push(stbrp_context *c, int x0, int y0, int x1, int y1)
+{
+   int i = c->num_free_rects;
+   if (x0 >= x1 || y0 >= y1)
+      return;
+   if (c->num_free_rects == c->num_nodes / 2) {
+      int j, smallest_area = (x1 - x0) * (y1 - y0);
+      i = -1;
+      for (j=0; j < c->num_free_rects; ++j) {
+         int area = (STBRP__FR1(c, j).x - STBRP__FR0(c, j).x) * (STBRP__FR1(c, j).y - STBRP__FR0(c, j).y);
+         if (area < smallest_area) {
+            smallest_area = area;
+            i = j;
+         }
+      }
+      if (i == -1)
+         return;
+   } else {
+      c->num_free_rects++;
+   }
+   STBRP__FR0(c, i).x = (stbrp_coord) x0;
+   STBRP__FR0(c, i).y = (stbrp_coord) y0;
+   STBRP__FR1(c, i).x = (stbrp_coord) x1;
+   STBRP__FR1(c, i).y = (stbrp_coord) y1;
+}
+
+// Remove free rectangles [first_new, num_free_rects) which are contained in another free rectangle.
+// Rectangles before first_new already satisfy the invariant, and can't be contained in a newer one.
+static void stbrp__maxrects_prune(stbrp_context *c, int first_new)
+{
+   int i, j;
+   for (i=first_new; i < c->num_free_rects; ++i) {
+      for (j=0; j < c->num_free_rects; ++j) {
+         if (i != j && stbrp__maxrects_contains(c, j, i)) {
+            stbrp__maxrects_copy(c, i, --c->num_free_rects);
+            --i;
+            break;
+         }
+      }
+   }
+}
+
+static int stbrp__maxrects_pack_rectangle(stbrp_context *c, int width, int height, int *px, int *py)
+{
+   int i, best = -1, best_short = STBRP__MAXVAL, best_long = STBRP__MAXVAL;
+   int x0, y0, x1, y1, old_end;
+
+   // best short side fit: the free rectangle leaving the smallest leftover on one side
+   for (i=0; i < c->num_free_rects; ++i) {
+      int leftover_w = STBRP__FR1(c, i).x - STBRP__FR0(c, i).x - width;
+      int leftover_h = STBRP__FR1(c, i).y - STBRP__FR0(c, i).y - height;
+      if (leftover_w >= 0 && leftover_h >= 0) {
+         int short_side = leftover_w < leftover_h ? leftover_w : leftover_h;
+         int long_side = leftover_w < leftover_h ? leftover_h : leftover_w;
+         if (short_side < best_short || (short_side == best_short && long_side < best_long)) {
+            best = i;
+            best_short = short_side;
+            best_long = long_side;
+         }
+      }
+   }
+   if (best == -1)
+      return 0;
+   x0 = *px = STBRP__FR0(c, best).x;
+   y0 = *py = STBRP__FR0(c, best).y;
+   x1 = x0 + width;
+   y1 = y0 + height;
+
+   // split every free rectangle intersecting the new one into up to 4 maximal free rectangles around it.
+   // [0,old_end) are unprocessed old rectangles, new ones are appended after them.
+   old_end = c->num_free_rects;
+   for (i=0; i < old_end; ++i) {
+      stbrp_node f0 = STBRP__FR0(c, i), f1 = STBRP__FR1(c, i);
+      if (x0 >= f1.x || x1 <= f0.x || y0 >= f1.y || y1 <= f0.y)
+         continue;
+      // remove it, keeping new rectangles contiguous after old ones
+      stbrp__maxrects_copy(c, i, old_end - 1);
+      stbrp__maxrects_copy(c, old_end - 1, c->num_free_rects - 1);
+      c->num_free_rects--;
+      old_end--;
+      i--;
+      stbrp__maxrects_push(c, f0.x, f0.y, x0, f1.y); // left
+      stbrp__maxrects_push(c, x1, f0.y, f1.x, f1.y); // right
+      stbrp__maxrects_push(c, f0.x, f0.y, f1.x, y0); // top
+      stbrp__maxrects_push(c, f0.x, y1, f1.x, f1.y); // bottom
+   }
+   stbrp__maxrects_prune(c, old_end);
+   return 1;
+}
+
+STBRP_DEF void stbrp_remove_rects(stbrp_context *c, const stbrp_rect *rects, int num_rects)
+{
+   int i, j, merged;
+   STBRP_ASSERT(c->init_mode == STBRP__INIT_maxrects);
+   for (i=0; i < num_rects; ++i) {
+      stbrp_node r0, r1;
+      if (!rects[i].was_packed || rects[i].w == 0 || rects[i].h == 0)
+         continue;
+      r0.x = rects[i].x;
+      r0.y = rects[i].y;
+      r1.x = rects[i].x + rects[i].w;
+      r1.y = rects[i].y + rects[i].h;
+
+      // merge with free rectangles sharing a full edge, as long as we find some
+      do {
+         merged = 0;
+         for (j=0; j < c->num_free_rects; ++j) {
+            stbrp_node f0 = STBRP__FR0(c, j), f1 = STBRP__FR1(c, j);
+            int same_x = (f0.x == r0.x && f1.x == r1.x);
+            int same_y = (f0.y == r0.y && f1.y == r1.y);
+            if ((same_x && (f1.y == r0.y || f0.y == r1.y)) || (same_y && (f1.x == r0.x || f0.x == r1.x))) {
+               if (f0.x < r0.x) r0.x = f0.x;
+               if (f0.y < r0.y) r0.y = f0.y;
+               if (f1.x > r1.x) r1.x = f1.x;
+               if (f1.y > r1.y) r1.y = f1.y;
+               stbrp__maxrects_copy(c, j, --c->num_free_rects);
+               merged = 1;
+               break;
+            }
+         }
+      } while (merged);
+
+      // drop free rectangles now contained in the freed one, then add it
+      for (j=0; j < c->num_free_rects; ++j) {
+         if (r0.x <= STBRP__FR0(c, j).x && r0.y <= STBRP__FR0(c, j).y && r1.x >= STBRP__FR1(c, j).x && r1.y >= STBRP__FR1(c, j).y) {
+            stbrp__maxrects_copy(c, j, --c->num_free_rects);
+            --j;
+         }
+      }
+      j = c->num_free_rects;
+      stbrp__maxrects_push(c, r0.x, r0.y, r1.x, r1.y);
+      stbrp__maxrects_prune(c, j);
+   }
+}
+
 static int STBRP__CDECL rect_height_compare(const void *a, const void *b)
 {
    const stbrp_rect *p = (const stbrp_rect *) a;
@@ -558,6 +755,14 @@ STBRP_DEF int stbrp_pack_rects(stbrp_context *context, stbrp_rect *rects, int nu
    for (i=0; i < num_rects; ++i) {
       if (rects[i].w == 0 || rects[i].h == 0) {
          rects[i].x = rects[i].y = 0;  // empty rect needs no space
+      } else if (context->init_mode == STBRP__INIT_maxrects) { // [DEAR IMGUI]
+         int x, y;
+         if (stbrp__maxrects_pack_rectangle(context, rects[i].w, rects[i].h, &x, &y)) {
+            rects[i].x = (stbrp_coord) x;
+            rects[i].y = (stbrp_coord) y;
+         } else {
+            rects[i].x = rects[i].y = STBRP__MAXVAL;
+         }
       } else {
          stbrp__findresult fr = stbrp__skyline_pack_rectangle(context, rects[i].w, rects[i].h);
          if (fr.prev_link) {
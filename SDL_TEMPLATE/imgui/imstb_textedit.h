@@ -5,6 +5,7 @@
 // - Fix in stb_textedit_find_charpos to handle last line (see https://github.com/ocornut/imgui/issues/6000 + #6783)
 // - Added name to struct or it may be forward declared in our code.
 // - Added UTF-8 support (see https://github.com/nothings/stb/issues/188 + https://github.com/ocornut/imgui/pull/7925)
+// - Added optional IMSTB_TEXTEDIT_SEEKROW_CHAR/IMSTB_TEXTEDIT_SEEKROW_Y to skip laying out all rows above the one searched (large texts)
 // Grep for [DEAR IMGUI] to find the changes.
 // - Also renamed macros used or defined outside of IMSTB_TEXTEDIT_IMPLEMENTATION block from STB_TEXTEDIT_* to IMSTB_TEXTEDIT_*
 
@@ -418,6 +419,11 @@ static int stb_text_locate_coord(IMSTB_TEXTEDIT_STRING *str, float x, float y)
    r.ymin = r.ymax = 0;
    r.num_chars = 0;
 
+   // [DEAR IMGUI] start from a row provided by the client, which may be able to locate it without laying out all previous rows
+   #ifdef IMSTB_TEXTEDIT_SEEKROW_Y
+   IMSTB_TEXTEDIT_SEEKROW_Y(str, y, &i, &base_y);
+   #endif
+
    // search rows to find one that straddles 'y'
    while (i < n) {
       STB_TEXTEDIT_LAYOUTROW(&r, str, i);
@@ -548,6 +554,11 @@ static void stb_textedit_find_charpos(StbFindState *find, IMSTB_TEXTEDIT_STRING
    // search rows to find the one that straddles character n
    find->y = 0;
 
+   // [DEAR IMGUI] start from a row provided by the client, which may be able to locate it without laying out all previous rows
+   #ifdef IMSTB_TEXTEDIT_SEEKROW_CHAR
+   IMSTB_TEXTEDIT_SEEKROW_CHAR(str, n, &i, &prev_start, &find->y);
+   #endif
+
    for(;;) {
       STB_TEXTEDIT_LAYOUTROW(&r, str, i);
       if (n < i + r.num_chars)
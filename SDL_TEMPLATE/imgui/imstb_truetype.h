@@ -1,6 +1,9 @@
 // [DEAR IMGUI]
 // This is a slightly modified version of stb_truetype.h 1.26.
 // Mostly fixing for compiler and static analyzer warnings.
+// Also adds optional SSE2 code paths to the v2 rasterizer and oversampling prefilters (#define STBTT_SSE2),
+// and optional character map / glyph offset acceleration tables (stbtt_InitFontAccel).
+// Also adds stbtt_GetGlyphKernPairs() to flatten 'GPOS' and 'kern' kerning into a list of pairs.
 // Grep for [DEAR IMGUI] to find the changes.
 
 // stb_truetype.h - v1.26 - public domain
@@ -586,6 +589,7 @@ typedef struct
 
 typedef struct stbtt_pack_context stbtt_pack_context;
 typedef struct stbtt_fontinfo stbtt_fontinfo;
+typedef struct stbtt__accel stbtt__accel; // [DEAR IMGUI]
 #ifndef STB_RECT_PACK_VERSION
 typedef struct stbrp_rect stbrp_rect;
 #endif
@@ -733,6 +737,8 @@ struct stbtt_fontinfo
    stbtt__buf subrs;                  // private charstring subroutines index
    stbtt__buf fontdicts;              // array of font dicts
    stbtt__buf fdselect;               // map from glyph to fontdict
+
+   stbtt__accel *accel;               // [DEAR IMGUI] optional acceleration tables, see stbtt_InitFontAccel()
 };
 
 STBTT_DEF int stbtt_InitFont(stbtt_fontinfo *info, const unsigned char *data, int offset);
@@ -742,6 +748,21 @@ STBTT_DEF int stbtt_InitFont(stbtt_fontinfo *info, const unsigned char *data, in
 // need to do anything special to free it, because the contents are pure
 // value data with no additional data structures. Returns 0 on failure.
 
+// [DEAR IMGUI]
+STBTT_DEF int stbtt_InitFontAccel(stbtt_fontinfo *info);
+// Optionally call after stbtt_InitFont() to decode the character map and the
+// glyph offsets into native tables (~128 KB + 4 bytes per glyph), allocated with
+// info->userdata. This speeds up stbtt_FindGlyphIndex() to an array lookup for
+// the BMP and a binary search of decoded ranges above it, for programs doing many
+// lookups. Returns 0 if the tables couldn't be built (e.g. unsupported character
+// map format), in which case the font keeps working without them.
+
+STBTT_DEF void stbtt_FreeFontAccel(stbtt_fontinfo *info);
+// Frees tables allocated by stbtt_InitFontAccel(). Copies of a stbtt_fontinfo
+// share its tables: free them only once, with the same userdata.
+
+#define STBTT_HAS_FONT_ACCEL // [DEAR IMGUI] Lets code using this header detect the three additions above (stock stb_truetype.h doesn't define it)
+
 
 //////////////////////////////////////////////////////////////////////////////
 //
@@ -819,6 +840,16 @@ STBTT_DEF int  stbtt_GetKerningTable(const stbtt_fontinfo *info, stbtt_kerningen
 // stbtt_GetKerningTable never writes more than table_length entries and returns how many entries it did write.
 // The table will be sorted by (a.glyph1 == b.glyph1)?(a.glyph2 < b.glyph2):(a.glyph1 < b.glyph1)
 
+// [DEAR IMGUI]
+STBTT_DEF int  stbtt_GetGlyphKernPairs(const stbtt_fontinfo *info, const unsigned char *glyph_filter, stbtt_kerningentry* table, int table_length);
+// Retrieves every pair with a non-zero stbtt_GetGlyphKernAdvance(), from the 'GPOS' pair adjustment lookups
+// or from the 'kern' table. If glyph_filter is not NULL, it is an array of info->numGlyphs flags: only pairs
+// of glyphs with non-zero flags are retrieved. Never writes more than table_length entries, and returns
+// the total number of pairs (call again with a larger table when it is larger), or -1 on allocation failure.
+// The table will be sorted by glyph1.
+
+#define STBTT_HAS_GLYPH_KERN_PAIRS // [DEAR IMGUI] Lets code using this header detect stbtt_GetGlyphKernPairs() (stock stb_truetype.h doesn't define it)
+
 //////////////////////////////////////////////////////////////////////////////
 //
 // GLYPH SHAPES (you probably don't need these, but they have to go before
@@ -1124,6 +1155,11 @@ typedef int stbtt__test_oversample_pow2[(STBTT_MAX_OVERSAMPLE & (STBTT_MAX_OVERS
 #define STBTT_RASTERIZER_VERSION 2
 #endif
 
+// [DEAR IMGUI] Optional SSE2 code paths. Output may differ from the scalar version by +/-1 alpha, due to floating-point summation order.
+#ifdef STBTT_SSE2
+#include <emmintrin.h>
+#endif
+
 #ifdef _MSC_VER
 #define STBTT__NOTUSED(v)  (void)(v)
 #else
@@ -1393,6 +1429,7 @@ static int stbtt_InitFont_internal(stbtt_fontinfo *info, unsigned char *data, in
    info->data = data;
    info->fontstart = fontstart;
    info->cff = stbtt__new_buf(NULL, 0);
+   info->accel = NULL; // [DEAR IMGUI]
 
    cmap = stbtt__find_table(data, fontstart, "cmap");       // required
    info->loca = stbtt__find_table(data, fontstart, "loca"); // required
@@ -1498,12 +1535,130 @@ static int stbtt_InitFont_internal(stbtt_fontinfo *info, unsigned char *data, in
    return 1;
 }
 
+// [DEAR IMGUI] Acceleration tables
+struct stbtt__accel
+{
+   stbtt_uint16 cmap_bmp[0x10000];    // codepoint -> glyph index for U+0000..U+FFFF
+   stbtt_uint32 *cmap_groups;         // cmap format 12/13 groups ending at U+10000 or above, decoded: { start, end, glyph } triplets
+   stbtt_int32 cmap_groups_count;
+   stbtt_int32 cmap_groups_format;    // 12 or 13
+   stbtt_uint32 *glyf_offsets;        // decoded 'loca' table, numGlyphs+1 entries. NULL for CFF fonts.
+};
+
+static int stbtt__FindGlyphIndexAccel(const stbtt__accel *accel, int unicode_codepoint)
+{
+   stbtt_int32 low = 0, high = accel->cmap_groups_count;
+   if ((stbtt_uint32) unicode_codepoint < 0x10000)
+      return accel->cmap_bmp[unicode_codepoint];
+   while (low < high) {
+      stbtt_int32 mid = low + ((high-low) >> 1);
+      const stbtt_uint32 *group = accel->cmap_groups + mid*3;
+      if ((stbtt_uint32) unicode_codepoint < group[0])
+         high = mid;
+      else if ((stbtt_uint32) unicode_codepoint > group[1])
+         low = mid+1;
+      else
+         return accel->cmap_groups_format == 12 ? (int) (group[2] + unicode_codepoint - group[0]) : (int) group[2];
+   }
+   return 0;
+}
+
+STBTT_DEF int stbtt_InitFontAccel(stbtt_fontinfo *info)
+{
+   stbtt_uint8 *data = info->data;
+   stbtt_uint32 index_map = info->index_map;
+   stbtt_uint16 format = ttUSHORT(data + index_map + 0);
+   stbtt_int32 i, groups_count = 0;
+   stbtt_uint32 c;
+   int loca_count = (!info->cff.size && info->indexToLocFormat < 2) ? info->numGlyphs + 1 : 0;
+   stbtt__accel *accel;
+
+   if (info->accel)
+      return 1;
+   if (format != 0 && format != 4 && format != 6 && format != 12 && format != 13)
+      return 0;
+   if (format == 12 || format == 13) {
+      stbtt_uint32 ngroups = ttULONG(data+index_map+12);
+      for (i=0; i < (stbtt_int32) ngroups; ++i)
+         if (ttULONG(data+index_map+16+i*12+4) >= 0x10000)
+            ++groups_count;
+   }
+   accel = (stbtt__accel *) STBTT_malloc(sizeof(stbtt__accel) + groups_count*3*sizeof(stbtt_uint32) + loca_count*sizeof(stbtt_uint32), info->userdata);
+   if (accel == NULL)
+      return 0;
+   STBTT_memset(accel->cmap_bmp, 0, sizeof(accel->cmap_bmp));
+   accel->cmap_groups = (stbtt_uint32 *) (accel + 1);
+   accel->cmap_groups_count = groups_count;
+   accel->cmap_groups_format = format;
+   accel->glyf_offsets = loca_count ? accel->cmap_groups + groups_count*3 : NULL;
+
+   // Character map (same results as the stbtt_FindGlyphIndex() code below)
+   if (format == 0) {
+      stbtt_int32 bytes = ttUSHORT(data + index_map + 2);
+      for (c=0; (stbtt_int32) c < bytes-6 && c < 256; ++c)
+         accel->cmap_bmp[c] = ttBYTE(data + index_map + 6 + c);
+   } else if (format == 6) {
+      stbtt_uint32 first = ttUSHORT(data + index_map + 6);
+      stbtt_uint32 count = ttUSHORT(data + index_map + 8);
+      for (c=0; c < count && first+c < 0x10000; ++c)
+         accel->cmap_bmp[first+c] = ttUSHORT(data + index_map + 10 + c*2);
+   } else if (format == 4) {
+      stbtt_int32 segcount = ttUSHORT(data+index_map+6) >> 1;
+      stbtt_uint32 endCount = index_map + 14;
+      for (i=segcount-1; i >= 0; --i) { // in reverse, so the first segment containing a codepoint wins, like the binary search
+         stbtt_uint32 start = ttUSHORT(data + index_map + 14 + segcount*2 + 2 + 2*i);
+         stbtt_uint32 last = ttUSHORT(data + endCount + 2*i);
+         stbtt_uint32 delta_addr = index_map + 14 + segcount*4 + 2 + 2*i;
+         stbtt_uint32 offset_addr = index_map + 14 + segcount*6 + 2 + 2*i;
+         stbtt_uint16 offset = ttUSHORT(data + offset_addr);
+         for (c=start; c <= last; ++c)
+            accel->cmap_bmp[c] = offset == 0 ? (stbtt_uint16) (c + ttSHORT(data + delta_addr)) : ttUSHORT(data + offset + (c-start)*2 + offset_addr);
+      }
+   } else {
+      stbtt_uint32 ngroups = ttULONG(data+index_map+12);
+      stbtt_uint32 *group_out = accel->cmap_groups;
+      for (i=(stbtt_int32) ngroups-1; i >= 0; --i) {
+         stbtt_uint32 start_char = ttULONG(data+index_map+16+i*12);
+         stbtt_uint32 end_char = ttULONG(data+index_map+16+i*12+4);
+         stbtt_uint32 start_glyph = ttULONG(data+index_map+16+i*12+8);
+         for (c=start_char; c <= end_char && c < 0x10000; ++c)
+            accel->cmap_bmp[c] = (stbtt_uint16) (format == 12 ? start_glyph + c - start_char : start_glyph);
+      }
+      for (i=0; i < (stbtt_int32) ngroups; ++i) {
+         if (ttULONG(data+index_map+16+i*12+4) < 0x10000)
+            continue;
+         group_out[0] = ttULONG(data+index_map+16+i*12);
+         group_out[1] = ttULONG(data+index_map+16+i*12+4);
+         group_out[2] = ttULONG(data+index_map+16+i*12+8);
+         group_out += 3;
+      }
+   }
+
+   // Glyph offsets
+   for (i=0; i < loca_count; ++i)
+      accel->glyf_offsets[i] = (info->indexToLocFormat == 0) ? ttUSHORT(data + info->loca + i * 2) * 2 : ttULONG(data + info->loca + i * 4);
+
+   info->accel = accel;
+   return 1;
+}
+
+STBTT_DEF void stbtt_FreeFontAccel(stbtt_fontinfo *info)
+{
+   if (info->accel)
+      STBTT_free(info->accel, info->userdata);
+   info->accel = NULL;
+}
+
 STBTT_DEF int stbtt_FindGlyphIndex(const stbtt_fontinfo *info, int unicode_codepoint)
 {
    stbtt_uint8 *data = info->data;
    stbtt_uint32 index_map = info->index_map;
+   stbtt_uint16 format;
 
-   stbtt_uint16 format = ttUSHORT(data + index_map + 0);
+   if (info->accel) // [DEAR IMGUI]
+      return stbtt__FindGlyphIndexAccel(info->accel, unicode_codepoint);
+
+   format = ttUSHORT(data + index_map + 0);
    if (format == 0) { // apple byte encoding
       stbtt_int32 bytes = ttUSHORT(data + index_map + 2);
       if (unicode_codepoint < bytes-6)
@@ -1614,7 +1769,10 @@ static int stbtt__GetGlyfOffset(const stbtt_fontinfo *info, int glyph_index)
    if (glyph_index >= info->numGlyphs) return -1; // glyph index out of range
    if (info->indexToLocFormat >= 2)    return -1; // unknown index->glyph map format
 
-   if (info->indexToLocFormat == 0) {
+   if (info->accel) { // [DEAR IMGUI]
+      g1 = info->glyf + info->accel->glyf_offsets[glyph_index];
+      g2 = info->glyf + info->accel->glyf_offsets[glyph_index + 1];
+   } else if (info->indexToLocFormat == 0) {
       g1 = info->glyf + ttUSHORT(info->data + info->loca + glyph_index * 2) * 2;
       g2 = info->glyf + ttUSHORT(info->data + info->loca + glyph_index * 2 + 2) * 2;
    } else {
@@ -2624,6 +2782,166 @@ STBTT_DEF int  stbtt_GetGlyphKernAdvance(const stbtt_fontinfo *info, int g1, int
    return xAdvance;
 }
 
+// [DEAR IMGUI] Enumerate the pairs stbtt__GetGlyphGPOSInfoAdvance() would return non-zero values for:
+// for each glyph1, the first covering subtable decides the pairs it lists (format 1) or all remaining pairs (format 2).
+// 'decided' is an array of numGlyphs stamps, set to glyph1+1 once the advance of (glyph1, glyph2) is known.
+static int stbtt__GetGPOSKernPairs(const stbtt_fontinfo *info, const unsigned char *glyph_filter, int *decided, stbtt_kerningentry* table, int table_length)
+{
+   stbtt_uint16 lookupListOffset;
+   stbtt_uint8 *lookupList;
+   stbtt_uint16 lookupCount;
+   stbtt_uint8 *data;
+   stbtt_int32 i, sti, m;
+   int glyph1, glyph2, count = 0;
+
+   data = info->data + info->gpos;
+
+   if (ttUSHORT(data+0) != 1) return 0; // Major version 1
+   if (ttUSHORT(data+2) != 0) return 0; // Minor version 0
+
+   lookupListOffset = ttUSHORT(data+8);
+   lookupList = data + lookupListOffset;
+   lookupCount = ttUSHORT(lookupList);
+
+   for (glyph1=0; glyph1 < info->numGlyphs; ++glyph1) {
+      int done = 0;
+      if (glyph_filter && !glyph_filter[glyph1])
+         continue;
+      for (i=0; i<lookupCount && !done; ++i) {
+         stbtt_uint16 lookupOffset = ttUSHORT(lookupList + 2 + 2 * i);
+         stbtt_uint8 *lookupTable = lookupList + lookupOffset;
+
+         stbtt_uint16 lookupType = ttUSHORT(lookupTable);
+         stbtt_uint16 subTableCount = ttUSHORT(lookupTable + 4);
+         stbtt_uint8 *subTableOffsets = lookupTable + 6;
+         if (lookupType != 2) // Pair Adjustment Positioning Subtable
+            continue;
+
+         for (sti=0; sti<subTableCount && !done; sti++) {
+            stbtt_uint16 subtableOffset = ttUSHORT(subTableOffsets + 2 * sti);
+            stbtt_uint8 *table_data = lookupTable + subtableOffset;
+            stbtt_uint16 posFormat = ttUSHORT(table_data);
+            stbtt_uint16 coverageOffset = ttUSHORT(table_data + 2);
+            stbtt_uint16 valueFormat1 = ttUSHORT(table_data + 4);
+            stbtt_uint16 valueFormat2 = ttUSHORT(table_data + 6);
+            stbtt_int32 coverageIndex = stbtt__GetCoverageIndex(table_data + coverageOffset, glyph1);
+            if (coverageIndex == -1) continue;
+
+            done = 1; // unless a format 1 subtable doesn't list all pairs
+            if (valueFormat1 != 4 || valueFormat2 != 0) // Support more formats?
+               break;
+            if (posFormat == 1) {
+               stbtt_uint16 pairSetCount = ttUSHORT(table_data + 8);
+               stbtt_uint16 pairPosOffset = ttUSHORT(table_data + 10 + 2 * coverageIndex);
+               stbtt_uint8 *pairValueTable = table_data + pairPosOffset;
+               stbtt_uint16 pairValueCount = ttUSHORT(pairValueTable);
+               stbtt_uint8 *pairValueArray = pairValueTable + 2;
+
+               if (coverageIndex >= pairSetCount)
+                  break;
+               done = 0;
+               for (m=0; m<pairValueCount; ++m) {
+                  stbtt_int16 xAdvance = ttSHORT(pairValueArray + 4 * m + 2);
+                  glyph2 = ttUSHORT(pairValueArray + 4 * m);
+                  if (glyph2 >= info->numGlyphs || decided[glyph2] == glyph1 + 1)
+                     continue;
+                  decided[glyph2] = glyph1 + 1;
+                  if (xAdvance != 0 && (!glyph_filter || glyph_filter[glyph2])) {
+                     if (count < table_length) {
+                        table[count].glyph1 = glyph1;
+                        table[count].glyph2 = glyph2;
+                        table[count].advance = xAdvance;
+                     }
+                     ++count;
+                  }
+               }
+            } else if (posFormat == 2) {
+               stbtt_uint16 classDef1Offset = ttUSHORT(table_data + 8);
+               stbtt_uint16 classDef2Offset = ttUSHORT(table_data + 10);
+               stbtt_uint8 *classDef2 = table_data + classDef2Offset;
+               stbtt_uint16 classDef2Format = ttUSHORT(classDef2);
+               int glyph1class = stbtt__GetGlyphClass(table_data + classDef1Offset, glyph1);
+               stbtt_uint16 class1Count = ttUSHORT(table_data + 12);
+               stbtt_uint16 class2Count = ttUSHORT(table_data + 14);
+               stbtt_uint8 *class2Records;
+               int visit_all, records_count, range_start, range_end, glyph2class;
+
+               if (glyph1class < 0 || glyph1class >= class1Count) break; // malformed
+               if (classDef2Format != 1 && classDef2Format != 2) break; // unsupported, all glyph2 classes are -1
+               class2Records = table_data + 16 + 2 * (glyph1class * class2Count);
+
+               // Glyphs not listed in the class definition are in class 0. If class 0 has a non-zero advance we visit
+               // all glyphs, otherwise the records of the class definition: format 1 is an array of classes, format 2
+               // an array of (start, end, class) ranges.
+               visit_all = (class2Count > 0 && ttSHORT(class2Records) != 0);
+               records_count = visit_all ? 1 : (classDef2Format == 1) ? ttUSHORT(classDef2 + 4) : ttUSHORT(classDef2 + 2);
+               for (m=0; m<records_count; ++m) {
+                  if (visit_all) {
+                     range_start = 0;
+                     range_end = info->numGlyphs - 1;
+                  } else if (classDef2Format == 1) {
+                     range_start = range_end = ttUSHORT(classDef2 + 2) + m;
+                  } else {
+                     range_start = ttUSHORT(classDef2 + 4 + 6 * m);
+                     range_end = ttUSHORT(classDef2 + 4 + 6 * m + 2);
+                  }
+                  for (glyph2=range_start; glyph2 <= range_end && glyph2 < info->numGlyphs; ++glyph2) {
+                     stbtt_int16 xAdvance;
+                     if (decided[glyph2] == glyph1 + 1 || (glyph_filter && !glyph_filter[glyph2]))
+                        continue;
+                     decided[glyph2] = glyph1 + 1;
+                     glyph2class = stbtt__GetGlyphClass(classDef2, glyph2); // also resolves overlapping ranges the same way
+                     if (glyph2class < 0 || glyph2class >= class2Count)
+                        continue;
+                     xAdvance = ttSHORT(class2Records + 2 * glyph2class);
+                     if (xAdvance != 0) {
+                        if (count < table_length) {
+                           table[count].glyph1 = glyph1;
+                           table[count].glyph2 = glyph2;
+                           table[count].advance = xAdvance;
+                        }
+                        ++count;
+                     }
+                  }
+               }
+            }
+         }
+      }
+   }
+   return count;
+}
+
+STBTT_DEF int  stbtt_GetGlyphKernPairs(const stbtt_fontinfo *info, const unsigned char *glyph_filter, stbtt_kerningentry* table, int table_length)
+{
+   int k, count = 0;
+
+   if (info->gpos) {
+      int *decided = (int *) STBTT_malloc(info->numGlyphs * sizeof(int), info->userdata);
+      if (decided == NULL)
+         return -1;
+      STBTT_memset(decided, 0, info->numGlyphs * sizeof(int));
+      count = stbtt__GetGPOSKernPairs(info, glyph_filter, decided, table, table_length);
+      STBTT_free(decided, info->userdata);
+   } else if (info->kern) {
+      stbtt_uint8 *data = info->data + info->kern;
+      int length = stbtt_GetKerningTableLength(info);
+      for (k = 0; k < length; k++) {
+         int glyph1 = ttUSHORT(data+18+(k*6));
+         int glyph2 = ttUSHORT(data+20+(k*6));
+         int advance = ttSHORT(data+22+(k*6));
+         if (advance == 0 || (glyph_filter && (glyph1 >= info->numGlyphs || glyph2 >= info->numGlyphs || !glyph_filter[glyph1] || !glyph_filter[glyph2])))
+            continue;
+         if (count < table_length) {
+            table[count].glyph1 = glyph1;
+            table[count].glyph2 = glyph2;
+            table[count].advance = advance;
+         }
+         ++count;
+      }
+   }
+   return count;
+}
+
 STBTT_DEF int  stbtt_GetCodepointKernAdvance(const stbtt_fontinfo *info, int ch1, int ch2)
 {
    if (!info->kern && !info->gpos) // if no kerning table, don't waste time looking up both codepoint->glyphs
@@ -3221,7 +3539,21 @@ static void stbtt__fill_active_edges_new(float *scanline, float *scanline_fill,
                // which multiplied by 1-pixel-width is how much pixel area changes for each step in x
                // so the area advances by 'step' every time
 
-               for (x = x1+1; x < x2; ++x) {
+               x = x1+1;
+#ifdef STBTT_SSE2
+               // [DEAR IMGUI] SSE2: 4 pixels at a time
+               if (x2 - x >= 8) {
+                  __m128 v = _mm_add_ps(_mm_set1_ps(area + step/2), _mm_mul_ps(_mm_set1_ps(step), _mm_setr_ps(0.0f, 1.0f, 2.0f, 3.0f)));
+                  __m128 step4 = _mm_set1_ps(step*4);
+                  int x_start = x;
+                  for (; x + 4 <= x2; x += 4) {
+                     _mm_storeu_ps(scanline + x, _mm_add_ps(_mm_loadu_ps(scanline + x), v));
+                     v = _mm_add_ps(v, step4);
+                  }
+                  area += step * (float) (x - x_start);
+               }
+#endif
+               for (; x < x2; ++x) {
                   scanline[x] += area + step/2; // area of trapezoid is 1*step/2
                   area += step;
                }
@@ -3370,7 +3702,36 @@ static void stbtt__rasterize_sorted_edges(stbtt__bitmap *result, stbtt__edge *e,
 
       {
          float sum = 0;
-         for (i=0; i < result->w; ++i) {
+         i = 0;
+#ifdef STBTT_SSE2
+         {
+            // [DEAR IMGUI] SSE2: prefix sum of scanline2[] and conversion to alpha, 4 pixels at a time
+            const __m128 abs_mask = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+            const __m128 k255 = _mm_set1_ps(255.0f);
+            const __m128 khalf = _mm_set1_ps(0.5f);
+            __m128 sum4 = _mm_setzero_ps();
+            unsigned char *dst = result->pixels + j*result->stride;
+            for (; i + 4 <= result->w; i += 4) {
+               __m128 s = _mm_loadu_ps(scanline2 + i);
+               __m128 k;
+               __m128i m;
+               int m4;
+               s = _mm_add_ps(s, _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(s), 4)));
+               s = _mm_add_ps(s, _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(s), 8)));
+               s = _mm_add_ps(s, sum4);
+               sum4 = _mm_shuffle_ps(s, s, _MM_SHUFFLE(3,3,3,3));
+               k = _mm_add_ps(_mm_loadu_ps(scanline + i), s);
+               k = _mm_add_ps(_mm_mul_ps(_mm_and_ps(k, abs_mask), k255), khalf);
+               m = _mm_cvttps_epi32(k);
+               m = _mm_packs_epi32(m, m);
+               m = _mm_packus_epi16(m, m); // saturate to 255
+               m4 = _mm_cvtsi128_si32(m);
+               STBTT_memcpy(dst + i, &m4, 4);
+            }
+            sum = _mm_cvtss_f32(sum4);
+         }
+#endif
+         for (; i < result->w; ++i) {
             float k;
             int m;
             sum += scanline2[i];
@@ -4017,12 +4378,85 @@ STBTT_DEF void stbtt_PackSetSkipMissingCodepoints(stbtt_pack_context *spc, int s
 
 #define STBTT__OVER_MASK  (STBTT_MAX_OVERSAMPLE-1)
 
+#if defined(STBTT_SSE2) && STBTT_MAX_OVERSAMPLE <= 8
+// [DEAR IMGUI] SSE2 versions of the box filters below, for kernel_width 2..8, producing identical output.
+// Like the scalar versions, they compute pixels[i] = (sum of the kernel_width unfiltered pixels ending at i) / kernel_width,
+// relying on the last kernel_width-1 pixels being zero. The division uses a 16-bit reciprocal, exact for sums up to 8*255.
+static __m128i stbtt__box_filter_div_sse2(__m128i total_lo, __m128i total_hi, __m128i recip)
+{
+   return _mm_packus_epi16(_mm_mulhi_epu16(total_lo, recip), _mm_mulhi_epu16(total_hi, recip));
+}
+
+static void stbtt__h_prefilter_sse2(unsigned char *pixels, int w, int h, int stride_in_bytes, unsigned int kernel_width)
+{
+   const int k = (int) kernel_width;
+   const __m128i recip = _mm_set1_epi16((short) ((65536 + k - 1) / k));
+   const __m128i zero = _mm_setzero_si128();
+   int j;
+   for (j=0; j < h; ++j) {
+      int i, d;
+      // 16 pixels at a time from right to left, so the pixels on the left of the current block are still unfiltered
+      for (i = w - 16; i >= k - 1; i -= 16) {
+         __m128i lo = zero, hi = zero;
+         for (d=0; d < k; ++d) {
+            __m128i v = _mm_loadu_si128((const __m128i *) (pixels + i - d));
+            lo = _mm_add_epi16(lo, _mm_unpacklo_epi8(v, zero));
+            hi = _mm_add_epi16(hi, _mm_unpackhi_epi8(v, zero));
+         }
+         _mm_storeu_si128((__m128i *) (pixels + i), stbtt__box_filter_div_sse2(lo, hi, recip));
+      }
+      // remaining pixels on the left
+      for (i += 15; i >= 0; --i) {
+         unsigned int total = 0;
+         for (d=0; d < k && d <= i; ++d)
+            total += pixels[i - d];
+         pixels[i] = (unsigned char) (total / kernel_width);
+      }
+      pixels += stride_in_bytes;
+   }
+}
+
+static void stbtt__v_prefilter_sse2(unsigned char *pixels, int w, int h, int stride_in_bytes, unsigned int kernel_width)
+{
+   const int k = (int) kernel_width;
+   const __m128i recip = _mm_set1_epi16((short) ((65536 + k - 1) / k));
+   const __m128i zero = _mm_setzero_si128();
+   int i, j;
+   STBTT_assert((w & 15) == 0);
+   for (j=0; j < w; j += 16) {
+      // 16 columns at a time, keeping the last kernel_width unfiltered rows in a ring buffer
+      __m128i buffer[STBTT_MAX_OVERSAMPLE];
+      __m128i lo = zero, hi = zero;
+      int buffer_pos = 0;
+      for (i=0; i < k; ++i)
+         buffer[i] = zero;
+      for (i=0; i < h; ++i) {
+         unsigned char *p = pixels + j + i*stride_in_bytes;
+         __m128i v = _mm_loadu_si128((const __m128i *) p);
+         __m128i old = buffer[buffer_pos];
+         lo = _mm_add_epi16(_mm_sub_epi16(lo, _mm_unpacklo_epi8(old, zero)), _mm_unpacklo_epi8(v, zero));
+         hi = _mm_add_epi16(_mm_sub_epi16(hi, _mm_unpackhi_epi8(old, zero)), _mm_unpackhi_epi8(v, zero));
+         buffer[buffer_pos] = v;
+         if (++buffer_pos == k)
+            buffer_pos = 0;
+         _mm_storeu_si128((__m128i *) p, stbtt__box_filter_div_sse2(lo, hi, recip));
+      }
+   }
+}
+#endif
+
 static void stbtt__h_prefilter(unsigned char *pixels, int w, int h, int stride_in_bytes, unsigned int kernel_width)
 {
    unsigned char buffer[STBTT_MAX_OVERSAMPLE];
    int safe_w = w - kernel_width;
    int j;
    STBTT_memset(buffer, 0, STBTT_MAX_OVERSAMPLE); // suppress bogus warning from VS2013 -analyze
+#if defined(STBTT_SSE2) && STBTT_MAX_OVERSAMPLE <= 8
+   if (kernel_width >= 2) { // [DEAR IMGUI]
+      stbtt__h_prefilter_sse2(pixels, w, h, stride_in_bytes, kernel_width);
+      return;
+   }
+#endif
    for (j=0; j < h; ++j) {
       int i;
       unsigned int total;
@@ -4085,6 +4519,14 @@ static void stbtt__v_prefilter(unsigned char *pixels, int w, int h, int stride_i
    int safe_h = h - kernel_width;
    int j;
    STBTT_memset(buffer, 0, STBTT_MAX_OVERSAMPLE); // suppress bogus warning from VS2013 -analyze
+#if defined(STBTT_SSE2) && STBTT_MAX_OVERSAMPLE <= 8
+   if (kernel_width >= 2 && w >= 16) { // [DEAR IMGUI] SSE2 for multiples of 16 columns, scalar for the rest
+      int w16 = w & ~15;
+      stbtt__v_prefilter_sse2(pixels, w16, h, stride_in_bytes, kernel_width);
+      pixels += w16;
+      w -= w16;
+   }
+#endif
    for (j=0; j < w; ++j) {
       int i;
       unsigned int total;